@@ -0,0 +1,249 @@
+/*======================================================================
+ *                             approximate.c
+ *======================================================================
+ * Approval winners certified from a sample of the voters.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Approval winners certified from a sample of the voters.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "approximate.h"
+#include "checkpoint.h"
+#include "hamming_table.h"
+
+/**
+ * Voters sampled before the first test; elections of no more voter
+ * groups are decided exactly.
+ */
+#define APPROXIMATE_MIN_SAMPLES 256
+
+int approximate_init(unsigned num_issues,
+                     double confidence,
+                     uint64_t seed,
+                     uint64_t stream,
+                     ApproximateEngine *engine){
+    memset(engine, 0, sizeof(*engine));
+    engine->num_issues = num_issues;
+    engine->pool_size = (size_t)1 << num_issues;
+    engine->confidence = confidence;
+    approximate_reset(seed, stream, engine);
+    engine->cumulative = malloc(sizeof(*engine->cumulative) * engine->pool_size);
+    engine->sums = malloc(sizeof(*engine->sums) * engine->pool_size);
+    engine->contenders = malloc(sizeof(*engine->contenders) * engine->pool_size);
+    if(!engine->cumulative || !engine->sums || !engine->contenders){
+        approximate_free(engine);
+        return -1;
+    }
+    return 0;
+}
+
+void approximate_reset(uint64_t seed, uint64_t stream, ApproximateEngine *engine){
+    rand_seed(seed, ~stream, &engine->random);
+}
+
+void approximate_free(ApproximateEngine *engine){
+    free(engine->cumulative);
+    free(engine->sums);
+    free(engine->contenders);
+    engine->cumulative = NULL;
+    engine->sums = NULL;
+    engine->contenders = NULL;
+}
+
+int approximate_save(const ApproximateEngine *engine, FILE *stream){
+    return checkpoint_put(&engine->random, sizeof(engine->random), stream);
+}
+
+int approximate_load(FILE *stream, ApproximateEngine *engine){
+    return checkpoint_get(&engine->random, sizeof(engine->random), stream);
+}
+
+/*
+ * Sum of the distances of every voter from a candidate.
+ */
+static unsigned exact_disapproval(size_t id, size_t num_candidates, const Candidate *candidates){
+    unsigned sum_disapproval = 0;
+    size_t i;
+    for(i = 0; i < num_candidates; i++){
+        sum_disapproval += HAMMING[id ^ candidates[i].id] * candidates[i].votes;
+    }
+    return sum_disapproval;
+}
+
+/*
+ * Draws a voter uniformly and adds its distance from every candidate
+ * to their sums.
+ */
+static void sample_voter(unsigned turnout,
+                         size_t num_candidates,
+                         const Candidate *candidates,
+                         ApproximateEngine *engine){
+    // the voter's group is the first whose cumulative votes exceed it
+    unsigned voter = rand_uniform(&engine->random) * turnout;
+    size_t low = 0;
+    size_t high = num_candidates - 1;
+    while(low < high){
+        size_t middle = low + (high - low)/2;
+        if(engine->cumulative[middle] > voter){
+            high = middle;
+        }else{
+            low = middle + 1;
+        }
+    }
+
+    const size_t id = candidates[low].id;
+    size_t i;
+    for(i = 0; i < num_candidates; i++){
+        engine->sums[i] += HAMMING[id ^ candidates[i].id];
+    }
+}
+
+void decide_approximate_election(unsigned turnout,
+                                 size_t num_candidates,
+                                 size_t *num_a_winners,
+                                 Candidate *candidates,
+                                 Candidate **elected_a,
+                                 ApproximateReport *report,
+                                 ApproximateEngine *engine){
+    report->confidence = engine->confidence;
+    report->num_samples = 0;
+    report->num_contenders = num_candidates;
+    report->error = 0;
+
+    size_t i;
+    unsigned votes = 0;
+    for(i = 0; i < num_candidates; i++){
+        votes += candidates[i].votes;
+        engine->cumulative[i] = votes;
+        engine->sums[i] = 0;
+    }
+
+    // every round at least doubles the sample while it stays below the
+    // number of voter groups
+    unsigned num_rounds = 0;
+    unsigned long samples;
+    for(samples = APPROXIMATE_MIN_SAMPLES; samples < num_candidates; samples *= 2){
+        num_rounds++;
+    }
+    // the bounds of every pair of candidates and every estimate, over
+    // every round, are each exceeded with probability exp(-z) at most
+    double z = 0;
+    size_t num_contenders = num_candidates;
+    size_t leader = 0;
+    samples = 0;
+    if(turnout && num_rounds){
+        z = log(4.0 * num_candidates * num_candidates * num_rounds / (1 - engine->confidence));
+        unsigned long target = APPROXIMATE_MIN_SAMPLES;
+        for(;;){
+            for(; samples < target; samples++){
+                sample_voter(turnout, num_candidates, candidates, engine);
+            }
+            leader = 0;
+            for(i = 1; i < num_candidates; i++){
+                if(engine->sums[i] < engine->sums[leader]){
+                    leader = i;
+                }
+            }
+            // each voter moves the difference of two candidates by at
+            // most their distance
+            const double width = sqrt(2 * z * samples);
+            num_contenders = 0;
+            for(i = 0; i < num_candidates; i++){
+                unsigned distance = HAMMING[candidates[i].id ^ candidates[leader].id];
+                if(engine->sums[i] - engine->sums[leader] <= distance * width){
+                    engine->contenders[num_contenders++] = i;
+                }
+            }
+            // stop once the contenders cost less than another doubling,
+            // or before the sample would outnumber the groups
+            if(num_contenders <= target || 2*target >= num_candidates){
+                break;
+            }
+            target *= 2;
+        }
+    }
+    if(num_contenders == num_candidates){
+        for(i = 0; i < num_candidates; i++){
+            engine->contenders[i] = i;
+        }
+    }
+
+    // the contenders are decided exactly, in the order of the
+    // candidates
+    *num_a_winners = 0;
+    for(i = 0; i < num_contenders; i++){
+        Candidate *candidate = candidates + engine->contenders[i];
+        candidate->sum_disapproval = exact_disapproval(candidate->id, num_candidates, candidates);
+        if(!*num_a_winners || candidate->sum_disapproval < elected_a[0]->sum_disapproval){
+            elected_a[0] = candidate;
+            *num_a_winners = 1;
+        }else if(candidate->sum_disapproval == elected_a[0]->sum_disapproval){
+            elected_a[(*num_a_winners)++] = candidate;
+        }
+    }
+    if(num_contenders == num_candidates){
+        return;
+    }
+
+    // the others are estimated, and known to be worse than the winners
+    report->num_samples = samples;
+    report->num_contenders = num_contenders;
+    report->error = turnout * (double)engine->num_issues * sqrt(z / (2.0*samples));
+    size_t c = 0;
+    for(i = 0; i < num_candidates; i++){
+        if(c < num_contenders && engine->contenders[c] == i){
+            c++;
+            continue;
+        }
+        double estimate = (double)turnout * engine->sums[i] / samples + 0.5;
+        unsigned least = elected_a[0]->sum_disapproval + 1;
+        candidates[i].sum_disapproval = (estimate > least) ? (unsigned)estimate : least;
+    }
+}
@@ -0,0 +1,191 @@
+/*======================================================================
+ *                             approximate.h
+ *======================================================================
+ * Approval winners certified from a sample of the voters.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Approval winners certified from a sample of the voters.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef APPROXIMATE_H
+#define APPROXIMATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "confuzz.h"
+#include "election.h"
+
+/**
+ * Bounds achieved by an approximate approval election.
+ */
+typedef struct{
+    double confidence; /**< probability with which the bounds hold */
+    unsigned long num_samples; /**< voters sampled, or 0 if every
+                                    disapproval sum is exact */
+    size_t num_contenders; /**< candidates whose disapproval sum was
+                                computed exactly */
+    double error; /**< bound on the error of the estimated disapproval
+                       sum of every other candidate */
+} ApproximateReport;
+
+/**
+ * Buffers of the approximate approval engine, sized for a pool of
+ * candidates.
+ *
+ * The disapproval sum of a candidate, the sum over the voters of their
+ * distance to it, is estimated from voters sampled with replacement,
+ * each distance being within [0, n]; the difference of two candidates
+ * c and l is estimated from the same voters, each term within
+ * [-d(c,l), d(c,l)], so the candidates near the leader l are told
+ * apart from it by few voters. By Hoeffding's inequality, every
+ * candidate whose estimated difference exceeds its bound is worse than
+ * the leader; the others are the contenders, whose sums are computed
+ * exactly, the winners among them being the approval winners. The
+ * sample is doubled while computing the contenders would cost more
+ * than another doubling, and abandoned for the exact sums once it would
+ * outnumber the voter groups.
+ *
+ * The bounds are split over every pair of candidates, every estimate,
+ * and every doubling, so that with probability at least the confidence
+ * the winners are those of the exact election and every estimate is
+ * within its bound.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    double confidence; /**< probability with which the bounds hold */
+    RandomState random; /**< generator of the samples */
+    unsigned *cumulative; /**< votes of the candidates up to and
+                               including each */
+    unsigned *sums; /**< distances of the sample from each candidate */
+    size_t *contenders; /**< candidates not told apart from the leader */
+} ApproximateEngine;
+
+/**
+ * Initializes an ApproximateEngine structure. Its generator is seeded
+ * on the complement of the stream, apart from the streams of the
+ * elections.
+ *
+ * @param num_issues number of issues in the election
+ * @param confidence probability with which the bounds hold, within
+ *                   (0, 1)
+ * @param seed seed of the generator
+ * @param stream stream of the elections
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int approximate_init(unsigned num_issues,
+                     double confidence,
+                     uint64_t seed,
+                     uint64_t stream,
+                     ApproximateEngine *engine);
+
+/**
+ * Reseeds the generator of an ApproximateEngine structure.
+ *
+ * @param seed seed of the generator
+ * @param stream stream of the elections
+ * @param engine pointer to the engine
+ */
+void approximate_reset(uint64_t seed, uint64_t stream, ApproximateEngine *engine);
+
+/**
+ * Releases the memory held by an ApproximateEngine structure.
+ *
+ * @param engine pointer to the engine
+ */
+void approximate_free(ApproximateEngine *engine);
+
+/**
+ * Writes the generator of an ApproximateEngine structure to a
+ * checkpoint.
+ *
+ * @param engine pointer to the engine
+ * @param stream checkpoint stream
+ *
+ * @return 0 on success, -1 on failure
+ */
+int approximate_save(const ApproximateEngine *engine, FILE *stream);
+
+/**
+ * Reads the generator of an ApproximateEngine structure from a
+ * checkpoint.
+ *
+ * @param stream checkpoint stream
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 on failure
+ */
+int approximate_load(FILE *stream, ApproximateEngine *engine);
+
+/**
+ * Decides an approval election from a sample of the voters.
+ *
+ * The candidates are their own voter groups. The disapproval sums of
+ * the contenders are exact; those of the other candidates are their
+ * estimates, within the error reported.
+ *
+ * @param turnout number of voters who cast a ballot
+ * @param num_candidates number of candidates; at least 1
+ * @param num_a_winners pointer to the number of approval winners
+ * @param candidates array of candidates; their disapproval sums are
+ *                   set
+ * @param elected_a array to hold pointers to the approval winners
+ * @param report pointer to the bounds achieved
+ * @param engine pointer to the engine
+ */
+void decide_approximate_election(unsigned turnout,
+                                 size_t num_candidates,
+                                 size_t *num_a_winners,
+                                 Candidate *candidates,
+                                 Candidate **elected_a,
+                                 ApproximateReport *report,
+                                 ApproximateEngine *engine);
+
+#endif
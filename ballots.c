@@ -0,0 +1,325 @@
+/*======================================================================
+ *                               ballots.c
+ *======================================================================
+ * Empirical ballot datasets and their bootstrap resamples.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Empirical ballot datasets and their bootstrap resamples.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ballots.h"
+
+/*
+ * Binary ballots aggregated by the threads of a pool; each thread
+ * counts its ballots in its own row of counts, the last column of which
+ * counts the ballots of no platform.
+ */
+typedef struct{
+    const unsigned char *records; /**< stance bitmasks of the ballots */
+    size_t pool_size; /**< number of possible platforms */
+    unsigned *counts; /**< per thread, pool_size + 1 counts */
+} Aggregation;
+
+/* Reads a little-endian integer of a number of bytes. */
+static uint64_t read_little_endian(const unsigned char *bytes, unsigned size){
+    uint64_t value = 0;
+    while(size--){
+        value = (value << 8) | bytes[size];
+    }
+    return value;
+}
+
+static void aggregate_ballots(size_t first, size_t last, unsigned thread, void *argument){
+    Aggregation *aggregation = argument;
+    const size_t pool_size = aggregation->pool_size;
+    unsigned *counts = aggregation->counts + thread*(pool_size + 1);
+    const unsigned char *record = aggregation->records + 2*first;
+    size_t i;
+    for(i = first; i < last; i++, record += 2){
+        size_t id = record[0] | (size_t)record[1] << 8;
+        counts[(id < pool_size) ? id : pool_size]++;
+    }
+}
+
+/*
+ * Collects the platforms with ballots from their counts; the counts
+ * must add up to at most BALLOTS_MAX_VOTERS.
+ */
+static int collect_platforms(const unsigned *counts, BallotSet *ballots){
+    size_t id;
+    unsigned long long num_voters = 0;
+    ballots->num_platforms = 0;
+    for(id = 0; id < ballots->pool_size; id++){
+        num_voters += counts[id];
+        ballots->num_platforms += !!counts[id];
+    }
+    if(!num_voters || num_voters > BALLOTS_MAX_VOTERS){
+        return -1;
+    }
+    ballots->num_voters = num_voters;
+    ballots->platforms = calloc(ballots->num_platforms, sizeof(*ballots->platforms));
+    if(!ballots->platforms){
+        return -1;
+    }
+    size_t n = 0;
+    for(id = 0; id < ballots->pool_size; id++){
+        if(counts[id]){
+            ballots->platforms[n].id = id;
+            ballots->platforms[n].votes = counts[id];
+            n++;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Aggregates a mapped binary ballot file, whose header has been
+ * checked, in parallel.
+ */
+static int aggregate_binary(const unsigned char *map, size_t num_records, WorkerPool *pool,
+                            BallotSet *ballots){
+    const unsigned num_threads = worker_pool_size(pool);
+    Aggregation aggregation;
+    aggregation.records = map + BALLOTS_HEADER_SIZE;
+    aggregation.pool_size = ballots->pool_size;
+    aggregation.counts = calloc((ballots->pool_size + 1) * num_threads,
+                                sizeof(*aggregation.counts));
+    if(!aggregation.counts){
+        return -1;
+    }
+    worker_pool_run(num_records, 1, aggregate_ballots, &aggregation, pool);
+
+    // the rows are added into the first, in thread order
+    unsigned t;
+    size_t id;
+    int status = 0;
+    for(t = 1; t < num_threads; t++){
+        const unsigned *row = aggregation.counts + t*(ballots->pool_size + 1);
+        for(id = 0; id <= ballots->pool_size; id++){
+            aggregation.counts[id] += row[id];
+        }
+    }
+    if(aggregation.counts[ballots->pool_size] ||
+       collect_platforms(aggregation.counts, ballots)){
+        status = -1;
+    }
+    free(aggregation.counts);
+    return status;
+}
+
+/* Maps and aggregates a binary ballot file. */
+static int load_binary(int fd, size_t size, WorkerPool *pool, BallotSet *ballots){
+    unsigned char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(map == MAP_FAILED){
+        return -1;
+    }
+    posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+
+    uint64_t num_issues = read_little_endian(map + 8, 4);
+    uint64_t num_records = read_little_endian(map + 16, 8);
+    int status = -1;
+    if(num_issues && num_issues <= BALLOTS_MAX_ISSUES && num_records <= BALLOTS_MAX_VOTERS &&
+       size == BALLOTS_HEADER_SIZE + 2*num_records){
+        ballots->num_issues = num_issues;
+        ballots->pool_size = (size_t)1 << num_issues;
+        status = aggregate_binary(map, num_records, pool, ballots);
+    }
+    munmap(map, size);
+    return status;
+}
+
+/*
+ * Parses a CSV line of stances into a platform id, returning the number
+ * of stances, or 0 if the line is not a ballot.
+ */
+static unsigned parse_stances(const char *line, size_t *id){
+    unsigned num_stances = 0;
+    *id = 0;
+    for(;;){
+        while(*line == ' ' || *line == '\t'){
+            line++;
+        }
+        if((*line != '0' && *line != '1') || num_stances == BALLOTS_MAX_ISSUES){
+            return 0;
+        }
+        *id |= (size_t)(*line++ - '0') << num_stances++;
+        while(*line == ' ' || *line == '\t'){
+            line++;
+        }
+        if(*line != ','){
+            break;
+        }
+        line++;
+    }
+    return (*line == '\n' || *line == '\r' || !*line) ? num_stances : 0;
+}
+
+/* Streams and aggregates a CSV ballot file. */
+static int load_csv(FILE *stream, BallotSet *ballots){
+    unsigned *counts = NULL;
+    char *line = NULL;
+    size_t capacity = 0;
+    unsigned long long num_voters = 0;
+    unsigned long num_lines = 0;
+    int status = 0;
+    while(getline(&line, &capacity, stream) > 0){
+        num_lines++;
+        // blank lines are skipped
+        if(line[strspn(line, " \t\r\n")] == '\0'){
+            continue;
+        }
+        size_t id;
+        unsigned num_stances = parse_stances(line, &id);
+        if(!counts){
+            // the first line may be a header
+            if(!num_stances && num_lines == 1){
+                continue;
+            }
+            ballots->num_issues = num_stances;
+            ballots->pool_size = (size_t)1 << num_stances;
+            counts = calloc(ballots->pool_size, sizeof(*counts));
+            if(!num_stances || !counts){
+                status = -1;
+                break;
+            }
+        }
+        if(num_stances != ballots->num_issues || ++num_voters > BALLOTS_MAX_VOTERS){
+            status = -1;
+            break;
+        }
+        counts[id]++;
+    }
+    if(!status && (ferror(stream) || !counts || collect_platforms(counts, ballots))){
+        status = -1;
+    }
+    free(line);
+    free(counts);
+    return status;
+}
+
+int ballots_load(const char *path, WorkerPool *pool, BallotSet *ballots){
+    memset(ballots, 0, sizeof(*ballots));
+    int fd = open(path, O_RDONLY);
+    if(fd < 0){
+        return -1;
+    }
+    struct stat info;
+    unsigned char magic[sizeof(BALLOTS_MAGIC) - 1];
+    if(fstat(fd, &info)){
+        close(fd);
+        return -1;
+    }
+
+    int result;
+    if(info.st_size >= BALLOTS_HEADER_SIZE &&
+       pread(fd, magic, sizeof(magic), 0) == (ssize_t)sizeof(magic) &&
+       !memcmp(magic, BALLOTS_MAGIC, sizeof(magic))){
+        result = load_binary(fd, info.st_size, pool, ballots);
+        close(fd);
+    }else{
+        FILE *stream = fdopen(fd, "r");
+        if(!stream){
+            close(fd);
+            return -1;
+        }
+        result = load_csv(stream, ballots);
+        fclose(stream);
+    }
+    if(result){
+        ballots_free(ballots);
+    }
+    return result;
+}
+
+void ballots_free(BallotSet *ballots){
+    free(ballots->platforms);
+    memset(ballots, 0, sizeof(*ballots));
+}
+
+void ballots_allocate(unsigned bootstrap,
+                      size_t *num_candidates,
+                      Candidate *candidates,
+                      RandomState *random,
+                      const BallotSet *ballots){
+    const Candidate *platforms = ballots->platforms;
+    size_t n = 0;
+    size_t i;
+    if(!bootstrap){
+        memcpy(candidates, platforms, sizeof(*candidates) * ballots->num_platforms);
+        n = ballots->num_platforms;
+    }else{
+        // each platform draws from the ballots left among the platforms
+        // from it on
+        unsigned left = ballots->num_voters;
+        unsigned mass = ballots->num_voters;
+        for(i = 0; i < ballots->num_platforms && left; i++){
+            unsigned votes = (i + 1 < ballots->num_platforms) ?
+                             rand_binomial(left, (double)platforms[i].votes/mass, random) : left;
+            mass -= platforms[i].votes;
+            left -= votes;
+            if(votes){
+                candidates[n] = platforms[i];
+                candidates[n].votes = votes;
+                n++;
+            }
+        }
+    }
+    if(n == 1){
+        candidates[1].id = (candidates[0].id + 1) & (ballots->pool_size - 1);
+    }
+    *num_candidates = n;
+}
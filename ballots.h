@@ -0,0 +1,157 @@
+/*======================================================================
+ *                               ballots.h
+ *======================================================================
+ * Empirical ballot datasets and their bootstrap resamples.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Empirical ballot datasets and their bootstrap resamples.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef BALLOTS_H
+#define BALLOTS_H
+
+#include <limits.h>
+#include <stddef.h>
+
+#include "confuzz.h"
+#include "election.h"
+#include "workers.h"
+
+/**
+ * Magic bytes opening a binary ballot file.
+ *
+ * A binary ballot file is the 8 magic bytes, the number of issues as a
+ * 32-bit little-endian integer, 4 reserved zero bytes, and the number
+ * of ballots as a 64-bit little-endian integer, followed by the stance
+ * bitmask of every ballot as a 16-bit little-endian integer; bit w of a
+ * bitmask is the stance on issue w, as in the id of a platform.
+ */
+#define BALLOTS_MAGIC "VSBALLOT"
+
+/**
+ * Size in bytes of the header of a binary ballot file.
+ */
+#define BALLOTS_HEADER_SIZE 24
+
+/**
+ * Largest number of issues of a ballot file; the width of a binary
+ * stance bitmask.
+ */
+#define BALLOTS_MAX_ISSUES 16
+
+/**
+ * Largest number of ballots of a ballot file, so that the sum of
+ * disapproval of a candidate cannot overflow.
+ */
+#define BALLOTS_MAX_VOTERS (UINT_MAX / BALLOTS_MAX_ISSUES)
+
+/**
+ * Ballots of an empirical dataset, aggregated into the votes of every
+ * platform.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues of the ballots */
+    size_t pool_size; /**< number of possible platforms */
+    unsigned num_voters; /**< number of ballots */
+    size_t num_platforms; /**< number of platforms with ballots */
+    Candidate *platforms; /**< platforms with ballots by ascending id,
+                               their votes the number of ballots */
+} BallotSet;
+
+/**
+ * Loads a ballot file: a binary file (see BALLOTS_MAGIC), which is
+ * mapped into memory and aggregated by the threads of the pool, each
+ * counting its share of the ballots separately, or otherwise a CSV
+ * file, which is streamed. A CSV file holds one ballot per line of
+ * comma-separated stances of 0 or 1, issue 0 first, and may open with a
+ * header line; the number of issues is the number of stances.
+ *
+ * @param path path of the ballot file
+ * @param pool pointer to the worker pool aggregating a binary file, or
+ *             NULL
+ * @param ballots pointer to the ballot set
+ *
+ * @return 0 on success, -1 if the file cannot be read, is malformed,
+ *         holds no ballots or too many, or memory could not be
+ *         allocated
+ */
+int ballots_load(const char *path, WorkerPool *pool, BallotSet *ballots);
+
+/**
+ * Releases the memory held by a BallotSet structure.
+ *
+ * @param ballots pointer to the ballot set
+ */
+void ballots_free(BallotSet *ballots);
+
+/**
+ * Allocates the votes of an election from a ballot set, in place of
+ * perform_election: the platforms with ballots are the actual
+ * candidates, with their ballots as votes.
+ *
+ * Under bootstrap the ballots are resampled with replacement, as many
+ * as were loaded, without reading them again: the resampled votes are
+ * a multinomial draw over the platforms, made as one binomial draw per
+ * platform conditioned on the ones before it, so the cost does not
+ * depend on the number of ballots.
+ *
+ * @param bootstrap whether to resample the ballots
+ * @param num_candidates pointer to the variable holding the number of
+ *                       actual candidates
+ * @param candidates array to hold actual candidates, of the pool size;
+ *                   when there is a single actual candidate, the id of
+ *                   the platform following it is set too, as by
+ *                   perform_election
+ * @param random pointer to the generator state of the resampling
+ * @param ballots pointer to the ballot set
+ */
+void ballots_allocate(unsigned bootstrap,
+                      size_t *num_candidates,
+                      Candidate *candidates,
+                      RandomState *random,
+                      const BallotSet *ballots);
+
+#endif
@@ -0,0 +1,222 @@
+/*======================================================================
+ *                                batch.c
+ *======================================================================
+ * Batched election statistics as distance-matrix products.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Batched election statistics as distance-matrix products.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+#include "election.h"
+#include "hamming_table.h"
+
+/*
+ * Rows of the vote matrix per tile; a tile of a full batch stays in the
+ * first-level cache while the shells of an output row are summed.
+ */
+#define BATCH_TILE 16
+
+int batch_init(unsigned num_issues, size_t batch_size, BatchEngine *engine){
+    memset(engine, 0, sizeof(*engine));
+    engine->num_issues = num_issues;
+    engine->pool_size = (size_t)1 << num_issues;
+    engine->batch_size = batch_size;
+    size_t cells = engine->pool_size * batch_size;
+    engine->rows = malloc(sizeof(*engine->rows) * engine->pool_size);
+    engine->active = calloc(engine->pool_size, sizeof(*engine->active));
+    engine->votes = calloc(cells, sizeof(*engine->votes));
+    engine->disapproval = malloc(sizeof(*engine->disapproval) * cells);
+    engine->leaning = malloc(sizeof(*engine->leaning) * 3*cells);
+    engine->shells = malloc(sizeof(*engine->shells) * (num_issues+1) * batch_size);
+    if(!engine->rows || !engine->active || !engine->votes || !engine->disapproval ||
+       !engine->leaning || !engine->shells){
+        batch_free(engine);
+        return -1;
+    }
+    return 0;
+}
+
+void batch_free(BatchEngine *engine){
+    free(engine->rows);
+    free(engine->active);
+    free(engine->votes);
+    free(engine->disapproval);
+    free(engine->leaning);
+    free(engine->shells);
+    memset(engine, 0, sizeof(*engine));
+}
+
+void batch_add_election(size_t num_candidates, const Candidate *candidates, BatchEngine *engine){
+    size_t column = engine->num_columns++;
+    size_t i;
+    for(i = 0; i < num_candidates; i++){
+        size_t id = candidates[i].id;
+        if(!engine->active[id]){
+            engine->active[id] = 1;
+            engine->rows[engine->num_rows++] = id;
+        }
+        engine->votes[id*engine->batch_size + column] = candidates[i].votes;
+    }
+}
+
+void batch_statistics(unsigned plan, BatchEngine *engine){
+    const size_t stride = engine->batch_size;
+    const size_t num_columns = engine->num_columns;
+    const size_t num_rows = engine->num_rows;
+    const size_t matrix = engine->pool_size * stride;
+    const unsigned num_issues = engine->num_issues;
+    // votes of each election at each distance from the platform of a row
+    unsigned *shells = engine->shells;
+
+    size_t tile, i, k, b;
+    unsigned d;
+    for(i = 0; i < num_rows; i++){
+        size_t x = engine->rows[i];
+        memset(shells, 0, sizeof(*shells) * (num_issues+1) * stride);
+        for(tile = 0; tile < num_rows; tile += BATCH_TILE){
+            size_t end = (tile + BATCH_TILE < num_rows) ? tile + BATCH_TILE : num_rows;
+            for(k = tile; k < end; k++){
+                size_t y = engine->rows[k];
+                const unsigned *votes = engine->votes + y*stride;
+                // the distance tile is generated, never stored
+                unsigned *shell = shells + HAMMING[x ^ y]*stride;
+                for(b = 0; b < num_columns; b++){
+                    shell[b] += votes[b];
+                }
+            }
+        }
+
+        // a weighted sum of the shells, and their sums by leaning
+        unsigned *disapproval = engine->disapproval + x*stride;
+        memset(disapproval, 0, sizeof(*disapproval) * num_columns);
+        for(d = 1; d <= num_issues; d++){
+            const unsigned *shell = shells + d*stride;
+            for(b = 0; b < num_columns; b++){
+                disapproval[b] += d * shell[b];
+            }
+        }
+        if(plan & STAGE_LEANING){
+            unsigned c;
+            for(c = 0; c < 3; c++){
+                memset(engine->leaning + c*matrix + x*stride, 0,
+                       sizeof(*engine->leaning) * num_columns);
+            }
+            for(d = 0; d <= num_issues; d++){
+                // pro, medius, or contra, as candidate_statistics
+                c = (2*d > num_issues) + (2*d >= num_issues);
+                unsigned *voters = engine->leaning + c*matrix + x*stride;
+                const unsigned *shell = shells + d*stride;
+                for(b = 0; b < num_columns; b++){
+                    voters[b] += shell[b];
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Finds the first candidate farthest from a candidate, as
+ * compute_planned_statistics does.
+ */
+static size_t batch_hitler(size_t num_candidates,
+                           const Candidate *candidate,
+                           const Candidate *candidates){
+    unsigned max_disapproval = 0;
+    size_t hitler = candidate->id;
+    size_t h;
+    for(h = 0; h < num_candidates; h++){
+        unsigned disapproval = HAMMING[candidate->id ^ candidates[h].id];
+        if(disapproval > max_disapproval){
+            hitler = candidates[h].id;
+            max_disapproval = disapproval;
+        }
+    }
+    return hitler;
+}
+
+void batch_candidate_statistics(unsigned plan,
+                                size_t column,
+                                size_t num_candidates,
+                                Candidate *candidates,
+                                const BatchEngine *engine){
+    const size_t stride = engine->batch_size;
+    const size_t matrix = engine->pool_size * stride;
+    size_t i;
+    for(i = 0; i < num_candidates; i++){
+        size_t cell = candidates[i].id*stride + column;
+        candidates[i].sum_disapproval = engine->disapproval[cell];
+        if(plan & STAGE_LEANING){
+            candidates[i].pro = engine->leaning[cell];
+            candidates[i].medius = engine->leaning[matrix + cell];
+            candidates[i].contra = engine->leaning[2*matrix + cell];
+        }
+        if(plan & STAGE_HITLER){
+            // the opposite platform is the only one at the largest distance
+            size_t opposite = candidates[i].id ^ (engine->pool_size - 1);
+            if(engine->votes[opposite*stride + column]){
+                candidates[i].hitler = opposite;
+            }else{
+                candidates[i].hitler = batch_hitler(num_candidates, candidates+i, candidates);
+            }
+        }
+    }
+}
+
+void batch_clear(BatchEngine *engine){
+    size_t i;
+    for(i = 0; i < engine->num_rows; i++){
+        size_t x = engine->rows[i];
+        engine->active[x] = 0;
+        memset(engine->votes + x*engine->batch_size, 0,
+               sizeof(*engine->votes) * engine->num_columns);
+    }
+    engine->num_rows = 0;
+    engine->num_columns = 0;
+}
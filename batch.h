@@ -0,0 +1,174 @@
+/*======================================================================
+ *                                batch.h
+ *======================================================================
+ * Batched election statistics as distance-matrix products.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Batched election statistics as distance-matrix products.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+
+#include "election.h"
+
+/**
+ * Largest number of issues for which elections are batched. The
+ * products cost about the square of the platforms with votes per
+ * election, against the square of the candidates of one election
+ * compared pair by pair, so they only pay off while the pool is not
+ * much larger than an election.
+ */
+#define BATCH_MAX_ISSUES 6
+
+/**
+ * Largest number of elections of a batch.
+ */
+#define BATCH_MAX_SIZE 1024
+
+/**
+ * Dense vote vectors of a batch of elections and their products with
+ * the distance matrix of the platforms.
+ *
+ * Column b of the vote matrix holds the votes of election b on every
+ * platform. The sum of disapproval of every platform in every election
+ * is the product of the distance matrix with the vote matrix, and the
+ * pro, medius, and contra voters are the products of the matrices
+ * indicating each class of distance with it. Only the platforms with
+ * votes in some election of the batch take part, and the distances are
+ * generated tile by tile rather than stored. The votes are first summed
+ * into shells by their distance from each platform, so that the sum of
+ * disapproval and the three classes all follow from one pass.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    size_t batch_size; /**< largest number of elections of a batch */
+    size_t num_columns; /**< elections in the batch */
+    size_t num_rows; /**< platforms with votes in some election */
+    unsigned *rows; /**< those platforms */
+    unsigned char *active; /**< whether each platform is in rows */
+    unsigned *votes; /**< votes of each platform in each election,
+                          batch_size per platform */
+    unsigned *disapproval; /**< sum of disapproval of each platform in
+                                each election, laid out as votes */
+    unsigned *leaning; /**< pro, medius, then contra voters of each
+                            platform in each election, three matrices
+                            laid out as votes */
+    unsigned *shells; /**< votes of each election at each distance from
+                           one platform, batch_size per distance */
+} BatchEngine;
+
+/**
+ * Initializes a BatchEngine structure.
+ *
+ * @param num_issues number of issues in the election; at most
+ *                   BATCH_MAX_ISSUES
+ * @param batch_size largest number of elections of a batch; at most
+ *                   BATCH_MAX_SIZE
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int batch_init(unsigned num_issues, size_t batch_size, BatchEngine *engine);
+
+/**
+ * Releases the memory held by a BatchEngine structure.
+ *
+ * @param engine pointer to the engine
+ */
+void batch_free(BatchEngine *engine);
+
+/**
+ * Adds the votes of an election to the batch as its next column; the
+ * batch must not be full.
+ *
+ * @param num_candidates number of candidates
+ * @param candidates array of candidates, with distinct platforms
+ * @param engine pointer to the engine
+ */
+void batch_add_election(size_t num_candidates, const Candidate *candidates, BatchEngine *engine);
+
+/**
+ * Computes the statistics of every election of the batch.
+ *
+ * @param plan stages of decide_election planned; the pro, medius, and
+ *             contra voters are only computed under STAGE_LEANING
+ * @param engine pointer to the engine
+ */
+void batch_statistics(unsigned plan, BatchEngine *engine);
+
+/**
+ * Copies the statistics of an election of the batch into its candidates:
+ * the sum of disapproval, and the pro, medius, and contra voters under
+ * STAGE_LEANING. Under STAGE_HITLER the hitler of every candidate is
+ * found as well, by a lookup of the opposite platform when it has votes
+ * and by a scan of the candidates otherwise.
+ *
+ * @param plan stages of decide_election planned, as for
+ *             batch_statistics
+ * @param column index of the election in the batch
+ * @param num_candidates number of candidates
+ * @param candidates array of candidates of the election, in the order
+ *                   added to the batch
+ * @param engine pointer to the engine
+ */
+void batch_candidate_statistics(unsigned plan,
+                                size_t column,
+                                size_t num_candidates,
+                                Candidate *candidates,
+                                const BatchEngine *engine);
+
+/**
+ * Empties the batch.
+ *
+ * @param engine pointer to the engine
+ */
+void batch_clear(BatchEngine *engine);
+
+#endif
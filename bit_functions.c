@@ -66,12 +66,13 @@ unsigned char hamming_weight(unsigned num){
     // MAX_LOOKUP_SIZE is the byte size of the maximum lookup available
     // in the hamming weight table. Here, we ensure there is no overflow
     // later on in the code.
-    if(MAX_LOOKUP_SIZE >= sizeof(unsigned)){
-        MAX_LOOKUP_SIZE = sizeof(unsigned) - 1;
+    size_t lookup_size = MAX_LOOKUP_SIZE;
+    if(lookup_size >= sizeof(unsigned)){
+        lookup_size = sizeof(unsigned) - 1;
     }
 
     // calculate slice size in bits
-    unsigned slice_size = MAX_LOOKUP_SIZE * 8;
+    unsigned slice_size = lookup_size * 8;
     
     // create mask for lower bits to calculate hamming weight in slices
     unsigned mask = ~(((unsigned)(-1)) << slice_size);
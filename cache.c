@@ -0,0 +1,324 @@
+/*======================================================================
+ *                                cache.c
+ *======================================================================
+ * On-disk cache of the results of simulation runs.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * On-disk cache of the results of simulation runs.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cache.h"
+#include "checkpoint.h"
+
+void cache_key_init(CacheKey *key){
+    // FNV-1a offset basis, and the golden ratio for the other half
+    key->hash[0] = 0xcbf29ce484222325ULL;
+    key->hash[1] = 0x9e3779b97f4a7c15ULL;
+    uint64_t version = SIMULATION_VERSION;
+    cache_key_add(&version, sizeof(version), key);
+}
+
+void cache_key_add(const void *data, size_t size, CacheKey *key){
+    const unsigned char *bytes = data;
+    size_t i;
+    for(i = 0; i < size; i++){
+        key->hash[0] = (key->hash[0] ^ bytes[i]) * 0x100000001b3ULL;
+        key->hash[1] = (key->hash[1] ^ bytes[i]) * 0xff51afd7ed558ccdULL;
+        key->hash[1] ^= key->hash[1] >> 29;
+    }
+}
+
+void cache_key_config(const SimulationConfig *config,
+                      unsigned long num_elections,
+                      CacheKey *key){
+    // field by field, since the padding of the structure is undefined
+    cache_key_add(&num_elections, sizeof(num_elections), key);
+    cache_key_add(&config->num_issues, sizeof(config->num_issues), key);
+    cache_key_add(&config->population_size, sizeof(config->population_size), key);
+    cache_key_add(&config->scheme, sizeof(config->scheme), key);
+    cache_key_add(&config->num_strata, sizeof(config->num_strata), key);
+    cache_key_add(&config->num_replicates, sizeof(config->num_replicates), key);
+    cache_key_add(&config->seed, sizeof(config->seed), key);
+    cache_key_add(&config->stream, sizeof(config->stream), key);
+    cache_key_add(&config->methods, sizeof(config->methods), key);
+    cache_key_add(&config->candidate_statistics, sizeof(config->candidate_statistics), key);
+    cache_key_add(&config->num_slate, sizeof(config->num_slate), key);
+    cache_key_add(config->slate, sizeof(*config->slate) * config->num_slate, key);
+    cache_key_add(&config->threshold, sizeof(config->threshold), key);
+    unsigned has_ballots = (config->ballots != NULL);
+    cache_key_add(&has_ballots, sizeof(has_ballots), key);
+    if(config->ballots){
+        const BallotSet *ballots = config->ballots;
+        cache_key_add(&ballots->num_platforms, sizeof(ballots->num_platforms), key);
+        size_t p;
+        for(p = 0; p < ballots->num_platforms; p++){
+            cache_key_add(&ballots->platforms[p].id, sizeof(ballots->platforms[p].id), key);
+            cache_key_add(&ballots->platforms[p].votes, sizeof(ballots->platforms[p].votes), key);
+        }
+    }
+    cache_key_add(&config->bootstrap, sizeof(config->bootstrap), key);
+    cache_key_add(&config->abstention, sizeof(config->abstention), key);
+    cache_key_add(&config->num_errors, sizeof(config->num_errors), key);
+    cache_key_add(config->errors, sizeof(*config->errors) * config->num_errors, key);
+    cache_key_add(&config->num_districts, sizeof(config->num_districts), key);
+    cache_key_add(&config->num_seats, sizeof(config->num_seats), key);
+    cache_key_add(&config->minimax, sizeof(config->minimax), key);
+    cache_key_add(&config->minimax_budget, sizeof(config->minimax_budget), key);
+    cache_key_add(&config->margins, sizeof(config->margins), key);
+    cache_key_add(&config->approximate, sizeof(config->approximate), key);
+}
+
+/*
+ * Returns the path of a file of a cache directory, allocated, or NULL
+ * if memory could not be allocated: the entry of the key with suffix
+ * appended, or the index without a key.
+ */
+static char *cache_path(const char *directory, const CacheKey *key, const char *suffix){
+    size_t length = strlen(directory) + strlen(suffix) + 64;
+    char *path = malloc(length);
+    if(!path){
+        return NULL;
+    }
+    if(key){
+        snprintf(path, length, "%s/%016" PRIx64 "%016" PRIx64 ".vsc%s",
+                 directory, key->hash[0], key->hash[1], suffix);
+    }else{
+        snprintf(path, length, "%s/index", directory);
+    }
+    return path;
+}
+
+/*
+ * Finds the latest record of a key and of this SIMULATION_VERSION in
+ * the index of a cache directory.
+ */
+static int find_record(const char *directory, const CacheKey *key, CacheRecord *record){
+    char *path = cache_path(directory, NULL, "");
+    int descriptor = path ? open(path, O_RDONLY) : -1;
+    free(path);
+    if(descriptor < 0){
+        return -1;
+    }
+    struct stat status;
+    if(fstat(descriptor, &status) || (size_t)status.st_size < sizeof(*record)){
+        close(descriptor);
+        return -1;
+    }
+    const CacheRecord *records = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if(records == MAP_FAILED){
+        return -1;
+    }
+
+    // a record cut short by a failed append is ignored
+    size_t r = status.st_size / sizeof(*records);
+    int found = -1;
+    while(r-- && found){
+        if(records[r].key.hash[0] == key->hash[0] && records[r].key.hash[1] == key->hash[1] &&
+           records[r].version == SIMULATION_VERSION){
+            *record = records[r];
+            found = 0;
+        }
+    }
+    munmap((void*)records, status.st_size);
+    return found;
+}
+
+/*
+ * Copies length bytes between streams, or every byte left if length is
+ * CACHE_NO_DATA, counting them in copied.
+ */
+static int copy_bytes(FILE *from, FILE *to, uint64_t length, uint64_t *copied){
+    char buffer[65536];
+    *copied = 0;
+    while(*copied < length){
+        size_t size = sizeof(buffer);
+        if(length - *copied < size){
+            size = length - *copied;
+        }
+        size_t read = fread(buffer, 1, size, from);
+        if(fwrite(buffer, 1, read, to) != read){
+            return -1;
+        }
+        *copied += read;
+        if(read < size){
+            return -(length != CACHE_NO_DATA || ferror(from));
+        }
+    }
+    return 0;
+}
+
+int cache_lookup(const char *directory,
+                 const CacheKey *key,
+                 FILE *data,
+                 Simulation *simulation){
+    CacheRecord record;
+    if(find_record(directory, key, &record) || (data && record.data_length == CACHE_NO_DATA)){
+        return -1;
+    }
+    char *path = cache_path(directory, key, "");
+    FILE *stream = path ? fopen(path, "rb") : NULL;
+    free(path);
+    if(!stream){
+        return -1;
+    }
+
+    // the entry is checked whole before the context is touched
+    const long state = sizeof(CACHE_MAGIC) - 1 + sizeof(record);
+    const uint64_t data_length = (record.data_length == CACHE_NO_DATA) ? 0 : record.data_length;
+    CacheRecord header;
+    char magic[sizeof(CACHE_MAGIC) - 1];
+    int status = -(checkpoint_get(magic, sizeof(magic), stream) ||
+                   memcmp(magic, CACHE_MAGIC, sizeof(magic)) ||
+                   checkpoint_get(&header, sizeof(header), stream) ||
+                   memcmp(&header, &record, sizeof(header)) ||
+                   fseek(stream, -(long)sizeof(magic), SEEK_END) ||
+                   (uint64_t)ftell(stream) != state + record.state_length + data_length ||
+                   checkpoint_get(magic, sizeof(magic), stream) ||
+                   memcmp(magic, CACHE_MAGIC, sizeof(magic)) ||
+                   fseek(stream, state, SEEK_SET));
+    if(status){
+        fclose(stream);
+        return -1;
+    }
+
+    // the state must end where the data file begins
+    uint64_t copied;
+    if(simulation_load(stream, simulation) ||
+       (uint64_t)ftell(stream) != state + record.state_length ||
+       (data && copy_bytes(stream, data, data_length, &copied))){
+        const SimulationConfig *config = simulation_config(simulation);
+        simulation_reset(config->seed, config->stream, simulation);
+        if(data){
+            fflush(data);
+            if(ftruncate(fileno(data), 0)){
+                clearerr(data);
+            }
+            rewind(data);
+        }
+        status = -1;
+    }
+    fclose(stream);
+    return status;
+}
+
+int cache_store(const char *directory,
+                const CacheKey *key,
+                const char *data_path,
+                const Simulation *simulation){
+    // an existing directory is fine, and a missing one fails below
+    mkdir(directory, 0777);
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%ld.tmp", (long)getpid());
+    char *path = cache_path(directory, key, "");
+    char *temporary = cache_path(directory, key, suffix);
+    char *index_path = cache_path(directory, NULL, "");
+    FILE *stream = (path && temporary && index_path) ? fopen(temporary, "wb") : NULL;
+    if(!stream){
+        free(path);
+        free(temporary);
+        free(index_path);
+        return -1;
+    }
+
+    CacheRecord record;
+    record.key = *key;
+    record.version = SIMULATION_VERSION;
+    record.state_length = 0;
+    record.data_length = CACHE_NO_DATA;
+    const long state = sizeof(CACHE_MAGIC) - 1 + sizeof(record);
+    int status = -(checkpoint_put(CACHE_MAGIC, sizeof(CACHE_MAGIC) - 1, stream) ||
+                   checkpoint_put(&record, sizeof(record), stream) ||
+                   simulation_save(simulation, stream));
+    record.state_length = ftell(stream) - state;
+    if(!status && data_path){
+        FILE *data = fopen(data_path, "rb");
+        status = -(!data || copy_bytes(data, stream, CACHE_NO_DATA, &record.data_length));
+        if(data){
+            fclose(data);
+        }
+    }
+    // the record is rewritten with the lengths, and the data must reach
+    // the disk before the rename does
+    if(status || checkpoint_put(CACHE_MAGIC, sizeof(CACHE_MAGIC) - 1, stream) ||
+       fseek(stream, sizeof(CACHE_MAGIC) - 1, SEEK_SET) ||
+       checkpoint_put(&record, sizeof(record), stream) ||
+       fflush(stream) || fsync(fileno(stream))){
+        status = -1;
+    }
+    if(fclose(stream)){
+        status = -1;
+    }
+    if(status || rename(temporary, path)){
+        remove(temporary);
+        status = -1;
+    }
+
+    // a single write appends the record whole
+    FILE *index = status ? NULL : fopen(index_path, "ab");
+    if(!status && (!index || fwrite(&record, sizeof(record), 1, index) != 1 ||
+                   fflush(index) || fsync(fileno(index)))){
+        status = -1;
+    }
+    if(index && fclose(index)){
+        status = -1;
+    }
+    free(path);
+    free(temporary);
+    free(index_path);
+    return status;
+}
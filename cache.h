@@ -0,0 +1,171 @@
+/*======================================================================
+ *                                cache.h
+ *======================================================================
+ * On-disk cache of the results of simulation runs.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * On-disk cache of the results of simulation runs.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "simulation.h"
+
+/**
+ * Magic bytes opening and closing a cache entry.
+ *
+ * A cache directory holds an entry per key, named by the key in
+ * hexadecimal with the extension .vsc, and an index. An entry is the 8
+ * magic bytes, then a CacheRecord, the state of the simulation context
+ * at the end of the run (see simulation_save), the election data file
+ * of the run if it wrote one, and the magic bytes again. The index is a
+ * bare array of the CacheRecord of every entry stored, appended as they
+ * are, so that it can be mapped and scanned in place. Like checkpoints,
+ * both are written in the byte order and layout of the machine.
+ */
+#define CACHE_MAGIC "VSRESULT"
+
+/**
+ * Data length of an entry without an election data file.
+ */
+#define CACHE_NO_DATA UINT64_MAX
+
+/**
+ * Key of a run, a 128-bit hash of everything its results depend on,
+ * SIMULATION_VERSION included. The hash is not cryptographic.
+ */
+typedef struct{
+    uint64_t hash[2]; /**< the two halves of the hash */
+} CacheKey;
+
+/**
+ * Description of a cache entry, in the entry and in the index.
+ */
+typedef struct{
+    CacheKey key; /**< key of the run */
+    uint64_t version; /**< SIMULATION_VERSION of the run */
+    uint64_t state_length; /**< length in bytes of the state */
+    uint64_t data_length; /**< length in bytes of the data file, or
+                               CACHE_NO_DATA */
+} CacheRecord;
+
+/**
+ * Starts a key with SIMULATION_VERSION.
+ *
+ * @param key pointer to the key
+ */
+void cache_key_init(CacheKey *key);
+
+/**
+ * Adds bytes to a key.
+ *
+ * @param data pointer to the bytes
+ * @param size number of bytes
+ * @param key pointer to the key
+ */
+void cache_key_add(const void *data, size_t size, CacheKey *key);
+
+/**
+ * Adds a run of a configuration to a key: every field its results
+ * depend on, the contents of the slate, errors, and ballots included,
+ * but not the threads or the batch size.
+ *
+ * @param config pointer to the configuration
+ * @param num_elections number of elections of the run
+ * @param key pointer to the key
+ */
+void cache_key_config(const SimulationConfig *config,
+                      unsigned long num_elections,
+                      CacheKey *key);
+
+/**
+ * Looks a run up in a cache. On a hit, the simulation context is
+ * restored to the end of the run and the data file of the run is
+ * written to data.
+ *
+ * The index is searched for the latest entry of the key and of this
+ * SIMULATION_VERSION, and the entry is checked whole before anything is
+ * restored. An entry without a data file misses when data is requested.
+ *
+ * @param directory path of the cache directory
+ * @param key pointer to the key of the run
+ * @param data stream of the empty election data file, or NULL if none
+ *             is written
+ * @param simulation pointer to the context, as created for the run
+ *
+ * @return 0 on a hit, -1 on a miss or if the entry could not be read;
+ *         the context is then as created, and data empty
+ */
+int cache_lookup(const char *directory,
+                 const CacheKey *key,
+                 FILE *data,
+                 Simulation *simulation);
+
+/**
+ * Stores a completed run in a cache, creating the directory if it does
+ * not exist. The entry is written to a temporary file, synchronized to
+ * disk, and renamed into place before it is appended to the index, so
+ * that the index only names complete entries.
+ *
+ * @param directory path of the cache directory
+ * @param key pointer to the key of the run
+ * @param data_path path of the election data file of the run, complete
+ *                  and closed, or NULL if none was written
+ * @param simulation pointer to the context at the end of the run
+ *
+ * @return 0 on success, -1 on failure
+ */
+int cache_store(const char *directory,
+                const CacheKey *key,
+                const char *data_path,
+                const Simulation *simulation);
+
+#endif
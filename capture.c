@@ -0,0 +1,615 @@
+/*======================================================================
+ *                               capture.c
+ *======================================================================
+ * Selective capture of anomalous elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Selective capture of anomalous elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "capture.h"
+#include "checkpoint.h"
+#include "confuzz.h"
+#include "election.h"
+#include "simulation.h"
+#include "summary.h"
+
+/*
+ * Finds the method whose name is the first length characters of name;
+ * returns NUM_METHODS if there is none.
+ */
+static unsigned find_method(const char *name, size_t length){
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        if(strlen(method_name(m)) == length && !strncmp(name, method_name(m), length)){
+            break;
+        }
+    }
+    return m;
+}
+
+int parse_capture(const char *list,
+                  size_t *num_predicates,
+                  CapturePredicate **predicates){
+    // one predicate per comma, plus the last
+    size_t capacity = 1;
+    const char *c;
+    for(c = list; *c; c++){
+        capacity += (*c == ',');
+    }
+    *predicates = malloc(sizeof(**predicates) * capacity);
+    if(!*predicates){
+        return -1;
+    }
+
+    *num_predicates = 0;
+    do{
+        CapturePredicate *predicate = *predicates + *num_predicates;
+        size_t length = strcspn(list, "!=<,");
+        predicate->first = find_method(list, length);
+        list += length;
+        if(!strncmp(list, "!=", 2)){
+            predicate->test = CAPTURE_DIFFER;
+            list += 2;
+        }else if(*list == '='){
+            predicate->test = CAPTURE_AGREE;
+            list++;
+        }else if(*list == '<'){
+            predicate->test = CAPTURE_LESS_APPROVED;
+            list++;
+        }else{
+            break;
+        }
+        length = strcspn(list, ",");
+        predicate->second = find_method(list, length);
+        list += length;
+        if(predicate->first == NUM_METHODS || predicate->second == NUM_METHODS ||
+           predicate->first == predicate->second){
+            break;
+        }
+        (*num_predicates)++;
+    }while(*list++);
+
+    if(*num_predicates != capacity){
+        free(*predicates);
+        *predicates = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+unsigned capture_methods(size_t num_predicates,
+                         const CapturePredicate *predicates,
+                         unsigned *candidate_statistics){
+    unsigned methods = 0;
+    size_t p;
+    for(p = 0; p < num_predicates; p++){
+        methods |= (1U << predicates[p].first) | (1U << predicates[p].second);
+        if(predicates[p].test == CAPTURE_LESS_APPROVED){
+            *candidate_statistics = 1;
+        }
+    }
+    return methods;
+}
+
+int capture_init(unsigned num_issues,
+                 size_t num_predicates,
+                 size_t reservoir_size,
+                 uint64_t seed,
+                 uint64_t stream,
+                 const CapturePredicate *predicates,
+                 Capture *capture){
+    memset(capture, 0, sizeof(*capture));
+    capture->num_predicates = num_predicates;
+    capture->predicates = predicates;
+    capture->reservoir_size = reservoir_size;
+    capture->num_issues = num_issues;
+    capture->pool_size = (size_t)1 << num_issues;
+    rand_seed(seed, stream, &capture->random);
+    if(!reservoir_size){
+        return 0;
+    }
+
+    // winners of the three listed methods are replayed at once
+    capture->slots = calloc(reservoir_size, sizeof(*capture->slots));
+    capture->hitler_table = malloc(sizeof(*capture->hitler_table) * capture->pool_size);
+    capture->elected = malloc(sizeof(*capture->elected) * 3*capture->pool_size);
+    if(!capture->slots || !capture->hitler_table || !capture->elected){
+        capture_free(capture);
+        return -1;
+    }
+    return 0;
+}
+
+void capture_free(Capture *capture){
+    size_t s;
+    for(s = 0; capture->slots && s < capture->reservoir_size; s++){
+        free(capture->slots[s].rows);
+        free(capture->slots[s].hitler_votes);
+        free(capture->slots[s].rounds);
+        free(capture->slots[s].seats);
+        free(capture->slots[s].threshold_ids);
+        free(capture->slots[s].electoral_ids);
+    }
+    free(capture->slots);
+    free(capture->hitler_table);
+    free(capture->elected);
+    capture->slots = NULL;
+    capture->hitler_table = NULL;
+    capture->elected = NULL;
+}
+
+/*
+ * Returns the first winner of a method, or NULL if it has none.
+ */
+static const Candidate *first_winner(Method method, const ElectionResult *result){
+    switch(method){
+    case METHOD_TRADITIONAL:
+        return result->num_winners ? result->elected[0] : NULL;
+    case METHOD_APPROVAL:
+        return result->num_a_winners ? result->elected_a[0] : NULL;
+    case METHOD_HITLER:
+        return result->num_h_winners ? result->elected_h[0] : NULL;
+    case METHOD_TWO_PARTY:
+        return result->status_quo;
+    case METHOD_IRV:
+        return &result->irv;
+    default:
+        return &result->washington;
+    }
+}
+
+int capture_match(const ElectionResult *result, const Capture *capture){
+    size_t p;
+    for(p = 0; p < capture->num_predicates; p++){
+        const CapturePredicate *predicate = capture->predicates + p;
+        // the pair's bit of the agreements
+        unsigned pair = method_agreements((1U << predicate->first) | (1U << predicate->second));
+        const Candidate *first, *second;
+        switch(predicate->test){
+        case CAPTURE_AGREE:
+            if(result->agreements & pair){
+                return 1;
+            }
+            break;
+        case CAPTURE_DIFFER:
+            if(!(result->agreements & pair)){
+                return 1;
+            }
+            break;
+        case CAPTURE_LESS_APPROVED:
+            first = first_winner(predicate->first, result);
+            second = first_winner(predicate->second, result);
+            if(first && second && first->sum_disapproval > second->sum_disapproval){
+                return 1;
+            }
+            break;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Returns a uniformly distributed integer in [0, ceiling), drawing
+ * 62 bits and rejecting the incomplete block at the top of the range.
+ */
+static uint64_t draw_below(uint64_t ceiling, RandomState *random){
+    uint64_t range = (uint64_t)1 << 62;
+    uint64_t limit = range - range % ceiling;
+    uint64_t draw;
+    do{
+        draw = ((uint64_t)rand_next(random) << 31) | rand_next(random);
+    }while(draw >= limit);
+    return draw % ceiling;
+}
+
+static void copy_winners(size_t num_winners,
+                         Candidate **elected,
+                         Candidate *rows){
+    size_t i;
+    for(i = 0; i < num_winners; i++){
+        rows[i] = *elected[i];
+    }
+}
+
+/*
+ * Makes room in a slot for the rows of an election, and for its rounds
+ * and committees if it has them.
+ */
+static int reserve_rows(size_t num_rows, const ElectionResult *result, CaptureSlot *slot){
+    if(num_rows > slot->max_rows){
+        Candidate *rows = realloc(slot->rows, sizeof(*rows) * num_rows);
+        if(rows){
+            slot->rows = rows;
+        }
+        unsigned *hitler_votes = realloc(slot->hitler_votes, sizeof(*hitler_votes) * num_rows);
+        if(hitler_votes){
+            slot->hitler_votes = hitler_votes;
+        }
+        // there are never more rounds than candidates
+        IrvRound *rounds = slot->rounds;
+        if(result->rounds){
+            rounds = realloc(slot->rounds, sizeof(*rounds) * num_rows);
+            if(rounds){
+                slot->rounds = rounds;
+            }
+        }
+        // nor more members than candidates
+        CommitteeSeat *seats = slot->seats;
+        if(result->chamberlin_courant){
+            seats = realloc(slot->seats, sizeof(*seats) * 2*num_rows);
+            if(seats){
+                slot->seats = seats;
+            }
+        }
+        if(!rows || !hitler_votes || (result->rounds && !rounds) ||
+           (result->chamberlin_courant && !seats)){
+            return -1;
+        }
+        slot->max_rows = num_rows;
+    }
+    slot->num_rows = num_rows;
+    return 0;
+}
+
+/*
+ * Makes room in a slot for the ids of the threshold approval or the
+ * electoral winners.
+ */
+static int reserve_ids(size_t num_ids, size_t **ids, size_t *max_ids){
+    if(num_ids > *max_ids){
+        size_t *reserved = realloc(*ids, sizeof(*reserved) * num_ids);
+        if(!reserved){
+            return -1;
+        }
+        *ids = reserved;
+        *max_ids = num_ids;
+    }
+    return 0;
+}
+
+/*
+ * Copies an election into a slot of the reservoir; the hitler votes of
+ * the candidates and winners are kept, the rest of the table is not.
+ */
+static int copy_election(unsigned num_issues, const ElectionResult *result, CaptureSlot *slot){
+    size_t num_rows = result->num_candidates + result->num_winners +
+                      result->num_a_winners + result->num_h_winners;
+    size_t num_threshold_ids = result->threshold ?
+                               threshold_num_ids(num_issues, result->threshold) : 0;
+    size_t num_electoral_ids = result->electoral ? district_num_ids(result->electoral) : 0;
+    if(reserve_rows(num_rows, result, slot) ||
+       reserve_ids(num_threshold_ids, &slot->threshold_ids, &slot->max_threshold_ids) ||
+       reserve_ids(num_electoral_ids, &slot->electoral_ids, &slot->max_electoral_ids)){
+        return -1;
+    }
+    slot->result = *result;
+
+    Candidate *rows = slot->rows;
+    memcpy(rows, result->candidates, sizeof(*rows) * result->num_candidates);
+    rows += result->num_candidates;
+    copy_winners(result->num_winners, result->elected, rows);
+    rows += result->num_winners;
+    copy_winners(result->num_a_winners, result->elected_a, rows);
+    rows += result->num_a_winners;
+    copy_winners(result->num_h_winners, result->elected_h, rows);
+
+    size_t i;
+    for(i = 0; i < num_rows; i++){
+        slot->hitler_votes[i] = result->hitler_table[slot->rows[i].id];
+    }
+    if(result->rounds){
+        memcpy(slot->rounds, result->rounds, sizeof(*slot->rounds) * result->num_rounds);
+    }
+    if(result->threshold){
+        memcpy(slot->threshold, result->threshold,
+               sizeof(*slot->threshold) * (num_issues + 1));
+        memcpy(slot->threshold_ids, result->threshold_ids,
+               sizeof(*slot->threshold_ids) * num_threshold_ids);
+    }
+    if(result->electoral){
+        memcpy(slot->electoral, result->electoral, sizeof(slot->electoral));
+        memcpy(slot->electoral_ids, result->electoral_ids,
+               sizeof(*slot->electoral_ids) * num_electoral_ids);
+    }
+    if(result->chamberlin_courant){
+        memcpy(slot->seats, result->chamberlin_courant,
+               sizeof(*slot->seats) * result->num_members);
+        memcpy(slot->seats + result->num_members, result->sequential,
+               sizeof(*slot->seats) * result->num_members);
+    }
+    if(result->minimax){
+        slot->minimax = *result->minimax;
+    }
+    if(result->margins){
+        memcpy(slot->margins, result->margins, sizeof(slot->margins));
+    }
+    if(result->approximate){
+        slot->approximate = *result->approximate;
+    }
+    return 0;
+}
+
+int capture_election(const ElectionResult *result,
+                     ElectionCallback callback,
+                     void *data,
+                     Capture *capture){
+    if(capture_match(result, capture)){
+        capture->num_captured++;
+        callback(result, data);
+        return 0;
+    }
+    if(!capture->reservoir_size){
+        return 0;
+    }
+
+    // reservoir sampling: the n-th unmatched election replaces a random
+    // slot with probability k/n
+    unsigned long n = ++capture->num_offered;
+    if(capture->num_slots < capture->reservoir_size){
+        if(copy_election(capture->num_issues, result, capture->slots + capture->num_slots)){
+            capture->num_offered--;
+            return -1;
+        }
+        capture->num_slots++;
+        return 0;
+    }
+    uint64_t s = draw_below(n, &capture->random);
+    if(s < capture->reservoir_size){
+        // a failed copy leaves the previous election of the slot intact
+        return copy_election(capture->num_issues, result, capture->slots + s);
+    }
+    return 0;
+}
+
+int capture_save(const Capture *capture, FILE *stream){
+    if(checkpoint_put(&capture->reservoir_size, sizeof(capture->reservoir_size), stream) ||
+       checkpoint_put(&capture->num_slots, sizeof(capture->num_slots), stream) ||
+       checkpoint_put(&capture->num_offered, sizeof(capture->num_offered), stream) ||
+       checkpoint_put(&capture->num_captured, sizeof(capture->num_captured), stream) ||
+       checkpoint_put(&capture->random, sizeof(capture->random), stream)){
+        return -1;
+    }
+    size_t s;
+    for(s = 0; s < capture->num_slots; s++){
+        const CaptureSlot *slot = capture->slots + s;
+        const ElectionResult *result = &slot->result;
+        // the pointers of the result are only saved to tell which of
+        // the optional outputs it has
+        if(checkpoint_put(result, sizeof(*result), stream) ||
+           checkpoint_put(&slot->num_rows, sizeof(slot->num_rows), stream) ||
+           checkpoint_put(slot->rows, sizeof(*slot->rows) * slot->num_rows, stream) ||
+           checkpoint_put(slot->hitler_votes, sizeof(*slot->hitler_votes) * slot->num_rows,
+                          stream) ||
+           (result->rounds &&
+            checkpoint_put(slot->rounds, sizeof(*slot->rounds) * result->num_rounds, stream)) ||
+           (result->threshold &&
+            (checkpoint_put(slot->threshold, sizeof(*slot->threshold) * (capture->num_issues + 1),
+                            stream) ||
+             checkpoint_put(slot->threshold_ids, sizeof(*slot->threshold_ids) *
+                            threshold_num_ids(capture->num_issues, slot->threshold), stream))) ||
+           (result->electoral &&
+            (checkpoint_put(slot->electoral, sizeof(slot->electoral), stream) ||
+             checkpoint_put(slot->electoral_ids, sizeof(*slot->electoral_ids) *
+                            district_num_ids(slot->electoral), stream))) ||
+           (result->chamberlin_courant &&
+            checkpoint_put(slot->seats, sizeof(*slot->seats) * 2*result->num_members, stream)) ||
+           (result->minimax &&
+            checkpoint_put(&slot->minimax, sizeof(slot->minimax), stream)) ||
+           (result->margins &&
+            checkpoint_put(slot->margins, sizeof(slot->margins), stream)) ||
+           (result->approximate &&
+            checkpoint_put(&slot->approximate, sizeof(slot->approximate), stream))){
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Reads the ids of the threshold approval winners of a slot whose
+ * winners were read; each radius has at most every candidate.
+ */
+static int load_threshold_ids(unsigned num_issues,
+                              size_t num_candidates,
+                              CaptureSlot *slot,
+                              FILE *stream){
+    unsigned r;
+    for(r = 0; r <= num_issues; r++){
+        if(slot->threshold[r].num_winners > num_candidates){
+            return -1;
+        }
+    }
+    size_t num_ids = threshold_num_ids(num_issues, slot->threshold);
+    return -(reserve_ids(num_ids, &slot->threshold_ids, &slot->max_threshold_ids) ||
+             checkpoint_get(slot->threshold_ids, sizeof(*slot->threshold_ids) * num_ids, stream));
+}
+
+/*
+ * Reads the ids of the electoral winners of a slot whose winners were
+ * read; each method has at most every platform.
+ */
+static int load_electoral_ids(size_t pool_size, CaptureSlot *slot, FILE *stream){
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        if(slot->electoral[m].num_winners > pool_size){
+            return -1;
+        }
+    }
+    size_t num_ids = district_num_ids(slot->electoral);
+    return -(reserve_ids(num_ids, &slot->electoral_ids, &slot->max_electoral_ids) ||
+             checkpoint_get(slot->electoral_ids, sizeof(*slot->electoral_ids) * num_ids, stream));
+}
+
+int capture_load(FILE *stream, Capture *capture){
+    size_t reservoir_size, num_slots;
+    if(checkpoint_get(&reservoir_size, sizeof(reservoir_size), stream) ||
+       checkpoint_get(&num_slots, sizeof(num_slots), stream) ||
+       reservoir_size != capture->reservoir_size || num_slots > reservoir_size ||
+       checkpoint_get(&capture->num_offered, sizeof(capture->num_offered), stream) ||
+       checkpoint_get(&capture->num_captured, sizeof(capture->num_captured), stream) ||
+       checkpoint_get(&capture->random, sizeof(capture->random), stream)){
+        return -1;
+    }
+    for(capture->num_slots = 0; capture->num_slots < num_slots; capture->num_slots++){
+        CaptureSlot *slot = capture->slots + capture->num_slots;
+        ElectionResult *result = &slot->result;
+        size_t num_rows;
+        if(checkpoint_get(result, sizeof(*result), stream) ||
+           checkpoint_get(&num_rows, sizeof(num_rows), stream) ||
+           num_rows != result->num_candidates + result->num_winners +
+                       result->num_a_winners + result->num_h_winners ||
+           result->num_candidates > capture->pool_size ||
+           (result->rounds && result->num_rounds > num_rows) ||
+           (result->chamberlin_courant && result->num_members > num_rows) ||
+           reserve_rows(num_rows, result, slot) ||
+           checkpoint_get(slot->rows, sizeof(*slot->rows) * num_rows, stream) ||
+           checkpoint_get(slot->hitler_votes, sizeof(*slot->hitler_votes) * num_rows, stream) ||
+           (result->rounds &&
+            checkpoint_get(slot->rounds, sizeof(*slot->rounds) * result->num_rounds, stream)) ||
+           (result->threshold &&
+            (checkpoint_get(slot->threshold, sizeof(*slot->threshold) * (capture->num_issues + 1),
+                            stream) ||
+             load_threshold_ids(capture->num_issues, result->num_candidates, slot, stream))) ||
+           (result->electoral &&
+            (checkpoint_get(slot->electoral, sizeof(slot->electoral), stream) ||
+             load_electoral_ids(capture->pool_size, slot, stream))) ||
+           (result->chamberlin_courant &&
+            checkpoint_get(slot->seats, sizeof(*slot->seats) * 2*result->num_members, stream)) ||
+           (result->minimax &&
+            checkpoint_get(&slot->minimax, sizeof(slot->minimax), stream)) ||
+           (result->margins &&
+            checkpoint_get(slot->margins, sizeof(slot->margins), stream)) ||
+           (result->approximate &&
+            checkpoint_get(&slot->approximate, sizeof(slot->approximate), stream))){
+            return -1;
+        }
+        // capture_finish points the arrays back into the slot
+        size_t r;
+        for(r = 0; r < num_rows; r++){
+            if(slot->rows[r].id >= capture->pool_size){
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int sort_slots(const void *a, const void *b){
+    unsigned long election_a = ((const CaptureSlot*)a)->result.election;
+    unsigned long election_b = ((const CaptureSlot*)b)->result.election;
+    return (election_a > election_b) - (election_a < election_b);
+}
+
+/*
+ * Restores the hitler votes of rows, and points the winners of one
+ * method at them unless elected is NULL.
+ */
+static void restore_rows(size_t num_rows,
+                         const unsigned *hitler_votes,
+                         unsigned *hitler_table,
+                         Candidate *rows,
+                         Candidate **elected){
+    size_t i;
+    for(i = 0; i < num_rows; i++){
+        hitler_table[rows[i].id] = hitler_votes[i];
+        if(elected){
+            elected[i] = rows+i;
+        }
+    }
+}
+
+void capture_finish(ElectionCallback callback, void *data, Capture *capture){
+    qsort(capture->slots, capture->num_slots, sizeof(*capture->slots), sort_slots);
+
+    size_t s;
+    for(s = 0; s < capture->num_slots; s++){
+        CaptureSlot *slot = capture->slots + s;
+        ElectionResult *result = &slot->result;
+        Candidate *rows = slot->rows;
+        const unsigned *hitler_votes = slot->hitler_votes;
+
+        result->hitler_table = capture->hitler_table;
+        result->candidates = rows;
+        result->rounds = result->rounds ? slot->rounds : NULL;
+        result->threshold = result->threshold ? slot->threshold : NULL;
+        result->threshold_ids = result->threshold ? slot->threshold_ids : NULL;
+        result->electoral = result->electoral ? slot->electoral : NULL;
+        result->electoral_ids = result->electoral ? slot->electoral_ids : NULL;
+        result->minimax = result->minimax ? &slot->minimax : NULL;
+        result->margins = result->margins ? slot->margins : NULL;
+        result->approximate = result->approximate ? &slot->approximate : NULL;
+        if(result->chamberlin_courant){
+            result->chamberlin_courant = slot->seats;
+            result->sequential = slot->seats + result->num_members;
+        }
+        restore_rows(result->num_candidates, hitler_votes, capture->hitler_table,
+                     rows, NULL);
+        rows += result->num_candidates;
+        hitler_votes += result->num_candidates;
+
+        result->elected = capture->elected;
+        restore_rows(result->num_winners, hitler_votes, capture->hitler_table,
+                     rows, result->elected);
+        rows += result->num_winners;
+        hitler_votes += result->num_winners;
+
+        result->elected_a = result->elected + result->num_winners;
+        restore_rows(result->num_a_winners, hitler_votes, capture->hitler_table,
+                     rows, result->elected_a);
+        rows += result->num_a_winners;
+        hitler_votes += result->num_a_winners;
+
+        result->elected_h = result->elected_a + result->num_a_winners;
+        restore_rows(result->num_h_winners, hitler_votes, capture->hitler_table,
+                     rows, result->elected_h);
+
+        callback(result, data);
+    }
+}
@@ -0,0 +1,268 @@
+/*======================================================================
+ *                               capture.h
+ *======================================================================
+ * Selective capture of anomalous elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Selective capture of anomalous elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "confuzz.h"
+#include "election.h"
+#include "simulation.h"
+
+/**
+ * Tests a capture predicate makes between the winners of two methods.
+ */
+typedef enum{
+    CAPTURE_AGREE, /**< the winners share a candidate ("first=second") */
+    CAPTURE_DIFFER, /**< the winners share no candidate
+                         ("first!=second") */
+    CAPTURE_LESS_APPROVED /**< the first winner of the first method has
+                               a greater sum of disapprovals than that
+                               of the second ("first<second") */
+} CaptureTest;
+
+/**
+ * A predicate on the result of an election.
+ */
+typedef struct{
+    CaptureTest test; /**< test between the two methods */
+    Method first; /**< first method */
+    Method second; /**< second method */
+} CapturePredicate;
+
+/**
+ * An election kept in the reservoir, copied out of the buffers of the
+ * simulation context.
+ */
+typedef struct{
+    ElectionResult result; /**< the election; its arrays point into the
+                                buffers below */
+    size_t num_rows; /**< number of candidates and winners held */
+    size_t max_rows; /**< capacity of the buffers */
+    Candidate *rows; /**< candidates, then the traditional, approval,
+                          and hitler election winners */
+    unsigned *hitler_votes; /**< hitler votes of each row */
+    IrvRound *rounds; /**< instant-runoff rounds, max_rows long, or NULL
+                           if the method is not decided */
+    ThresholdWinner threshold[KERNEL_MAX_ISSUES + 1]; /**< threshold
+                                                           approval winners,
+                                                           if decided */
+    size_t max_threshold_ids; /**< capacity of threshold_ids */
+    size_t *threshold_ids; /**< ids of the threshold approval winners of
+                                every radius in turn, if decided */
+    ElectoralWinner electoral[NUM_METHODS]; /**< electoral winners, if
+                                                 decided by districts */
+    size_t max_electoral_ids; /**< capacity of electoral_ids */
+    size_t *electoral_ids; /**< ids of the electoral winners of every
+                                method in turn, if decided by districts */
+    CommitteeSeat *seats; /**< Chamberlin-Courant then sequential
+                               approval members, if chosen */
+    MinimaxPlatform minimax; /**< minimax platform, if searched */
+    unsigned margins[NUM_METHODS]; /**< margins of victory, if computed */
+    ApproximateReport approximate; /**< bounds of the approximate
+                                        approval election, if
+                                        approximated */
+} CaptureSlot;
+
+/**
+ * Selects the elections whose results are formatted: those matching any
+ * predicate, plus a uniform sample of the others.
+ *
+ * Predicates are evaluated on the agreements and the winners the
+ * simulation already decided, so unselected elections cost no more
+ * than a few comparisons; only the reservoir copies an election, and a
+ * reservoir of k slots out of n elections makes about k*ln(n/k)
+ * copies.
+ */
+typedef struct{
+    size_t num_predicates; /**< number of predicates */
+    const CapturePredicate *predicates; /**< the predicates */
+    size_t reservoir_size; /**< number of slots of the reservoir */
+    size_t num_slots; /**< number of slots filled */
+    unsigned long num_offered; /**< unmatched elections offered to the
+                                    reservoir */
+    unsigned long num_captured; /**< elections matching a predicate */
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    RandomState random; /**< generator of the reservoir */
+    CaptureSlot *slots; /**< slots of the reservoir */
+    unsigned *hitler_table; /**< hitler table rebuilt for a replay */
+    Candidate **elected; /**< winner pointers rebuilt for a replay */
+} Capture;
+
+/**
+ * Parses a comma-separated list of capture predicates such as
+ * "traditional!=approval,two_party<washington,hitler=traditional".
+ *
+ * @param list the list of predicates
+ * @param num_predicates pointer to the variable to hold the number of
+ *                       predicates
+ * @param predicates pointer to the variable to hold the allocated array
+ *                   of predicates
+ *
+ * @return 0 on success, -1 if the list is malformed or memory could not
+ *         be allocated
+ */
+int parse_capture(const char *list,
+                  size_t *num_predicates,
+                  CapturePredicate **predicates);
+
+/**
+ * Returns the election methods a list of predicates compares.
+ *
+ * @param num_predicates number of predicates
+ * @param predicates array of predicates
+ * @param candidate_statistics pointer to a variable set to 1 if a
+ *                             predicate compares sums of disapprovals,
+ *                             which the simulation must then compute
+ *                             for every candidate; left as is otherwise
+ *
+ * @return set of election methods (see Method)
+ */
+unsigned capture_methods(size_t num_predicates,
+                         const CapturePredicate *predicates,
+                         unsigned *candidate_statistics);
+
+/**
+ * Initializes a Capture structure.
+ *
+ * @param num_issues number of issues in the election
+ * @param num_predicates number of predicates
+ * @param reservoir_size number of unmatched elections to sample
+ * @param seed seed of the generator of the reservoir
+ * @param stream stream of the generator of the reservoir
+ * @param predicates array of predicates; not copied
+ * @param capture pointer to the capture
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int capture_init(unsigned num_issues,
+                 size_t num_predicates,
+                 size_t reservoir_size,
+                 uint64_t seed,
+                 uint64_t stream,
+                 const CapturePredicate *predicates,
+                 Capture *capture);
+
+/**
+ * Releases the memory held by a Capture structure.
+ *
+ * @param capture pointer to the capture
+ */
+void capture_free(Capture *capture);
+
+/**
+ * Determines whether an election matches any predicate.
+ *
+ * @param result pointer to the result of the election
+ * @param capture pointer to the capture
+ *
+ * @return 1 if the election matches, 0 otherwise
+ */
+int capture_match(const ElectionResult *result, const Capture *capture);
+
+/**
+ * Passes an election matching a predicate straight to a callback, and
+ * offers any other election to the reservoir.
+ *
+ * @param result pointer to the result of the election
+ * @param callback function called with a matching election
+ * @param data pointer passed through to the callback
+ * @param capture pointer to the capture
+ *
+ * @return 0 on success, -1 if memory for the reservoir could not be
+ *         allocated; the election is then not sampled
+ */
+int capture_election(const ElectionResult *result,
+                     ElectionCallback callback,
+                     void *data,
+                     Capture *capture);
+
+/**
+ * Saves the progress of a capture to a checkpoint: its counts, the
+ * generator of the reservoir, and the elections sampled so far.
+ *
+ * @param capture pointer to the capture
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the write failed
+ *
+ * @sa checkpoint_begin
+ */
+int capture_save(const Capture *capture, FILE *stream);
+
+/**
+ * Restores the progress of a capture saved by capture_save.
+ *
+ * @param stream stream of the checkpoint
+ * @param capture pointer to a capture initialized as the saved one was
+ *
+ * @return 0 on success, -1 if the checkpoint ended first or does not
+ *         fit the capture, or memory for the reservoir could not be
+ *         allocated
+ */
+int capture_load(FILE *stream, Capture *capture);
+
+/**
+ * Passes the elections sampled in the reservoir to a callback, in the
+ * order they were run; no further election may be offered.
+ *
+ * @param callback function called with each sampled election
+ * @param data pointer passed through to the callback
+ * @param capture pointer to the capture
+ */
+void capture_finish(ElectionCallback callback, void *data, Capture *capture);
+
+#endif
@@ -0,0 +1,237 @@
+/*======================================================================
+ *                              CHECKPOINT
+ *======================================================================
+ * Checkpoints of long election runs, written atomically.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Checkpoints of long election runs, written atomically.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "checkpoint.h"
+
+/*
+ * Returns the path of the temporary file of a checkpoint, allocated,
+ * or NULL if memory could not be allocated.
+ */
+static char *temporary_path(const char *path){
+    size_t length = strlen(path);
+    char *temporary = malloc(length + sizeof(".tmp"));
+    if(temporary){
+        memcpy(temporary, path, length);
+        memcpy(temporary + length, ".tmp", sizeof(".tmp"));
+    }
+    return temporary;
+}
+
+/* Writes a string, NULL included, as its length plus one and its bytes. */
+static int put_string(const char *string, FILE *stream){
+    uint64_t length = string ? strlen(string) + 1 : 0;
+    return -(checkpoint_put(&length, sizeof(length), stream) ||
+             checkpoint_put(string, length ? length - 1 : 0, stream));
+}
+
+/* Reads a string written by put_string into allocated memory. */
+static int get_string(char **string, FILE *stream){
+    uint64_t length;
+    *string = NULL;
+    if(checkpoint_get(&length, sizeof(length), stream)){
+        return -1;
+    }
+    if(!length){
+        return 0;
+    }
+    // no argument or path is anywhere near this long
+    if(length > 65536 || !(*string = malloc(length))){
+        return -1;
+    }
+    (*string)[length - 1] = 0;
+    return checkpoint_get(*string, length - 1, stream);
+}
+
+int checkpoint_begin(const char *path, const CheckpointRun *run, FILE **stream){
+    char *temporary = temporary_path(path);
+    *stream = temporary ? fopen(temporary, "wb") : NULL;
+    free(temporary);
+    if(!*stream){
+        return -1;
+    }
+
+    unsigned version = CHECKPOINT_VERSION;
+    int status = -(checkpoint_put(CHECKPOINT_MAGIC, 8, *stream) ||
+                   checkpoint_put(&version, sizeof(version), *stream) ||
+                   checkpoint_put(&run->argc, sizeof(run->argc), *stream));
+    int a;
+    for(a = 0; !status && a < run->argc; a++){
+        status = put_string(run->argv[a], *stream);
+    }
+    if(status ||
+       checkpoint_put(&run->verbose, sizeof(run->verbose), *stream) ||
+       put_string(run->data_path, *stream) ||
+       checkpoint_put(&run->num_issues, sizeof(run->num_issues), *stream) ||
+       checkpoint_put(&run->population_size, sizeof(run->population_size), *stream) ||
+       checkpoint_put(&run->num_elections, sizeof(run->num_elections), *stream) ||
+       checkpoint_put(&run->seed, sizeof(run->seed), *stream) ||
+       checkpoint_put(&run->num_run, sizeof(run->num_run), *stream) ||
+       checkpoint_put(&run->data_length, sizeof(run->data_length), *stream)){
+        checkpoint_finish(path, -1, *stream);
+        return -1;
+    }
+    return 0;
+}
+
+int checkpoint_finish(const char *path, int status, FILE *stream){
+    char *temporary = temporary_path(path);
+    // the data must reach the disk before the rename does, or a crash
+    // could leave path naming an empty file
+    if(status || !temporary || checkpoint_put(CHECKPOINT_MAGIC, 8, stream) ||
+       fflush(stream) || fsync(fileno(stream))){
+        status = -1;
+    }
+    if(fclose(stream)){
+        status = -1;
+    }
+    if(temporary){
+        if(status){
+            remove(temporary);
+        }else if(rename(temporary, path)){
+            remove(temporary);
+            status = -1;
+        }
+    }
+    free(temporary);
+    return status;
+}
+
+int checkpoint_open(const char *path, CheckpointRun *run, FILE **stream){
+    memset(run, 0, sizeof(*run));
+    *stream = fopen(path, "rb");
+    if(!*stream){
+        return -1;
+    }
+
+    char magic[8];
+    unsigned version;
+    int status = -(checkpoint_get(magic, sizeof(magic), *stream) ||
+                   memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) ||
+                   checkpoint_get(&version, sizeof(version), *stream) ||
+                   version != CHECKPOINT_VERSION ||
+                   checkpoint_get(&run->argc, sizeof(run->argc), *stream) ||
+                   run->argc < 1 || run->argc > 4096 ||
+                   !(run->argv = calloc(run->argc + 1, sizeof(*run->argv))));
+    int a;
+    for(a = 0; !status && a < run->argc; a++){
+        status = get_string(run->argv + a, *stream);
+        if(!status && !run->argv[a]){
+            status = -1;
+        }
+    }
+    if(status ||
+       checkpoint_get(&run->verbose, sizeof(run->verbose), *stream) ||
+       get_string(&run->data_path, *stream) ||
+       checkpoint_get(&run->num_issues, sizeof(run->num_issues), *stream) ||
+       checkpoint_get(&run->population_size, sizeof(run->population_size), *stream) ||
+       checkpoint_get(&run->num_elections, sizeof(run->num_elections), *stream) ||
+       checkpoint_get(&run->seed, sizeof(run->seed), *stream) ||
+       checkpoint_get(&run->num_run, sizeof(run->num_run), *stream) ||
+       checkpoint_get(&run->data_length, sizeof(run->data_length), *stream) ||
+       run->num_run >= run->num_elections){
+        fclose(*stream);
+        *stream = NULL;
+        checkpoint_free_run(run);
+        return -1;
+    }
+    return 0;
+}
+
+int checkpoint_close(FILE *stream){
+    char magic[8];
+    int status = -(checkpoint_get(magic, sizeof(magic), stream) ||
+                   memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) ||
+                   fgetc(stream) != EOF);
+    fclose(stream);
+    return status;
+}
+
+void checkpoint_free_run(CheckpointRun *run){
+    int a;
+    for(a = 0; run->argv && a < run->argc; a++){
+        free(run->argv[a]);
+    }
+    free(run->argv);
+    free(run->data_path);
+    memset(run, 0, sizeof(*run));
+}
+
+FILE *checkpoint_reopen(const char *path, uint64_t length){
+    FILE *stream = fopen(path, "r+");
+    if(!stream){
+        return NULL;
+    }
+    // records written after the checkpoint are written again
+    struct stat status;
+    if(fstat(fileno(stream), &status) || (uint64_t)status.st_size < length ||
+       ftruncate(fileno(stream), length) || fseeko(stream, length, SEEK_SET)){
+        fclose(stream);
+        return NULL;
+    }
+    return stream;
+}
+
+int checkpoint_put(const void *data, size_t size, FILE *stream){
+    return -(size && fwrite(data, size, 1, stream) != 1);
+}
+
+int checkpoint_get(void *data, size_t size, FILE *stream){
+    return -(size && fread(data, size, 1, stream) != 1);
+}
@@ -0,0 +1,188 @@
+/*======================================================================
+ *                              CHECKPOINT
+ *======================================================================
+ * Checkpoints of long election runs, written atomically.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Checkpoints of long election runs, written atomically.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Magic bytes opening a checkpoint file.
+ *
+ * A checkpoint file is the 8 magic bytes, CHECKPOINT_VERSION, the run
+ * (see CheckpointRun), the states the run saved in order, and the magic
+ * bytes again. The states are written in the byte order and layout of
+ * the machine, so a checkpoint is only resumed by the same build.
+ */
+#define CHECKPOINT_MAGIC "VSCHECKP"
+
+/**
+ * Version of the layout of checkpoint files.
+ */
+#define CHECKPOINT_VERSION 3
+
+/**
+ * Description of a run: enough to start it again and to tell how far it
+ * went.
+ */
+typedef struct{
+    int argc; /**< number of command-line arguments of the run */
+    char **argv; /**< command-line arguments of the run */
+    unsigned verbose; /**< whether election statistics are printed */
+    char *data_path; /**< path of the election data file, or NULL */
+    unsigned num_issues; /**< number of issues */
+    unsigned population_size; /**< number of voters */
+    unsigned long num_elections; /**< number of elections of the run */
+    uint64_t seed; /**< seed of the pseudo-random number generator */
+    unsigned long num_run; /**< number of elections run at the
+                                checkpoint */
+    uint64_t data_length; /**< length in bytes of the data file at the
+                               checkpoint */
+} CheckpointRun;
+
+/**
+ * Begins a checkpoint: opens a temporary file beside path and writes
+ * the run to it. The caller then saves its states to the stream and
+ * completes the checkpoint with checkpoint_finish.
+ *
+ * @param path path of the checkpoint
+ * @param run pointer to the run
+ * @param stream pointer to the variable to hold the stream of the
+ *               temporary file
+ *
+ * @return 0 on success, -1 if the file could not be created or written
+ */
+int checkpoint_begin(const char *path, const CheckpointRun *run, FILE **stream);
+
+/**
+ * Completes a checkpoint begun by checkpoint_begin. If status is 0 and
+ * every write succeeded, the temporary file is synchronized to disk and
+ * renamed over path, so that path always holds a complete checkpoint;
+ * otherwise it is removed and path is left as it was.
+ *
+ * @param path path of the checkpoint
+ * @param status 0 if every state was saved, -1 otherwise
+ * @param stream stream returned by checkpoint_begin; closed
+ *
+ * @return 0 on success, -1 if the checkpoint was not written
+ */
+int checkpoint_finish(const char *path, int status, FILE *stream);
+
+/**
+ * Opens a checkpoint and reads its run. The caller then loads its
+ * states from the stream in the order they were saved and closes it
+ * with checkpoint_close.
+ *
+ * @param path path of the checkpoint
+ * @param run pointer to the run; release it with checkpoint_free_run
+ * @param stream pointer to the variable to hold the stream
+ *
+ * @return 0 on success, -1 if the file cannot be read, is not a
+ *         checkpoint of this version, or memory could not be allocated
+ */
+int checkpoint_open(const char *path, CheckpointRun *run, FILE **stream);
+
+/**
+ * Closes a checkpoint opened by checkpoint_open, checking that every
+ * state was read.
+ *
+ * @param stream stream returned by checkpoint_open; closed
+ *
+ * @return 0 on success, -1 if the states did not end where the
+ *         checkpoint does
+ */
+int checkpoint_close(FILE *stream);
+
+/**
+ * Releases the memory held by a run read by checkpoint_open.
+ *
+ * @param run pointer to the run
+ */
+void checkpoint_free_run(CheckpointRun *run);
+
+/**
+ * Reopens an election data file as it was at a checkpoint: truncated to
+ * the length it had then, and positioned at its end.
+ *
+ * @param path path of the data file
+ * @param length length of the data file at the checkpoint
+ *
+ * @return the stream, or NULL if the file cannot be opened or is
+ *         shorter than length
+ */
+FILE *checkpoint_reopen(const char *path, uint64_t length);
+
+/**
+ * Writes bytes of a state to a checkpoint.
+ *
+ * @param data pointer to the bytes
+ * @param size number of bytes; may be 0
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the write failed
+ */
+int checkpoint_put(const void *data, size_t size, FILE *stream);
+
+/**
+ * Reads bytes of a state from a checkpoint.
+ *
+ * @param data pointer to the bytes
+ * @param size number of bytes; may be 0
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the checkpoint ended first
+ */
+int checkpoint_get(void *data, size_t size, FILE *stream);
+
+#endif
@@ -0,0 +1,265 @@
+/*======================================================================
+ *                               client.c
+ *======================================================================
+ * Command-line client of the VoteSim simulation daemon.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Command-line client of the VoteSim simulation daemon.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * Prints the command-line usage of the client to stderr.
+ *
+ * @param program name of the program
+ */
+void print_usage(const char *program){
+    fprintf(stderr, "Usage: %s [OPTION]... SOCKET [REQUEST]...\n"
+                    "\n"
+                    "Sends each REQUEST (or each line of standard input) to the\n"
+                    "VoteSim daemon listening on SOCKET and prints the responses.\n"
+                    "\n"
+                    "  --repeat=N  send every request N times (default: 1)\n"
+                    "  --quiet     print only the latency percentiles\n"
+                    "  --help      display this help and exit\n", program);
+}
+
+/**
+ * Compares latencies; for use in the standard C library qsort function.
+ *
+ * @param a latency for comparison
+ * @param b latency for comparison
+ *
+ * @return the relative sorting of the two latencies
+ */
+int compare_latencies(const void *a, const void *b){
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Sends a request and copies its response up to the closing done or
+ * error line.
+ *
+ * @param quiet discard the response instead of printing it
+ * @param request the request line, without a line ending
+ * @param line pointer to the line buffer
+ * @param line_size pointer to the size of the line buffer
+ * @param in stream of responses
+ * @param out stream of requests
+ *
+ * @return 0 on success, -1 if the daemon hung up
+ */
+int send_request(unsigned quiet,
+                 const char *request,
+                 char **line,
+                 size_t *line_size,
+                 FILE *in,
+                 FILE *out){
+    fprintf(out, "%s\n", request);
+    if(fflush(out)){
+        return -1;
+    }
+    while(getline(line, line_size, in) > 0){
+        if(!quiet){
+            fputs(*line, stdout);
+        }
+        if(!strncmp(*line, "done", 4) || !strncmp(*line, "error", 5)){
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Main function of the client.
+ */
+int main(int argc, char **argv){
+    unsigned long repeat = 1;
+    unsigned quiet = 0;
+    int i;
+    for(i = 1; i < argc && !strncmp(argv[i], "--", 2); i++){
+        char *check;
+        if(!strncmp(argv[i], "--repeat=", 9)){
+            repeat = strtoul(argv[i]+9, &check, 0);
+            if(*check || !repeat){
+                print_usage(argv[0]);
+                exit(1);
+            }
+        }else if(!strcmp(argv[i], "--quiet")){
+            quiet = 1;
+        }else{
+            print_usage(argv[0]);
+            exit(strcmp(argv[i], "--help") != 0);
+        }
+    }
+    if(i == argc){
+        print_usage(argv[0]);
+        exit(1);
+    }
+    const char *socket_path = argv[i++];
+
+    struct sockaddr_un address;
+    if(strlen(socket_path) >= sizeof(address.sun_path)){
+        fprintf(stderr, "\n** ERROR: Socket path is too long\n");
+        exit(1);
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0 || connect(fd, (struct sockaddr*)&address, sizeof(address))){
+        fprintf(stderr, "\n** ERROR: Unable to connect to %s\n", socket_path);
+        exit(1);
+    }
+    FILE *in = fdopen(fd, "r");
+    FILE *out = fdopen(dup(fd), "w");
+    if(!in || !out){
+        fprintf(stderr, "\n** ERROR: Unable to open the connection streams\n");
+        exit(1);
+    }
+
+    // requests come from the command line, else from standard input
+    char **requests = argv + i;
+    size_t num_requests = argc - i;
+    char **input = NULL;
+    if(!num_requests){
+        char *line = NULL;
+        size_t line_size = 0;
+        size_t capacity = 0;
+        ssize_t length;
+        while((length = getline(&line, &line_size, stdin)) > 0){
+            while(length && (line[length-1] == '\n' || line[length-1] == '\r')){
+                line[--length] = 0;
+            }
+            if(!length){
+                continue;
+            }
+            if(num_requests == capacity){
+                capacity = capacity ? 2*capacity : 16;
+                char **grown = realloc(input, sizeof(*input) * capacity);
+                if(!grown){
+                    fprintf(stderr, "\n** ERROR: Not enough memory to read the requests\n");
+                    exit(1);
+                }
+                input = grown;
+            }
+            input[num_requests] = malloc(length + 1);
+            if(!input[num_requests]){
+                fprintf(stderr, "\n** ERROR: Not enough memory to read the requests\n");
+                exit(1);
+            }
+            memcpy(input[num_requests++], line, length + 1);
+        }
+        free(line);
+        requests = input;
+    }
+
+    double *latencies = malloc(sizeof(*latencies) * (num_requests*repeat + 1));
+    if(!latencies){
+        fprintf(stderr, "\n** ERROR: Not enough memory to record latencies\n");
+        exit(1);
+    }
+
+    char *line = NULL;
+    size_t line_size = 0;
+    size_t num_latencies = 0;
+    unsigned long r;
+    for(r = 0; r < repeat; r++){
+        size_t q;
+        for(q = 0; q < num_requests; q++){
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            if(send_request(quiet, requests[q], &line, &line_size, in, out)){
+                fprintf(stderr, "\n** ERROR: The daemon closed the connection\n");
+                exit(1);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            latencies[num_latencies++] = (end.tv_sec - start.tv_sec)*1e6 +
+                                         (end.tv_nsec - start.tv_nsec)/1e3;
+        }
+    }
+
+    // round-trip latency percentiles, nearest rank
+    if(num_latencies){
+        qsort(latencies, num_latencies, sizeof(*latencies), compare_latencies);
+        const double percentiles[] = {0.5, 0.9, 0.99, 0.999};
+        fprintf(stderr, "latency requests=%zu", num_latencies);
+        size_t p;
+        for(p = 0; p < sizeof(percentiles)/sizeof(*percentiles); p++){
+            size_t rank = percentiles[p]*num_latencies;
+            if(rank < percentiles[p]*num_latencies){
+                rank++;
+            }
+            fprintf(stderr, " p%g=%.0f", percentiles[p]*100, latencies[rank ? rank-1 : 0]);
+        }
+        fprintf(stderr, " max=%.0f\n", latencies[num_latencies-1]);
+    }
+
+    free(line);
+    free(latencies);
+    if(input){
+        size_t q;
+        for(q = 0; q < num_requests; q++){
+            free(input[q]);
+        }
+        free(input);
+    }
+    fclose(in);
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,397 @@
+/*======================================================================
+ *                              committee.c
+ *======================================================================
+ * Multi-winner committees chosen greedily over the voter groups.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Multi-winner committees chosen greedily over the voter groups.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "committee.h"
+#include "election.h"
+
+int committee_init(unsigned num_issues, size_t num_seats, CommitteeEngine *engine){
+    memset(engine, 0, sizeof(*engine));
+    engine->num_issues = num_issues;
+    engine->pool_size = (size_t)1 << num_issues;
+    engine->num_seats = num_seats;
+    // clearing and filling the layers, then one addition per platform
+    // for each distance still reachable after each issue
+    engine->transform_cost = engine->pool_size *
+                             ((num_issues + 1) + num_issues*(num_issues + 1)/2);
+    size_t pool_size = engine->pool_size;
+    engine->ids = malloc(sizeof(*engine->ids) * pool_size);
+    engine->seated = malloc(sizeof(*engine->seated) * pool_size);
+    engine->gains = malloc(sizeof(*engine->gains) * pool_size);
+    engine->approvals = malloc(sizeof(*engine->approvals) * pool_size);
+    engine->closest = malloc(sizeof(*engine->closest) * pool_size);
+    engine->approved = malloc(sizeof(*engine->approved) * pool_size);
+    engine->layers = malloc(sizeof(*engine->layers) * pool_size * (num_issues + 1));
+    if(!engine->ids || !engine->seated || !engine->gains || !engine->approvals ||
+       !engine->closest || !engine->approved || !engine->layers){
+        committee_free(engine);
+        return -1;
+    }
+    return 0;
+}
+
+void committee_free(CommitteeEngine *engine){
+    free(engine->ids);
+    free(engine->seated);
+    free(engine->gains);
+    free(engine->approvals);
+    free(engine->closest);
+    free(engine->approved);
+    free(engine->layers);
+    memset(engine, 0, sizeof(*engine));
+}
+
+/*
+ * Hamming weight of a platform difference, in arithmetic rather than a
+ * table lookup so that loops over the candidates vectorize; platforms
+ * have at most 15 issues.
+ */
+static unsigned distance(unsigned difference){
+    difference = difference - ((difference >> 1) & 0x5555);
+    difference = (difference & 0x3333) + ((difference >> 2) & 0x3333);
+    difference = (difference + (difference >> 4)) & 0x0f0f;
+    return (difference + (difference >> 8)) & 0x1f;
+}
+
+/*
+ * Returns the unseated candidate of the largest gain, the one of lowest
+ * index on a tie.
+ */
+static size_t best_unseated(size_t num_candidates,
+                            const unsigned *seated,
+                            const unsigned *gains,
+                            const double *approvals){
+    size_t best = num_candidates;
+    size_t c;
+    for(c = 0; c < num_candidates; c++){
+        if(seated[c]){
+            continue;
+        }
+        if(best == num_candidates ||
+           (gains ? gains[c] > gains[best] : approvals[c] > approvals[best])){
+            best = c;
+        }
+    }
+    return best;
+}
+
+/*
+ * Sums over the platforms x the gain x grants a platform y at distance
+ * d, held in layer d at x, into layer 0 at y. After issue j, layer t at
+ * y holds the gains granted at distance t beyond the first j+1 issues
+ * by the platforms agreeing with y on the rest; adding issue j folds
+ * layer t+1 across it into layer t. Layers past the issues left are no
+ * longer needed.
+ */
+static void transform_gains(CommitteeEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    const size_t pool_size = engine->pool_size;
+    double *layers = engine->layers;
+    unsigned j, t;
+    for(j = 0; j < num_issues; j++){
+        const size_t bit = (size_t)1 << j;
+        // ascending, so layer t+1 still holds the previous issue
+        for(t = 0; t < num_issues - j; t++){
+            double *layer = layers + t*pool_size;
+            const double *above = layer + pool_size;
+            size_t base, x;
+            for(base = 0; base < pool_size; base += 2*bit){
+                for(x = base; x < base + bit; x++){
+                    layer[x] += above[x | bit];
+                    layer[x | bit] += above[x];
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Computes the Chamberlin-Courant gain of every candidate: a group at
+ * closest distance b grants votes*max(b-d, 0) at distance d.
+ */
+static void compute_gains(size_t num_groups,
+                          size_t num_candidates,
+                          const Candidate *groups,
+                          CommitteeEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    const unsigned *ids = engine->ids;
+    unsigned *gains = engine->gains;
+    size_t c, g;
+    if((unsigned long long)num_groups * num_candidates <= engine->transform_cost){
+        memset(gains, 0, sizeof(*gains) * num_candidates);
+        for(g = 0; g < num_groups; g++){
+            const unsigned platform = groups[g].id;
+            const unsigned votes = groups[g].votes;
+            const unsigned closest = engine->closest[g];
+            for(c = 0; c < num_candidates; c++){
+                unsigned d = distance(platform ^ ids[c]);
+                gains[c] += votes * ((closest > d) ? closest - d : 0);
+            }
+        }
+        return;
+    }
+
+    // the gains are integers well within the precision of a double
+    const size_t pool_size = engine->pool_size;
+    memset(engine->layers, 0, sizeof(*engine->layers) * pool_size * (num_issues + 1));
+    for(g = 0; g < num_groups; g++){
+        unsigned t;
+        for(t = 0; t < engine->closest[g]; t++){
+            engine->layers[t*pool_size + groups[g].id] =
+                (double)groups[g].votes * (engine->closest[g] - t);
+        }
+    }
+    transform_gains(engine);
+    for(c = 0; c < num_candidates; c++){
+        gains[c] = engine->layers[ids[c]];
+    }
+}
+
+/*
+ * Computes the sequential approval gain of every candidate: a group
+ * approving a members grants votes/(a+1) to every candidate it
+ * approves.
+ */
+static void compute_approvals(size_t num_groups,
+                              size_t num_candidates,
+                              const Candidate *groups,
+                              CommitteeEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    const unsigned *ids = engine->ids;
+    double *approvals = engine->approvals;
+    size_t c, g;
+    if((unsigned long long)num_groups * num_candidates <= engine->transform_cost){
+        memset(approvals, 0, sizeof(*approvals) * num_candidates);
+        for(g = 0; g < num_groups; g++){
+            const unsigned platform = groups[g].id;
+            const double weight = groups[g].votes/(engine->approved[g] + 1.0);
+            for(c = 0; c < num_candidates; c++){
+                approvals[c] += (2*distance(platform ^ ids[c]) < num_issues) ? weight : 0;
+            }
+        }
+        return;
+    }
+
+    const size_t pool_size = engine->pool_size;
+    memset(engine->layers, 0, sizeof(*engine->layers) * pool_size * (num_issues + 1));
+    for(g = 0; g < num_groups; g++){
+        const double weight = groups[g].votes/(engine->approved[g] + 1.0);
+        unsigned t;
+        for(t = 0; 2*t < num_issues; t++){
+            engine->layers[t*pool_size + groups[g].id] = weight;
+        }
+    }
+    transform_gains(engine);
+    for(c = 0; c < num_candidates; c++){
+        approvals[c] = engine->layers[ids[c]];
+    }
+}
+
+/*
+ * Greedy Chamberlin-Courant committee. A group whose closest distance
+ * falls from b to b' by a new member no longer gains from a candidate
+ * at distance d what it did: max(b-d, 0) becomes max(b'-d, 0).
+ */
+static void choose_chamberlin_courant(size_t num_groups,
+                                      size_t num_candidates,
+                                      size_t num_members,
+                                      const Candidate *groups,
+                                      CommitteeSeat *seats,
+                                      CommitteeEngine *engine){
+    const unsigned *ids = engine->ids;
+    unsigned *gains = engine->gains;
+    size_t c, g, s;
+    for(g = 0; g < num_groups; g++){
+        engine->closest[g] = engine->num_issues;
+    }
+    compute_gains(num_groups, num_candidates, groups, engine);
+
+    for(s = 0; s < num_members; s++){
+        size_t member = best_unseated(num_candidates, engine->seated, gains, NULL);
+        engine->seated[member] = 1;
+        seats[s].id = ids[member];
+        seats[s].gain = gains[member];
+        if(s + 1 == num_members){
+            break;
+        }
+
+        // correct the gains for the groups drawn closer, or recompute
+        // them if those are too many
+        size_t num_closer = 0;
+        for(g = 0; g < num_groups; g++){
+            num_closer += distance(groups[g].id ^ ids[member]) < engine->closest[g];
+        }
+        unsigned correct = ((unsigned long long)num_closer * num_candidates <=
+                            engine->transform_cost);
+        for(g = 0; g < num_groups; g++){
+            const unsigned platform = groups[g].id;
+            const unsigned votes = groups[g].votes;
+            const unsigned before = engine->closest[g];
+            const unsigned after = distance(platform ^ ids[member]);
+            if(after >= before){
+                continue;
+            }
+            for(c = 0; correct && c < num_candidates; c++){
+                unsigned d = distance(platform ^ ids[c]);
+                unsigned floor = (d > after) ? d : after;
+                gains[c] -= votes * ((before > floor) ? before - floor : 0);
+            }
+            engine->closest[g] = after;
+        }
+        if(!correct){
+            compute_gains(num_groups, num_candidates, groups, engine);
+        }
+    }
+}
+
+/*
+ * Sequential proportional approval committee. A group approving a new
+ * member, already approving a members, now weighs votes/(a+2) rather
+ * than votes/(a+1) towards every candidate it approves.
+ */
+static void choose_sequential(size_t num_groups,
+                              size_t num_candidates,
+                              size_t num_members,
+                              const Candidate *groups,
+                              CommitteeSeat *seats,
+                              CommitteeEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    const unsigned *ids = engine->ids;
+    double *approvals = engine->approvals;
+    size_t c, g, s;
+    memset(engine->approved, 0, sizeof(*engine->approved) * num_groups);
+    compute_approvals(num_groups, num_candidates, groups, engine);
+
+    for(s = 0; s < num_members; s++){
+        size_t member = best_unseated(num_candidates, engine->seated, NULL, approvals);
+        engine->seated[member] = 1;
+        seats[s].id = ids[member];
+        seats[s].gain = approvals[member];
+        if(s + 1 == num_members){
+            break;
+        }
+
+        // correct the gains for the groups approving the member, or
+        // recompute them if those are too many
+        size_t num_approving = 0;
+        for(g = 0; g < num_groups; g++){
+            num_approving += 2*distance(groups[g].id ^ ids[member]) < num_issues;
+        }
+        unsigned correct = ((unsigned long long)num_approving * num_candidates <=
+                            engine->transform_cost);
+        for(g = 0; g < num_groups; g++){
+            const unsigned platform = groups[g].id;
+            if(2*distance(platform ^ ids[member]) >= num_issues){
+                continue;
+            }
+            const double a = engine->approved[g]++;
+            const double change = groups[g].votes/(a + 2) - groups[g].votes/(a + 1);
+            for(c = 0; correct && c < num_candidates; c++){
+                approvals[c] += (2*distance(platform ^ ids[c]) < num_issues) ? change : 0;
+            }
+        }
+        if(!correct){
+            compute_approvals(num_groups, num_candidates, groups, engine);
+        }
+    }
+}
+
+size_t decide_committee_election(size_t num_groups,
+                                 size_t num_candidates,
+                                 const Candidate *groups,
+                                 const Candidate *candidates,
+                                 CommitteeSeat *chamberlin_courant,
+                                 CommitteeSeat *sequential,
+                                 CommitteeEngine *engine){
+    size_t num_members = (num_candidates < engine->num_seats) ? num_candidates
+                                                              : engine->num_seats;
+    size_t c;
+    for(c = 0; c < num_candidates; c++){
+        engine->ids[c] = candidates[c].id;
+    }
+
+    memset(engine->seated, 0, sizeof(*engine->seated) * num_candidates);
+    choose_chamberlin_courant(num_groups, num_candidates, num_members, groups,
+                              chamberlin_courant, engine);
+    memset(engine->seated, 0, sizeof(*engine->seated) * num_candidates);
+    choose_sequential(num_groups, num_candidates, num_members, groups,
+                      sequential, engine);
+    return num_members;
+}
+
+void print_committees(unsigned num_issues,
+                      unsigned turnout,
+                      size_t num_members,
+                      const CommitteeSeat *chamberlin_courant,
+                      const CommitteeSeat *sequential,
+                      FILE *stream){
+    // every voter starts at the largest distance
+    double cost = (double)num_issues * turnout;
+    double score = 0;
+    size_t s;
+    for(s = 0; s < num_members; s++){
+        cost -= chamberlin_courant[s].gain;
+        score += sequential[s].gain;
+    }
+
+    fprintf(stream, "Chamberlin-Courant Committee (mean distance %.4lf): \n", cost/turnout);
+    for(s = 0; s < num_members; s++){
+        fprintf(stream, "  %zu) %zu +%.0lf\n", s+1, chamberlin_courant[s].id,
+                chamberlin_courant[s].gain);
+    }
+    fprintf(stream, "\nSequential Approval Committee (score %.2lf): \n", score);
+    for(s = 0; s < num_members; s++){
+        fprintf(stream, "  %zu) %zu +%.2lf\n", s+1, sequential[s].id, sequential[s].gain);
+    }
+}
@@ -0,0 +1,177 @@
+/*======================================================================
+ *                              committee.h
+ *======================================================================
+ * Multi-winner committees chosen greedily over the voter groups.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Multi-winner committees chosen greedily over the voter groups.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef COMMITTEE_H
+#define COMMITTEE_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "election.h"
+
+/**
+ * Seat of a committee, in the order the members were chosen.
+ */
+typedef struct{
+    size_t id; /**< id of the member */
+    double gain; /**< rise in the score of the committee when the
+                      member was seated */
+} CommitteeSeat;
+
+/**
+ * Buffers of the committee engine, sized for a pool of candidates.
+ *
+ * Two committees of up to num_seats members are chosen greedily, each
+ * step seating the candidate of the largest marginal gain:
+ *
+ * - Chamberlin-Courant (k-median): a voter's cost is the distance to
+ *   the closest member, and the gain of a candidate is the fall in the
+ *   total cost. Before any seat every voter is at the largest distance,
+ *   so the first member is the approval winner.
+ * - sequential proportional approval: a voter approves the candidates
+ *   agreeing with more than half of the voter's platform, as for the
+ *   pro count, and a voter already approving a members counts 1/(a+1)
+ *   towards the gain of a candidate.
+ *
+ * The gains are not recomputed at each step. Seating a member changes
+ * the closest distance or the weight of only some voter groups, and
+ * the gains of every candidate are corrected for those groups alone;
+ * since a group's closest distance only falls, the corrections of the
+ * whole Chamberlin-Courant committee cost at most num_issues passes
+ * over the candidates per group, however many seats. Each pass is a
+ * branch-free loop over the candidates whose distances are computed
+ * with an arithmetic popcount, so that the compiler vectorizes it.
+ *
+ * When the groups to correct times the candidates exceed the cost of a
+ * transform over the issues, the gains are instead recomputed for every
+ * platform at once: both are sums over the groups of a function of the
+ * group and of its distance to the candidate, which the transform
+ * folds in one issue at a time, as the threshold approval engine does.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    size_t num_seats; /**< seats of each committee */
+    size_t transform_cost; /**< additions made by the transform */
+    unsigned *ids; /**< platform of each candidate */
+    unsigned *seated; /**< whether each candidate holds a seat */
+    unsigned *gains; /**< Chamberlin-Courant gain of each candidate */
+    double *approvals; /**< sequential approval gain of each candidate */
+    unsigned *closest; /**< distance of each voter group to the closest
+                            member */
+    unsigned *approved; /**< members each voter group approves */
+    double *layers; /**< gain at each remaining distance from every
+                         platform, num_issues+1 layers of pool_size */
+} CommitteeEngine;
+
+/**
+ * Initializes a CommitteeEngine structure.
+ *
+ * @param num_issues number of issues in the election; at most 15
+ * @param num_seats seats of each committee; at least 1
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int committee_init(unsigned num_issues, size_t num_seats, CommitteeEngine *engine);
+
+/**
+ * Releases the memory held by a CommitteeEngine structure.
+ *
+ * @param engine pointer to the engine
+ */
+void committee_free(CommitteeEngine *engine);
+
+/**
+ * Chooses the Chamberlin-Courant and sequential approval committees of
+ * an election. Ties go to the candidate of lowest index.
+ *
+ * @param num_groups number of voter groups
+ * @param num_candidates number of candidates; at least 1
+ * @param groups array of voter groups
+ * @param candidates array of candidates, with distinct platforms; may
+ *                   be groups itself
+ * @param chamberlin_courant array to hold the Chamberlin-Courant
+ *                           committee, num_seats long
+ * @param sequential array to hold the sequential approval committee,
+ *                   num_seats long
+ * @param engine pointer to the engine
+ *
+ * @return the number of members of each committee: the seats, or the
+ *         candidates if there are fewer
+ */
+size_t decide_committee_election(size_t num_groups,
+                                 size_t num_candidates,
+                                 const Candidate *groups,
+                                 const Candidate *candidates,
+                                 CommitteeSeat *chamberlin_courant,
+                                 CommitteeSeat *sequential,
+                                 CommitteeEngine *engine);
+
+/**
+ * Prints the members of the two committees of an election.
+ *
+ * @param num_issues number of issues in the election
+ * @param turnout number of voters who cast a ballot
+ * @param num_members number of members of each committee
+ * @param chamberlin_courant the Chamberlin-Courant committee
+ * @param sequential the sequential approval committee
+ * @param stream output stream
+ */
+void print_committees(unsigned num_issues,
+                      unsigned turnout,
+                      size_t num_members,
+                      const CommitteeSeat *chamberlin_courant,
+                      const CommitteeSeat *sequential,
+                      FILE *stream);
+
+#endif
@@ -51,34 +51,137 @@
  * @copyright	Simplified BSD License
  */
 #include <limits.h>
-#include <stdlib.h>
+#include <math.h>
 #include <time.h>
 
+#include "confuzz.h"
+
+/* http://www.pcg-random.org/
+ * PCG-XSH-RR: a 64-bit linear congruential state whose output is a
+ * xorshifted high word rotated by its top bits. The lowest output bit
+ * is dropped so draws span [0, CONFUZZ_RAND_MAX].
+ */
+static uint32_t pcg32(RandomState *random){
+    uint64_t old = random->state;
+    random->state = old*6364136223846793005ULL + random->increment;
+    uint32_t xorshifted = ((old >> 18) ^ old) >> 27;
+    unsigned rotation = old >> 59;
+    return (xorshifted >> rotation) | (xorshifted << ((-rotation) & 31));
+}
+
+void rand_seed(uint64_t seed, uint64_t stream, RandomState *random){
+    random->state = 0;
+    random->increment = (stream << 1) | 1;
+    pcg32(random);
+    random->state += seed;
+    pcg32(random);
+}
+
+unsigned rand_next(RandomState *random){
+    return pcg32(random) >> 1;
+}
+
 /* http://www.azillionmonkeys.com/qed/random.html
- * If the value of the rand function is modded by a ceiling value that
- * does not divide evenly into (RAND_MAX + 1), then the
- * distribution will no longer be uniform, since rand is powered
- * by a linear congruential generator. The following function tries
- * to account for this issue.
+ * If the value of rand_next is modded by a ceiling value that
+ * does not divide evenly into (CONFUZZ_RAND_MAX + 1), then the
+ * distribution will no longer be uniform. The following function
+ * tries to account for this issue.
  *
- * NOTE: ceiling must be less than (RAND_MAX + 1)
+ * NOTE: ceiling must be less than (CONFUZZ_RAND_MAX + 1)
  */
-unsigned rand_ceiling(unsigned ceiling){
+unsigned rand_ceiling(unsigned ceiling, RandomState *random){
     unsigned rand_num = 0;
-    const unsigned reject_multiplier = (RAND_MAX + 1U)/ceiling;
+    const unsigned reject_multiplier = (CONFUZZ_RAND_MAX + 1U)/ceiling;
     const unsigned reject = ceiling*reject_multiplier;
 
     do{
-        rand_num = rand();
+        rand_num = rand_next(random);
     }while(rand_num >= reject);
 
     return rand_num/reject_multiplier;
 }
 
+double rand_uniform(RandomState *random){
+    double uniform = rand_next(random);
+    uniform = uniform*(1U<<14) + rand_ceiling(1U<<14, random);
+    return uniform/35184372088832.0;
+}
+
+/*
+ * Inversion by sequential search from 0, for means below 10; the
+ * probability is at most 1/2.
+ */
+static unsigned binomial_inversion(unsigned trials, double probability, RandomState *random){
+    const double q = 1 - probability;
+    const double s = probability/q;
+    const double a = (trials + 1.0)*s;
+    for(;;){
+        double r = pow(q, trials);
+        double u = rand_uniform(random);
+        unsigned x = 0;
+        while(u > r && x < trials){
+            u -= r;
+            x++;
+            r *= a/x - s;
+        }
+        // rounding can leave u just above the whole mass
+        if(u <= r){
+            return x;
+        }
+    }
+}
+
+/* http://epub.wu.ac.at/1242/
+ * BTRS: transformed rejection with squeeze, for means of 10 or more;
+ * the probability is at most 1/2. Most draws are accepted by the box
+ * test alone, and the rest by comparing the density ratio of the draw
+ * and the mode in logarithms.
+ */
+static unsigned binomial_btrs(unsigned trials, double probability, RandomState *random){
+    const double q = 1 - probability;
+    const double spq = sqrt(trials*probability*q);
+    const double b = 1.15 + 2.53*spq;
+    const double a = -0.0873 + 0.0248*b + 0.01*probability;
+    const double c = trials*probability + 0.5;
+    const double v_r = 0.92 - 4.2/b;
+    const double alpha = (2.83 + 5.1/b)*spq;
+    const double lpq = log(probability/q);
+    const double m = floor((trials + 1.0)*probability);
+    const double h = lgamma(m + 1) + lgamma(trials - m + 1);
+    for(;;){
+        double u = rand_uniform(random) - 0.5;
+        double v = rand_uniform(random);
+        double us = 0.5 - fabs(u);
+        double k = floor((2*a/us + b)*u + c);
+        if(k < 0 || k > trials){
+            continue;
+        }
+        if(us >= 0.07 && v <= v_r){
+            return k;
+        }
+        v = log(v*alpha/(a/(us*us) + b));
+        if(v <= h - lgamma(k + 1) - lgamma(trials - k + 1) + (k - m)*lpq){
+            return k;
+        }
+    }
+}
+
+unsigned rand_binomial(unsigned trials, double probability, RandomState *random){
+    if(!trials || probability <= 0){
+        return 0;
+    }else if(probability >= 1){
+        return trials;
+    }else if(probability > 0.5){
+        return trials - rand_binomial(trials, 1 - probability, random);
+    }else if(trials*probability < 10){
+        return binomial_inversion(trials, probability, random);
+    }
+    return binomial_btrs(trials, probability, random);
+}
+
 /* http://eternallyconfuzzled.com/arts/jsw_art_rand.aspx
  * By hashing the time_t value via type punning, a portable method of
- * generating a seed from the system time for the standard C library
- * srand function is achieved.
+ * generating a seed from the system time is achieved.
  */
 unsigned int time_seed(){
     time_t now = time(NULL);
@@ -53,45 +53,115 @@
 #ifndef CONFUZZ_H
 #define CONFUZZ_H
 
+#include <stdint.h>
+
+/**
+ * The largest value returned by rand_next.
+ */
+#define CONFUZZ_RAND_MAX 0x7FFFFFFFU
+
+/**
+ * State of a pseudo-random number generator.
+ *
+ * Every draw takes the state explicitly, so independent simulations
+ * never share a generator. The generator is a permuted congruential
+ * generator (PCG-XSH-RR); each odd increment selects a distinct stream.
+ */
+typedef struct{
+    uint64_t state; /**< current state of the generator */
+    uint64_t increment; /**< odd increment selecting the stream */
+} RandomState;
+
+/**
+ * Seeds a pseudo-random number generator.
+ *
+ * @param seed the seed of the generator
+ * @param stream the stream of the generator; generators seeded alike
+ *               on different streams are independent
+ * @param random pointer to the generator state
+ *
+ * @sa time_seed
+ */
+void rand_seed(uint64_t seed, uint64_t stream, RandomState *random);
+
+/**
+ * Returns a pseudo-random integral number in the range
+ * [0, CONFUZZ_RAND_MAX].
+ *
+ * @param random pointer to the generator state
+ *
+ * @return a pseudo-random integral number in the range
+ *         [0, CONFUZZ_RAND_MAX]
+ *
+ * @sa http://www.pcg-random.org/
+ */
+unsigned rand_next(RandomState *random);
+
 /**
  * Returns a pseudo-random integral number in the range [0, ceiling).
  * 
- * If the value of the standard C library rand function is modded by a
- * ceiling value that does not divide evenly into (RAND_MAX + 1), then
- * the distribution will no longer be uniform, since rand is powered by
- * a linear congruential generator; the rand_ceiling fucntion tries to
- * account for this caveat.
+ * If the value of rand_next is modded by a ceiling value that does not
+ * divide evenly into (CONFUZZ_RAND_MAX + 1), then the distribution will
+ * no longer be uniform; the rand_ceiling fucntion tries to account for
+ * this caveat.
  *
- * @param ceiling a range ceiling less than (RAND_MAX + 1)
+ * @param ceiling a range ceiling less than (CONFUZZ_RAND_MAX + 1)
+ * @param random pointer to the generator state
  *
  * @return a pseudo-random integral number in the range [0, ceiling)
  *
- * @sa rand
+ * @sa rand_next
  * @sa http://www.azillionmonkeys.com/qed/random.html
  */
-unsigned rand_ceiling(unsigned ceiling);
+unsigned rand_ceiling(unsigned ceiling, RandomState *random);
 
 /**
- * Generates a portable seed from the system time for the standard C
- * library srand function.
- *
- * A common method to seed the standard C library srand function is to
- * simply pass in a value returned by the standard C library time
- * function. However, while the time function returns a value of type
- * time_t, the srand function expects an argument of type unsigned int.
- * This results in a portability issue since a cast from an
- * implementation-defined type (time_t) to a native C type (unsigned
- * int) is not guranteed to result in a distinct meaningful value; for
- * example, an implementation might define such casts to consistently
- * result in a value of 0, thereby eliminating the uniqueness expected
- * when supplying the system time as a seed. By hashing the time_t value
- * via type punning, a portable method of generating a seed from the
- * system time for the standard C library srand function is achieved.
- *
- * @return a seed generated from the system time for the standard C
- *         library srand function
- *
- * @sa srand, time
+ * Returns a pseudo-random uniform in the range [0, 1) with 45 bits of
+ * resolution.
+ *
+ * @param random pointer to the generator state
+ *
+ * @return a pseudo-random uniform in the range [0, 1)
+ */
+double rand_uniform(RandomState *random);
+
+/**
+ * Returns a pseudo-random draw from the binomial distribution: the
+ * number of successes of independent trials of a probability.
+ *
+ * Small means are drawn by inversion and larger ones by transformed
+ * rejection with squeeze (BTRS), so the cost of a draw does not grow
+ * with the number of trials.
+ *
+ * @param trials number of trials
+ * @param probability probability of success of each trial
+ * @param random pointer to the generator state
+ *
+ * @return a pseudo-random number of successes in the range [0, trials]
+ *
+ * @sa http://epub.wu.ac.at/1242/ (Hormann, The Generation of Binomial
+ *     Random Variates)
+ */
+unsigned rand_binomial(unsigned trials, double probability, RandomState *random);
+
+/**
+ * Generates a portable seed from the system time for rand_seed.
+ *
+ * A common method to seed a generator is to simply pass in a value
+ * returned by the standard C library time function. However, while
+ * the time function returns a value of type time_t, rand_seed expects
+ * an integral argument. This results in a portability issue since a
+ * cast from an implementation-defined type (time_t) to a native C type
+ * (unsigned int) is not guranteed to result in a distinct meaningful
+ * value; for example, an implementation might define such casts to
+ * consistently result in a value of 0, thereby eliminating the
+ * uniqueness expected when supplying the system time as a seed. By
+ * hashing the time_t value via type punning, a portable method of
+ * generating a seed from the system time is achieved.
+ *
+ * @return a seed generated from the system time for rand_seed
+ *
+ * @sa rand_seed, time
  * @sa http://eternallyconfuzzled.com/arts/jsw_art_rand.aspx
  */
 unsigned int time_seed();
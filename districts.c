@@ -0,0 +1,361 @@
+/*======================================================================
+ *                              districts.c
+ *======================================================================
+ * Districts deciding an election by their winners.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Districts deciding an election by their winners.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "districts.h"
+#include "election.h"
+#include "workers.h"
+
+/*
+ * Winners of every method as sets of candidates, as compared by
+ * election_agreements.
+ */
+typedef struct{
+    Candidate *two_party[2];
+    Candidate *washington[1];
+    Candidate *irv[1];
+    size_t num[NUM_METHODS];
+    Candidate **sets[NUM_METHODS];
+} WinnerSets;
+
+static void winner_sets(size_t num_a_winners,
+                        size_t num_h_winners,
+                        size_t num_winners,
+                        Candidate *washington,
+                        Candidate *irv,
+                        Candidate *status_quo,
+                        Candidate **elected,
+                        Candidate **elected_a,
+                        Candidate **elected_h,
+                        WinnerSets *winners){
+    // two-party winners: both candidates on a tied vote
+    winners->two_party[0] = status_quo;
+    winners->two_party[1] = status_quo+1;
+    winners->washington[0] = washington;
+    winners->irv[0] = irv;
+
+    // sets in the order of the Method enumeration
+    winners->num[METHOD_TRADITIONAL] = num_winners;
+    winners->num[METHOD_APPROVAL] = num_a_winners;
+    winners->num[METHOD_HITLER] = num_h_winners;
+    winners->num[METHOD_TWO_PARTY] = (status_quo[0].votes == status_quo[1].votes) ? 2 : 1;
+    winners->num[METHOD_WASHINGTON] = 1;
+    winners->num[METHOD_IRV] = irv ? 1 : 0;
+    winners->sets[METHOD_TRADITIONAL] = elected;
+    winners->sets[METHOD_APPROVAL] = elected_a;
+    winners->sets[METHOD_HITLER] = elected_h;
+    winners->sets[METHOD_TWO_PARTY] = winners->two_party;
+    winners->sets[METHOD_WASHINGTON] = winners->washington;
+    winners->sets[METHOD_IRV] = winners->irv;
+}
+
+/*
+ * Bits of a word of the bitmap of touched platforms.
+ */
+#define WORD_BITS (sizeof(unsigned) * CHAR_BIT)
+
+int district_tally_init(unsigned num_issues, DistrictTally *tally){
+    tally->pool_size = (size_t)1 << num_issues;
+    tally->turnout = 0;
+    tally->counts = calloc(tally->pool_size * (NUM_METHODS + 1), sizeof(*tally->counts));
+    tally->touched = calloc((tally->pool_size + WORD_BITS - 1) / WORD_BITS,
+                            sizeof(*tally->touched));
+    return (tally->counts && tally->touched) ? 0 : -1;
+}
+
+void district_tally_free(DistrictTally *tally){
+    free(tally->counts);
+    free(tally->touched);
+    tally->counts = NULL;
+    tally->touched = NULL;
+}
+
+static void touch(size_t id, DistrictTally *tally){
+    tally->touched[id / WORD_BITS] |= 1U << (id % WORD_BITS);
+}
+
+void district_tally_add(unsigned methods,
+                        unsigned turnout,
+                        size_t num_groups,
+                        const Candidate *groups,
+                        size_t num_a_winners,
+                        size_t num_h_winners,
+                        size_t num_winners,
+                        Candidate *washington,
+                        Candidate *irv,
+                        Candidate *status_quo,
+                        Candidate **elected,
+                        Candidate **elected_a,
+                        Candidate **elected_h,
+                        DistrictTally *tally){
+    unsigned *votes = tally->counts;
+    size_t i;
+    for(i = 0; i < num_groups; i++){
+        votes[groups[i].id] += groups[i].votes;
+        touch(groups[i].id, tally);
+    }
+    tally->turnout += turnout;
+
+    // under a slate, a winner need not have voters of its own platform
+    WinnerSets winners;
+    winner_sets(num_a_winners, num_h_winners, num_winners, washington, irv, status_quo,
+                elected, elected_a, elected_h, &winners);
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        if(!((methods >> m) & 0x1)){
+            continue;
+        }
+        unsigned *wins = tally->counts + (m+1)*tally->pool_size;
+        for(i = 0; i < winners.num[m]; i++){
+            wins[winners.sets[m][i]->id]++;
+            touch(winners.sets[m][i]->id, tally);
+        }
+    }
+}
+
+/*
+ * One level of the merge: every tally a multiple of twice the stride
+ * takes in the tally a stride after it.
+ */
+typedef struct{
+    size_t num_tallies;
+    size_t stride;
+    DistrictTally *tallies;
+} MergeLevel;
+
+static void merge_job(size_t first, size_t last, unsigned thread, void *argument){
+    const MergeLevel *level = argument;
+    const size_t pool_size = level->tallies[0].pool_size;
+    size_t t;
+    for(t = 0; t + level->stride < level->num_tallies; t += 2*level->stride){
+        DistrictTally *into = level->tallies + t;
+        DistrictTally *from = level->tallies + t + level->stride;
+        size_t w;
+        for(w = first; w < last; w++){
+            unsigned word = from->touched[w];
+            size_t id;
+            for(id = w*WORD_BITS; word; word >>= 1, id++){
+                if(!(word & 0x1)){
+                    continue;
+                }
+                size_t r;
+                for(r = 0; r <= NUM_METHODS; r++){
+                    into->counts[r*pool_size + id] += from->counts[r*pool_size + id];
+                    from->counts[r*pool_size + id] = 0;
+                }
+            }
+            into->touched[w] |= from->touched[w];
+            from->touched[w] = 0;
+        }
+    }
+    (void)thread;
+}
+
+void district_tally_merge(size_t num_tallies, DistrictTally *tallies, WorkerPool *pool){
+    const size_t num_words = (tallies[0].pool_size + WORD_BITS - 1) / WORD_BITS;
+    MergeLevel level = {num_tallies, 1, tallies};
+    for(level.stride = 1; level.stride < num_tallies; level.stride *= 2){
+        size_t pairs = (num_tallies - level.stride + 2*level.stride - 1) / (2*level.stride);
+        worker_pool_run(num_words, pairs * WORD_BITS, merge_job, &level, pool);
+        size_t t;
+        for(t = 0; t + level.stride < num_tallies; t += 2*level.stride){
+            tallies[t].turnout += tallies[t + level.stride].turnout;
+            tallies[t + level.stride].turnout = 0;
+        }
+    }
+}
+
+unsigned district_tally_finish(unsigned methods,
+                               size_t *num_groups,
+                               Candidate *groups,
+                               ElectoralWinner *electoral,
+                               size_t *ids,
+                               DistrictTally *tally){
+    const size_t pool_size = tally->pool_size;
+    const size_t num_words = (pool_size + WORD_BITS - 1) / WORD_BITS;
+    unsigned *votes = tally->counts;
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        electoral[m].districts = 0;
+        electoral[m].num_winners = 0;
+        electoral[m].popular = 0;
+    }
+
+    // the platforms with votes stand in order of id, as the ballots of
+    // a file do
+    size_t n = 0;
+    size_t w;
+    for(w = 0; w < num_words; w++){
+        unsigned word = tally->touched[w];
+        size_t id;
+        for(id = w*WORD_BITS; word; word >>= 1, id++){
+            if(!(word & 0x1)){
+                continue;
+            }
+            for(m = 0; m < NUM_METHODS; m++){
+                if(!((methods >> m) & 0x1)){
+                    continue;
+                }
+                // the winners of method m are listed from ids + m*pool_size
+                const unsigned *wins = tally->counts + (m+1)*pool_size;
+                if(wins[id] > electoral[m].districts){
+                    electoral[m].districts = wins[id];
+                    electoral[m].num_winners = 0;
+                }
+                if(wins[id] && wins[id] == electoral[m].districts){
+                    ids[m*pool_size + electoral[m].num_winners++] = id;
+                }
+            }
+            if(votes[id]){
+                memset(groups+n, 0, sizeof(*groups));
+                groups[n].id = id;
+                groups[n].votes = votes[id];
+                n++;
+            }
+        }
+    }
+    if(n == 1){
+        groups[1].id = (groups[0].id + 1) & (pool_size - 1);
+    }
+    *num_groups = n;
+
+    // pack the winners of each method after those of the method before
+    size_t offset = 0;
+    for(m = 0; m < NUM_METHODS; m++){
+        memmove(ids + offset, ids + m*pool_size, sizeof(*ids) * electoral[m].num_winners);
+        offset += electoral[m].num_winners;
+    }
+
+    // the counts are cleared once the comparisons no longer need them
+    for(w = 0; w < num_words; w++){
+        unsigned word = tally->touched[w];
+        size_t id;
+        for(id = w*WORD_BITS; word; word >>= 1, id++){
+            if(word & 0x1){
+                size_t r;
+                for(r = 0; r <= NUM_METHODS; r++){
+                    tally->counts[r*pool_size + id] = 0;
+                }
+            }
+        }
+        tally->touched[w] = 0;
+    }
+
+    unsigned turnout = tally->turnout;
+    tally->turnout = 0;
+    return turnout;
+}
+
+size_t district_num_ids(const ElectoralWinner *electoral){
+    size_t num_ids = 0;
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        num_ids += electoral[m].num_winners;
+    }
+    return num_ids;
+}
+
+unsigned district_popular_winners(unsigned methods,
+                                  size_t num_a_winners,
+                                  size_t num_h_winners,
+                                  size_t num_winners,
+                                  Candidate *washington,
+                                  Candidate *irv,
+                                  Candidate *status_quo,
+                                  Candidate **elected,
+                                  Candidate **elected_a,
+                                  Candidate **elected_h,
+                                  ElectoralWinner *electoral,
+                                  const size_t *ids){
+    WinnerSets winners;
+    winner_sets(num_a_winners, num_h_winners, num_winners, washington, irv, status_quo,
+                elected, elected_a, elected_h, &winners);
+    unsigned popular = 0;
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        // the winners of the methods not decided are empty
+        size_t e, i;
+        for(e = 0; e < electoral[m].num_winners && (methods >> m) & 0x1; e++){
+            for(i = 0; i < winners.num[m] && winners.sets[m][i]->id != ids[e]; i++);
+            if(i < winners.num[m]){
+                electoral[m].popular = 1;
+            }
+        }
+        ids += electoral[m].num_winners;
+        popular |= electoral[m].popular << m;
+    }
+    return popular;
+}
+
+void print_electoral_winners(unsigned methods,
+                             unsigned num_districts,
+                             const ElectoralWinner *electoral,
+                             const size_t *ids,
+                             FILE *stream){
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        if((methods >> m) & 0x1){
+            size_t e;
+            fprintf(stream, "  %-12s", method_name(m));
+            for(e = 0; e < electoral[m].num_winners; e++){
+                fprintf(stream, " %zu", ids[e]);
+            }
+            fprintf(stream, " won %u of %u districts%s%s\n", electoral[m].districts,
+                    num_districts, (electoral[m].num_winners > 1) ? " each" : "",
+                    electoral[m].popular ? "" : " (not the popular winner)");
+        }
+        ids += electoral[m].num_winners;
+    }
+}
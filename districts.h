@@ -0,0 +1,254 @@
+/*======================================================================
+ *                              districts.h
+ *======================================================================
+ * Districts deciding an election by their winners.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Districts deciding an election by their winners.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef DISTRICTS_H
+#define DISTRICTS_H
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "election.h"
+#include "workers.h"
+
+/**
+ * Largest nationwide population of the districts, so that the sum of
+ * disapproval of a candidate cannot overflow.
+ */
+#define DISTRICTS_MAX_VOTERS (UINT_MAX / (KERNEL_MAX_ISSUES + 1))
+
+/**
+ * Electoral winners of a method: every platform winning the most
+ * districts under the method, more than one on a tie. Their ids are
+ * kept apart, the winners of each method in turn (see
+ * district_tally_finish).
+ */
+typedef struct{
+    unsigned districts; /**< number of districts each winner won */
+    size_t num_winners; /**< number of electoral winners; 0 if the
+                             method was not decided */
+    unsigned popular; /**< whether a winner is also a winner of the
+                           method in the nationwide election */
+} ElectoralWinner;
+
+/**
+ * Running tally of the districts decided by one thread: the nationwide
+ * votes of every platform, and the districts every platform won under
+ * each method. A district credits each of its tied winners.
+ *
+ * A district is tallied as soon as it is decided, so that only a
+ * tally per thread is held rather than the candidates of every
+ * district. The platforms a district touches are marked, so that
+ * merging and emptying the tallies visits those platforms only.
+ */
+typedef struct{
+    size_t pool_size; /**< number of possible platforms */
+    unsigned turnout; /**< voters who cast a ballot in the districts */
+    unsigned *counts; /**< votes of every platform, then the districts
+                           won by every platform under each method, in
+                           NUM_METHODS+1 rows of pool_size */
+    unsigned *touched; /**< bitmap of the platforms with votes or wins */
+} DistrictTally;
+
+/**
+ * Initializes a DistrictTally structure with nothing tallied.
+ *
+ * @param num_issues number of issues in the election
+ * @param tally pointer to the tally
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int district_tally_init(unsigned num_issues, DistrictTally *tally);
+
+/**
+ * Releases the memory held by a DistrictTally structure.
+ *
+ * @param tally pointer to the tally; may be zeroed
+ */
+void district_tally_free(DistrictTally *tally);
+
+/**
+ * Tallies a decided district.
+ *
+ * @param methods set of election methods decided (see Method)
+ * @param turnout number of voters who cast a ballot in the district
+ * @param num_groups number of voter groups of the district
+ * @param groups voter groups of the district
+ * @param num_a_winners number of approval winners
+ * @param num_h_winners number of hitler election winners
+ * @param num_winners number of traditional election winners
+ * @param washington pointer to washington candidate
+ * @param irv pointer to instant-runoff winner, or NULL if it was not
+ *            decided
+ * @param status_quo array holding the two-party system candidates
+ * @param elected array of pointers to traditional election winners
+ * @param elected_a array of pointers to approval winners
+ * @param elected_h array of pointers to hitler election winners
+ * @param tally pointer to the tally
+ */
+void district_tally_add(unsigned methods,
+                        unsigned turnout,
+                        size_t num_groups,
+                        const Candidate *groups,
+                        size_t num_a_winners,
+                        size_t num_h_winners,
+                        size_t num_winners,
+                        Candidate *washington,
+                        Candidate *irv,
+                        Candidate *status_quo,
+                        Candidate **elected,
+                        Candidate **elected_a,
+                        Candidate **elected_h,
+                        DistrictTally *tally);
+
+/**
+ * Adds up the tallies of every thread into the first one, pairwise in
+ * a tree of log2(num_tallies) levels, the platforms of each level split
+ * between the threads of the pool. The other tallies are left empty.
+ *
+ * @param num_tallies number of tallies
+ * @param tallies array of tallies
+ * @param pool pointer to the pool, or NULL
+ */
+void district_tally_merge(size_t num_tallies, DistrictTally *tallies, WorkerPool *pool);
+
+/**
+ * Turns a merged tally into the voter groups of the nationwide election
+ * and the electoral winners of each method, and empties it. No
+ * tiebreak is applied: every platform tied for the most districts is a
+ * winner.
+ *
+ * @param methods set of election methods decided (see Method)
+ * @param num_groups pointer to the variable to hold the number of
+ *                   voter groups
+ * @param groups array to hold the voter groups, as allocated by
+ *               perform_election; of the pool size
+ * @param electoral array to hold the electoral winners of each method,
+ *                  of NUM_METHODS; the methods not decided have none
+ * @param ids array to hold the ids of the electoral winners of every
+ *            method in turn, each method in increasing order of id;
+ *            NUM_METHODS times the pool size long
+ * @param tally pointer to the tally
+ *
+ * @return the number of voters who cast a ballot
+ */
+unsigned district_tally_finish(unsigned methods,
+                               size_t *num_groups,
+                               Candidate *groups,
+                               ElectoralWinner *electoral,
+                               size_t *ids,
+                               DistrictTally *tally);
+
+/**
+ * Returns the number of electoral winner ids over every method.
+ *
+ * @param electoral array of the electoral winners of each method
+ *
+ * @return sum of the electoral winners of every method
+ */
+size_t district_num_ids(const ElectoralWinner *electoral);
+
+/**
+ * Marks the electoral winners which also win the nationwide election.
+ *
+ * @param methods set of election methods decided (see Method)
+ * @param num_a_winners number of nationwide approval winners
+ * @param num_h_winners number of nationwide hitler election winners
+ * @param num_winners number of nationwide traditional election winners
+ * @param washington pointer to nationwide washington candidate
+ * @param irv pointer to nationwide instant-runoff winner, or NULL if it
+ *            was not decided
+ * @param status_quo array holding the nationwide two-party system
+ *                   candidates
+ * @param elected array of pointers to nationwide traditional election
+ *                winners
+ * @param elected_a array of pointers to nationwide approval winners
+ * @param elected_h array of pointers to nationwide hitler election
+ *                  winners
+ * @param electoral array of the electoral winners of each method
+ * @param ids array of the ids of the electoral winners of every method
+ *            in turn
+ *
+ * @return bitmask with bit m set when an electoral winner of method m
+ *         (a Method) is a nationwide winner
+ */
+unsigned district_popular_winners(unsigned methods,
+                                  size_t num_a_winners,
+                                  size_t num_h_winners,
+                                  size_t num_winners,
+                                  Candidate *washington,
+                                  Candidate *irv,
+                                  Candidate *status_quo,
+                                  Candidate **elected,
+                                  Candidate **elected_a,
+                                  Candidate **elected_h,
+                                  ElectoralWinner *electoral,
+                                  const size_t *ids);
+
+/**
+ * Prints the electoral winners of each decided method, every one of
+ * them on a tie.
+ *
+ * @param methods set of election methods decided (see Method)
+ * @param num_districts number of districts
+ * @param electoral array of the electoral winners of each method
+ * @param ids array of the ids of the electoral winners of every method
+ *            in turn
+ * @param stream output stream
+ */
+void print_electoral_winners(unsigned methods,
+                             unsigned num_districts,
+                             const ElectoralWinner *electoral,
+                             const size_t *ids,
+                             FILE *stream);
+
+#endif
@@ -51,10 +51,70 @@
  * @copyright	Simplified BSD License
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "bit_functions.h"
-#include "confuzz.h"
 #include "election.h"
+#include "workers.h"
+
+static const char *METHOD_NAMES[NUM_METHODS] = {
+    "traditional",
+    "approval",
+    "hitler",
+    "two_party",
+    "washington",
+    "irv"
+};
+
+const char *method_name(Method method){
+    return METHOD_NAMES[method];
+}
+
+int parse_methods(const char *list, unsigned *methods){
+    *methods = 0;
+    do{
+        size_t length = strcspn(list, ",");
+        unsigned m;
+        for(m = 0; m < NUM_METHODS; m++){
+            if(strlen(METHOD_NAMES[m]) == length && !strncmp(list, METHOD_NAMES[m], length)){
+                break;
+            }
+        }
+        if(m == NUM_METHODS){
+            return -1;
+        }
+        *methods |= 1U << m;
+        list += length;
+    }while(*list++);
+    return 0;
+}
+
+unsigned plan_election(unsigned candidate_statistics, unsigned methods){
+    // the printed statistics report every method of decide_election
+    unsigned plan = candidate_statistics ? ALL_STAGES : 0;
+    if(methods & (1U << METHOD_TRADITIONAL)){
+        plan |= STAGE_SORT | STAGE_TRADITIONAL;
+    }
+    if(methods & (1U << METHOD_APPROVAL)){
+        plan |= STAGE_DISAPPROVAL | STAGE_APPROVAL;
+    }
+    if(methods & (1U << METHOD_HITLER)){
+        plan |= STAGE_HITLER | STAGE_HITLER_ELECTION;
+    }
+    if(methods & (1U << METHOD_TWO_PARTY)){
+        plan |= STAGE_SORT | STAGE_TWO_PARTY;
+    }
+    if(methods & (1U << METHOD_WASHINGTON)){
+        plan |= STAGE_WASHINGTON;
+    }
+    // candidate indices break instant-runoff ties, so their order must
+    // not depend on the other methods
+    if(methods & (1U << METHOD_IRV)){
+        plan |= STAGE_SORT | STAGE_IRV;
+    }
+    return plan;
+}
 
 /*
  * The method for determining a candidate's hitler doesn't account for
@@ -101,7 +161,35 @@ void compute_candidate_statistics(unsigned num_issues,
     }
 }
 
-void compute_election_statistics(unsigned num_issues,
+/*
+ * Computes only the disapproval sum and/or the hitler of a candidate,
+ * as selected by the plan; the hitler is chosen exactly as in
+ * compute_candidate_statistics.
+ */
+static void compute_planned_statistics(unsigned plan,
+                                       size_t num_candidates,
+                                       Candidate *candidate,
+                                       Candidate *candidates){
+    unsigned sum_disapproval = 0;
+    unsigned max_disapproval = 0;
+    size_t hitler = candidate->id;
+
+    size_t h;
+    for(h = 0; h < num_candidates; h++){
+        unsigned disapproval = hamming_weight((candidate->id)^(candidates[h].id));
+        if((plan & STAGE_HITLER) && disapproval > max_disapproval){
+            hitler = candidates[h].id;
+            max_disapproval = disapproval;
+        }
+        sum_disapproval += disapproval * candidates[h].votes;
+    }
+
+    candidate->sum_disapproval = sum_disapproval;
+    candidate->hitler = hitler;
+}
+
+void compute_election_statistics(unsigned plan,
+                                 unsigned num_issues,
                                  size_t num_candidates,
                                  unsigned *stance_poll,
                                  unsigned *hitler_table,
@@ -110,22 +198,329 @@ void compute_election_statistics(unsigned num_issues,
     size_t i;
     for(i = 0; i < num_candidates; i++){        
         // compute candidate disapproval statistics
+        if(plan & STAGE_LEANING){
+            compute_candidate_statistics(num_issues,
+                                         num_candidates,
+                                         candidates+i,
+                                         candidates);
+        }else if(plan & (STAGE_DISAPPROVAL | STAGE_HITLER)){
+            compute_planned_statistics(plan,
+                                       num_candidates,
+                                       candidates+i,
+                                       candidates);
+        }
+        // record "hitler" votes
+        if(plan & (STAGE_HITLER | STAGE_HITLER_TABLE)){
+            hitler_table[candidates[i].hitler] += candidates[i].votes;
+        }
+
+        // tally up number of voters with stance=1 for respective issues
+        if(plan & STAGE_WASHINGTON){
+            unsigned w;
+            for(w = 0; w < num_issues; w++){
+                unsigned stance = ((candidates[i].id)>>w) & 0x1;
+                stance_poll[w] += stance * candidates[i].votes;
+            }
+        }
+    }
+}
+
+void find_election_winners(unsigned plan,
+                           size_t num_candidates,
+                           size_t *num_a_winners,
+                           size_t *num_h_winners,
+                           size_t *num_winners,
+                           unsigned *hitler_table,
+                           Candidate *candidates,
+                           Candidate **elected,
+                           Candidate **elected_a,
+                           Candidate **elected_h){
+    *num_winners = 0;
+    *num_a_winners = 0;
+    *num_h_winners = 0;
+    size_t i;
+    // traditional election winners lead the sorted candidates
+    if(plan & STAGE_TRADITIONAL){
+        elected[(*num_winners)++] = candidates;
+        for(i = 1; i < num_candidates && candidates[i].votes == candidates[0].votes; i++){
+            elected[(*num_winners)++] = candidates+i;
+        }
+    }
+    if(plan & STAGE_APPROVAL){
+        elected_a[(*num_a_winners)++] = candidates;
+    }
+    if(plan & STAGE_HITLER_ELECTION){
+        elected_h[(*num_h_winners)++] = candidates;
+    }
+    for(i = 1; i < num_candidates; i++){
+        // approval winners
+        if(plan & STAGE_APPROVAL){
+            if(candidates[i].sum_disapproval < elected_a[0]->sum_disapproval){
+                elected_a[0] = candidates+i;
+                *num_a_winners = 1;
+            }else if(candidates[i].sum_disapproval == elected_a[0]->sum_disapproval){
+                elected_a[(*num_a_winners)++] = candidates+i;
+            }
+        }
+        // hitler election winners
+        if(plan & STAGE_HITLER_ELECTION){
+            if(hitler_table[candidates[i].id] < hitler_table[elected_h[0]->id]){
+                elected_h[0] = candidates+i;
+                *num_h_winners = 1;
+            }else if(hitler_table[candidates[i].id] == hitler_table[elected_h[0]->id]){
+                elected_h[(*num_h_winners)++] = candidates+i;
+            }
+        }
+    }
+}
+
+void find_washington_candidate(unsigned plan,
+                               unsigned population_size,
+                               unsigned num_issues,
+                               size_t num_candidates,
+                               unsigned *stance_poll,
+                               Candidate *candidates,
+                               Candidate *washington){
+    washington->id = 0;
+    unsigned i;
+    for(i = 0; i < num_issues; i++){
+        size_t stance_0 = population_size - stance_poll[i];
+        // NOTE: slight bias toward stance=1 when population size is even
+        if(stance_poll[i] >= stance_0){
+            washington->id += 1<<i;
+        }
+    }
+
+    // compute statistics for washington candidate
+    if(plan & STAGE_WASHINGTON_STATISTICS){
         compute_candidate_statistics(num_issues,
                                      num_candidates,
-                                     candidates+i,
+                                     washington,
                                      candidates);
-        // record "hitler" votes
-        hitler_table[candidates[i].hitler] += candidates[i].votes;
+    }
+}
 
-        // tally up number of voters with stance=1 for respective issues
-        unsigned w;
-        for(w = 0; w < num_issues; w++){
-            unsigned stance = ((candidates[i].id)>>w) & 0x1;
-            stance_poll[w] += stance * candidates[i].votes;
+void perform_two_party_election(size_t num_candidates,
+                                Candidate *candidates,
+                                Candidate *status_quo){
+    status_quo[0] = candidates[0];
+    status_quo[1] = candidates[1];
+    status_quo[0].votes = 0;
+    status_quo[1].votes = 0;
+    // record votes
+    size_t i;
+    for(i = 0; i < num_candidates; i++){
+        unsigned disapproval_0 = hamming_weight((status_quo[0].id)^(candidates[i].id));
+        unsigned disapproval_1 = hamming_weight((status_quo[1].id)^(candidates[i].id));
+
+        // if disapproval values are equal, then votes aren't counted
+        if(disapproval_0 < disapproval_1){
+            status_quo[0].votes += candidates[i].votes;
+        }else if(disapproval_0 > disapproval_1){
+            status_quo[1].votes += candidates[i].votes;
+        }
+    }
+    // sort two-party system candidates
+    qsort(status_quo, 2, sizeof(*status_quo), sort_candidates);
+}
+
+/*
+ * A pass of the election kernels over the candidates, with the partial
+ * sums of each thread; the partials are added in thread order, so the
+ * results never depend on how the candidates were split.
+ */
+typedef struct{
+    unsigned plan;
+    size_t num_candidates;
+    Candidate *candidates;
+    const ElectionKernels *kernels;
+    unsigned partials[WORKER_MAX_THREADS][WORKER_PARTIALS];
+} ElectionPass;
+
+static void statistics_pass(size_t first, size_t last, unsigned thread, void *argument){
+    ElectionPass *pass = argument;
+    (void)thread;
+    pass->kernels->statistics(pass->plan, first, last, pass->num_candidates, pass->candidates);
+}
+
+static void stance_pass(size_t first, size_t last, unsigned thread, void *argument){
+    ElectionPass *pass = argument;
+    pass->kernels->stance_tally(first, last, pass->partials[thread], pass->candidates);
+}
+
+static void two_party_pass(size_t first, size_t last, unsigned thread, void *argument){
+    ElectionPass *pass = argument;
+    pass->kernels->two_party(first, last, pass->candidates, pass->partials[thread]);
+}
+
+/*
+ * Runs a pass accumulating num_partials partial sums into sums.
+ */
+static void run_partial_pass(size_t cost,
+                             size_t num_partials,
+                             unsigned *sums,
+                             WorkerJob job,
+                             ElectionPass *pass,
+                             WorkerPool *pool){
+    unsigned num_threads = worker_pool_size(pool);
+    memset(pass->partials, 0, sizeof(pass->partials[0]) * num_threads);
+    worker_pool_run(pass->num_candidates, cost, job, pass, pool);
+
+    unsigned t;
+    size_t k;
+    for(t = 0; t < num_threads; t++){
+        for(k = 0; k < num_partials; k++){
+            sums[k] += pass->partials[t][k];
+        }
+    }
+}
+
+void decide_election(unsigned plan,
+                     unsigned population_size,
+                     unsigned num_issues,
+                     size_t num_candidates,
+                     size_t *num_a_winners,
+                     size_t *num_h_winners,
+                     size_t *num_winners,
+                     unsigned *stance_poll,
+                     unsigned *hitler_table,
+                     Candidate *candidates,
+                     Candidate *washington,
+                     Candidate *status_quo,
+                     Candidate **elected,
+                     Candidate **elected_a,
+                     Candidate **elected_h,
+                     const ElectionKernels *kernels,
+                     WorkerPool *pool){
+    size_t i;
+    // initialize hitler table
+    if(plan & (STAGE_HITLER | STAGE_HITLER_TABLE)){
+        for(i = 0; i < num_candidates; i++){
+            hitler_table[candidates[i].id] = 0;
+        }
+    }
+    // initialize washington platform
+    for(i = 0; i < num_issues; i++){
+        stance_poll[i] = 0;
+    }
+
+    // compute election statistics
+    ElectionPass pass;
+    pass.plan = plan;
+    pass.num_candidates = num_candidates;
+    pass.candidates = candidates;
+    pass.kernels = kernels;
+    if(kernels){
+        // every candidate is compared with every other
+        worker_pool_run(num_candidates, num_candidates, statistics_pass, &pass, pool);
+        if(plan & (STAGE_HITLER | STAGE_HITLER_TABLE)){
+            for(i = 0; i < num_candidates; i++){
+                hitler_table[candidates[i].hitler] += candidates[i].votes;
+            }
+        }
+        if(plan & STAGE_WASHINGTON){
+            run_partial_pass(num_issues, num_issues, stance_poll, stance_pass, &pass, pool);
+        }
+    }else{
+        compute_election_statistics(plan,
+                                    num_issues,
+                                    num_candidates,
+                                    stance_poll,
+                                    hitler_table,
+                                    candidates);
+    }
+    // sort candidates by lowest disapproval rating
+    if(plan & STAGE_SORT){
+        qsort(candidates, num_candidates, sizeof(*candidates), sort_candidates);
+    }
+
+    // find election winners
+    find_election_winners(plan,
+                          num_candidates,
+                          num_a_winners,
+                          num_h_winners,
+                          num_winners,
+                          hitler_table,
+                          candidates,
+                          elected,
+                          elected_a,
+                          elected_h);
+
+    // find washington candidate
+    if(plan & STAGE_WASHINGTON){
+        find_washington_candidate(plan,
+                                  population_size,
+                                  num_issues,
+                                  num_candidates,
+                                  stance_poll,
+                                  candidates,
+                                  washington);
+    }
+
+    // perform two-party system election
+    if(plan & STAGE_TWO_PARTY){
+        if(kernels){
+            unsigned votes[2] = {0, 0};
+            run_partial_pass(2, 2, votes, two_party_pass, &pass, pool);
+
+            // order the two parties as sort_candidates does, keeping the
+            // original order on a tie
+            size_t first = votes[1] > votes[0];
+            status_quo[0] = candidates[first];
+            status_quo[0].votes = votes[first];
+            status_quo[1] = candidates[!first];
+            status_quo[1].votes = votes[!first];
+        }else{
+            perform_two_party_election(num_candidates,
+                                       candidates,
+                                       status_quo);
         }
     }
 }
 
+int swap_map_init(size_t pool_size, SwapMap *swaps){
+    // a shuffle touches at most every position of the pool, so the map
+    // stays at most half full
+    swaps->mask = 1;
+    swaps->shift = 31;
+    while(swaps->mask < 2*pool_size - 1){
+        swaps->mask = 2*swaps->mask + 1;
+        swaps->shift--;
+    }
+    swaps->epoch = 0;
+    swaps->slots = calloc(swaps->mask + 1, sizeof(*swaps->slots));
+    return swaps->slots ? 0 : -1;
+}
+
+void swap_map_free(SwapMap *swaps){
+    free(swaps->slots);
+    swaps->slots = NULL;
+}
+
+/*
+ * Returns the slot of a position: either the slot written for it in
+ * the current election, or the free slot where it belongs.
+ */
+static SwapSlot *swap_slot(size_t position, SwapMap *swaps){
+    size_t s = ((unsigned)position * 2654435761U) >> swaps->shift;
+    while(swaps->slots[s].stamp == swaps->epoch && swaps->slots[s].position != position){
+        s = (s + 1) & swaps->mask;
+    }
+    return swaps->slots + s;
+}
+
+static size_t swap_lookup(size_t position, SwapMap *swaps){
+    SwapSlot *slot = swap_slot(position, swaps);
+    return (slot->stamp == swaps->epoch) ? slot->id : position;
+}
+
+static void swap_store(size_t position, size_t id, SwapMap *swaps){
+    SwapSlot *slot = swap_slot(position, swaps);
+    slot->stamp = swaps->epoch;
+    slot->position = position;
+    slot->id = id;
+}
+
 /*
  * for most cases:
  * voters_left = population_size
@@ -133,22 +528,33 @@ void compute_election_statistics(unsigned num_issues,
 void perform_election(unsigned voters_left,
                       size_t pool_size,
                       size_t *num_candidates,
-                      Candidate *candidates){
+                      Candidate *candidates,
+                      Sampler *sampler,
+                      SwapMap *swaps){
     *num_candidates = 0;
+    sampler_begin_election(sampler);
+
+    // a new epoch restores the identity shuffle
+    if(!++swaps->epoch){
+        memset(swaps->slots, 0, sizeof(*swaps->slots) * (swaps->mask + 1));
+        swaps->epoch = 1;
+    }
     
     // Fisher-Yates shuffle
     unsigned i;
     for(i = 0; voters_left && i < pool_size-1; i++){
         // select candidate index
-        size_t grab = rand_ceiling(pool_size-i) + i;
+        size_t grab = sampler_draw(pool_size-i, sampler) + i;
 
         // swap out candidate
-        size_t toss = candidates[*num_candidates].id;
-        candidates[*num_candidates].id = candidates[grab].id;
-        candidates[grab].id = toss;
+        size_t toss = swap_lookup(*num_candidates, swaps);
+        size_t pick = swap_lookup(grab, swaps);
+        swap_store(grab, toss, swaps);
+        swap_store(*num_candidates, pick, swaps);
+        candidates[*num_candidates].id = pick;
 
         // allocate voters
-        unsigned votes = rand_ceiling(voters_left+1);
+        unsigned votes = sampler_draw(voters_left+1, sampler);
         // check if candidate got any votes
         if(votes){
             // allocate votes to candidate
@@ -160,18 +566,32 @@ void perform_election(unsigned voters_left,
     }
     // take care of any trailing voters
     if(voters_left){
-        candidates[*num_candidates].id = candidates[pool_size-1].id;
+        candidates[*num_candidates].id = swap_lookup(pool_size-1, swaps);
         candidates[*num_candidates].votes = voters_left;
         // record new candidate
         (*num_candidates)++;
     }
+    // the two-party system election always draws a second platform
+    if(*num_candidates == 1){
+        candidates[1].id = swap_lookup(1, swaps);
+    }
+}
+
+int sort_candidates(const void *a, const void *b){
+    if(((Candidate*)a)->votes > ((Candidate*)b)->votes){
+        return -1;
+    }else if(((Candidate*)a)->votes < ((Candidate*)b)->votes){
+        return 1;
+    }
+    return 0;
 }
 
 void print_candidate_statistics(unsigned population_size,
                                 unsigned num_issues,
                                 char *prefix,
                                 unsigned *hitler_table,
-                                Candidate *candidate){
+                                Candidate *candidate,
+                                FILE *stream){
     char buffer[6];
     // check pro-contra ratio for division by zero
     if(candidate->pro > candidate->contra){
@@ -187,10 +607,10 @@ void print_candidate_statistics(unsigned population_size,
     double medius_percentage = (double)(candidate->medius)/population_size;
 
     // print candidate statistics
-    printf("%s%zu: %2.2lf%% (%s %.2lf) [%zu] %u %u\n", prefix, candidate->id,
-                                                    approval, buffer, medius_percentage,
-                                                    candidate->hitler, candidate->votes,
-                                                    hitler_table[candidate->id]);
+    fprintf(stream, "%s%zu: %2.2lf%% (%s %.2lf) [%zu] %u %u\n", prefix, candidate->id,
+                                                             approval, buffer, medius_percentage,
+                                                             candidate->hitler, candidate->votes,
+                                                             hitler_table[candidate->id]);
 }
 
 void print_election_statistics(unsigned population_size,
@@ -202,42 +622,44 @@ void print_election_statistics(unsigned population_size,
                                unsigned *hitler_table,
                                Candidate *candidates,
                                Candidate *washington,
+                               const MinimaxPlatform *minimax,
                                Candidate *status_quo,
                                Candidate **elected,
                                Candidate **elected_a,
-                               Candidate **elected_h){
+                               Candidate **elected_h,
+                               FILE *stream){
     char buffer[16];
     size_t i;
     // report traditional election statistics
     for(i = 0; i < num_candidates; i++){
-        print_candidate_statistics(population_size, num_issues, "", hitler_table, candidates+i);
+        print_candidate_statistics(population_size, num_issues, "", hitler_table, candidates+i, stream);
     }
     
-    printf("\n----------------------------------------------------------------------\n");
+    fprintf(stream, "\n----------------------------------------------------------------------\n");
 
     // report traditional election winners
-    printf("\nTraditional Election Winners:\n");
+    fprintf(stream, "\nTraditional Election Winners:\n");
     for(i = 0; i < num_winners; i++){
         sprintf(buffer, "  %zu) ", i+1);
-        print_candidate_statistics(population_size, num_issues, buffer, hitler_table, elected[i]);
+        print_candidate_statistics(population_size, num_issues, buffer, hitler_table, elected[i], stream);
     }
     
     // report approval winners
-    printf("\nApproval Winners: \n");
+    fprintf(stream, "\nApproval Winners: \n");
     for(i = 0; i < num_a_winners; i++){
         sprintf(buffer, "  %zu) ", i+1);
-        print_candidate_statistics(population_size, num_issues, buffer, hitler_table, elected_a[i]);
+        print_candidate_statistics(population_size, num_issues, buffer, hitler_table, elected_a[i], stream);
     }
 
     // report hitler election winners
-    printf("\nHitler Election Winners:\n");
+    fprintf(stream, "\nHitler Election Winners:\n");
     for(i = 0; i < num_h_winners; i++){
         sprintf(buffer, "  %zu) ", i+1);
-        print_candidate_statistics(population_size, num_issues, buffer, hitler_table, elected_h[i]);
+        print_candidate_statistics(population_size, num_issues, buffer, hitler_table, elected_h[i], stream);
     }
 
     // report washington candidate statistics
-    printf("\nWashington Candidate: \n");
+    fprintf(stream, "\nWashington Candidate: \n");
     // check pro-contra ratio for division by zero
     if(washington->pro > washington->contra){
         sprintf(buffer, "P%.2lf", (double)(washington->pro - washington->contra)/population_size);
@@ -255,12 +677,24 @@ void print_election_statistics(unsigned population_size,
     double approval = (1.0-(washington->sum_disapproval/MAX_SUM_DISAPPROVAL))*100;
     double medius_percentage = (double)(washington->medius)/population_size;
     // print washington statistics
-    printf("   > %zu: %2.2lf%% (%s %.2lf) [%zu]{%zu}\n", washington->id,
-                                                         approval, buffer, medius_percentage,
-                                                         washington->hitler, true_whitler);
+    fprintf(stream, "   > %zu: %2.2lf%% (%s %.2lf) [%zu]{%zu}\n", washington->id,
+                                                                  approval, buffer, medius_percentage,
+                                                                  washington->hitler, true_whitler);
+
+    // report the platform closest to the farthest voter group
+    if(minimax){
+        fprintf(stream, "\nMinimax Platform: \n");
+        fprintf(stream, "   > %zu: %u of %u issues from the farthest voter group", minimax->id,
+                minimax->distance, num_issues);
+        if(minimax->lower_bound < minimax->distance){
+            fprintf(stream, " (gap %u over the bound %u; time budget reached)",
+                    minimax->distance - minimax->lower_bound, minimax->lower_bound);
+        }
+        fputc('\n', stream);
+    }
     
     // report two-party system statistics
-    printf("\nTwo-Party System Election: \n");
+    fprintf(stream, "\nTwo-Party System Election: \n");
     for(i = 0; i < 2; i++){
         // check pro-contra ratio for division by zero
         if(status_quo[i].pro > status_quo[i].contra){
@@ -275,10 +709,10 @@ void print_election_statistics(unsigned population_size,
         medius_percentage = (double)(status_quo[i].medius)/population_size;
         double vote_ratio = (double)(status_quo[i].votes)/population_size;
         // print status quo candidate statistics
-        printf("  %zu) %zu: %2.2lf%% (%s %.2lf) %u %.2lf\n", i+1, status_quo[i].id,
-                                                              approval, buffer, medius_percentage,
-                                                              status_quo[i].votes, vote_ratio);
+        fprintf(stream, "  %zu) %zu: %2.2lf%% (%s %.2lf) %u %.2lf\n", i+1, status_quo[i].id,
+                                                                       approval, buffer, medius_percentage,
+                                                                       status_quo[i].votes, vote_ratio);
     }
 
-    printf("\n----------------------------------------------------------------------\n");
+    fprintf(stream, "\n----------------------------------------------------------------------\n");
 }
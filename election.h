@@ -53,6 +53,12 @@
 #ifndef ELECTION_H
 #define ELECTION_H
 
+#include <stddef.h>
+#include <stdio.h>
+
+#include "sampling.h"
+#include "workers.h"
+
 /**
  * Represents a candidate in an election.
  */
@@ -72,6 +78,188 @@ typedef struct{
                     candidate */
 } Candidate;
 
+/**
+ * Platform of the whole pool minimizing the largest disagreement with
+ * any voter group, as found by decide_minimax_election.
+ */
+typedef struct{
+    size_t id; /**< id of the platform */
+    unsigned distance; /**< largest distance from the platform to a
+                            voter group */
+    unsigned lower_bound; /**< proven lower bound on the least largest
+                               distance of any platform; distance itself
+                               when the platform is optimal */
+    unsigned long num_nodes; /**< partial platforms searched */
+} MinimaxPlatform;
+
+/**
+ * Slot of a SwapMap.
+ */
+typedef struct{
+    unsigned stamp; /**< epoch in which the slot was written */
+    unsigned position; /**< position in the shuffled pool */
+    unsigned id; /**< id of the candidate at the position */
+} SwapSlot;
+
+/**
+ * Sparse view of the pool shuffled by perform_election: the positions
+ * touched by the shuffle map to their candidate ids, while every other
+ * position still holds its own id. Slots written in earlier elections
+ * are told apart by their stamp, so the map is never cleared.
+ */
+typedef struct{
+    size_t mask; /**< number of slots less one; a power of two less
+                      one */
+    unsigned shift; /**< shift of the multiplicative hash */
+    unsigned epoch; /**< stamp of the current election */
+    SwapSlot *slots; /**< open-addressing slots */
+} SwapMap;
+
+/**
+ * Largest number of issues with specialized election kernels.
+ */
+#define KERNEL_MAX_ISSUES 15
+
+/**
+ * Election kernels specialized for a number of issues, so that loops
+ * over the issues unroll, the thresholds of the pro-contra ratio are
+ * constants, and distances are a single Hamming weight lookup.
+ *
+ * Each kernel works on the candidates [first, last) only, so that the
+ * candidates of an election can be split between threads.
+ *
+ * @sa election_kernels
+ */
+typedef struct{
+    /**
+     * Computes the planned statistics of the candidates against every
+     * candidate, like compute_candidate_statistics; the hitler table
+     * is left to the caller.
+     */
+    void (*statistics)(unsigned plan,
+                       size_t first,
+                       size_t last,
+                       size_t num_candidates,
+                       Candidate *candidates);
+    /**
+     * Adds the voters of the candidates with a stance of 1 on each
+     * issue to stance_poll.
+     */
+    void (*stance_tally)(size_t first,
+                         size_t last,
+                         unsigned *stance_poll,
+                         const Candidate *candidates);
+    /**
+     * Adds the votes of the candidates for the two-party system
+     * candidates, candidates[0] and candidates[1], to votes[0] and
+     * votes[1], like perform_two_party_election.
+     */
+    void (*two_party)(size_t first,
+                      size_t last,
+                      const Candidate *candidates,
+                      unsigned *votes);
+} ElectionKernels;
+
+/**
+ * Election methods; a set of methods is a bitmask with bit m set when
+ * method m is in the set.
+ */
+typedef enum{
+    METHOD_TRADITIONAL,
+    METHOD_APPROVAL,
+    METHOD_HITLER,
+    METHOD_TWO_PARTY,
+    METHOD_WASHINGTON,
+    METHOD_IRV,
+    NUM_METHODS
+} Method;
+
+/**
+ * Set of every election method.
+ */
+#define ALL_METHODS ((1U << NUM_METHODS) - 1)
+
+/**
+ * Set of the election methods decided unless others are requested:
+ * every method but instant-runoff.
+ */
+#define DEFAULT_METHODS (ALL_METHODS & ~(1U << METHOD_IRV))
+
+/**
+ * Stages of decide_election; a plan is a bitmask of the stages to run.
+ *
+ * @sa plan_election
+ */
+typedef enum{
+    STAGE_SORT = 1<<0, /**< sort candidates by descending votes */
+    STAGE_DISAPPROVAL = 1<<1, /**< sum of disapproval of every candidate */
+    STAGE_HITLER = 1<<2, /**< hitler of every candidate and the hitler
+                              table */
+    STAGE_LEANING = 1<<3, /**< pro, contra, and medius of every
+                               candidate */
+    STAGE_TRADITIONAL = 1<<4, /**< traditional election winners */
+    STAGE_APPROVAL = 1<<5, /**< approval winners */
+    STAGE_HITLER_ELECTION = 1<<6, /**< hitler election winners */
+    STAGE_TWO_PARTY = 1<<7, /**< two-party system election */
+    STAGE_WASHINGTON = 1<<8, /**< washington candidate */
+    STAGE_WASHINGTON_STATISTICS = 1<<9, /**< statistics of the washington
+                                             candidate */
+    STAGE_IRV = 1<<10, /**< instant-runoff election; run by the caller
+                            after decide_election */
+    STAGE_HITLER_TABLE = 1<<11 /**< hitler table only, from the hitler of
+                                    every candidate set by the caller */
+} Stage;
+
+/**
+ * Plan running every stage of decide_election itself.
+ */
+#define ALL_STAGES ((1U << 10) - 1)
+
+/**
+ * Returns the election kernels specialized for a number of issues.
+ *
+ * @param num_issues number of issues in the election
+ *
+ * @return pointer to the kernels, or NULL if num_issues exceeds
+ *         KERNEL_MAX_ISSUES
+ */
+const ElectionKernels *election_kernels(unsigned num_issues);
+
+/**
+ * Returns the name of an election method.
+ *
+ * @param method the election method
+ *
+ * @return the name of the method (e.g. "two_party")
+ */
+const char *method_name(Method method);
+
+/**
+ * Parses a comma-separated list of election method names.
+ *
+ * @param list the list of names
+ * @param methods pointer to the set of methods
+ *
+ * @return 0 on success, -1 if a name is unknown or the list is empty
+ *
+ * @sa method_name
+ */
+int parse_methods(const char *list, unsigned *methods);
+
+/**
+ * Plans the stages of decide_election needed for a set of outputs: the
+ * winners of the requested methods and, when candidate_statistics is
+ * set, the full statistics of every candidate and the washington
+ * candidate (as printed by print_election_statistics). Instant-runoff
+ * is only planned when requested.
+ *
+ * @param candidate_statistics whether the full statistics are needed
+ * @param methods set of election methods whose winners are needed
+ *
+ * @return the plan, a bitmask of Stage values
+ */
+unsigned plan_election(unsigned candidate_statistics, unsigned methods);
+
 /**
  * Populates a Candidate structure.
  *
@@ -92,6 +280,8 @@ void compute_candidate_statistics(unsigned num_issues,
 /**
  * Computes election statistics.
  *
+ * @param plan bitmask of Stage values; only the statistics of the
+ *             planned stages are computed
  * @param num_issues number of issues in the election
  * @param num_candidates number of candidates
  * @param stance_poll array containing average voter stance on election
@@ -102,38 +292,204 @@ void compute_candidate_statistics(unsigned num_issues,
  * @return stance_poll array, hitler_table array, and candidates in
  *         candidates array are populated
  */
-void compute_election_statistics(unsigned num_issues,
+void compute_election_statistics(unsigned plan,
+                                 unsigned num_issues,
                                  size_t num_candidates,
                                  unsigned *stance_poll,
                                  unsigned *hitler_table,
                                  Candidate *candidates);
 
+/**
+ * Finds the traditional election, approval, and hitler election winners.
+ *
+ * Methods left out of the plan get no winners.
+ *
+ * @param plan bitmask of Stage values
+ * @param num_candidates number of candidates
+ * @param num_a_winners pointer to the variable to hold the number of
+ *                      approval winners
+ * @param num_h_winners pointer to the variable to hold the number of
+ *                      hitler election winners
+ * @param num_winners pointer to the variable to hold the number of
+ *                    traditional election winners
+ * @param hitler_table array of votes in hitler election method
+ * @param candidates array of candidates; sorted by descending votes
+ *                   if the traditional election is planned
+ * @param elected array to hold pointers to traditional election winners
+ * @param elected_a array to hold pointers to approval winners
+ * @param elected_h array to hold pointers to hitler election winners
+ */
+void find_election_winners(unsigned plan,
+                           size_t num_candidates,
+                           size_t *num_a_winners,
+                           size_t *num_h_winners,
+                           size_t *num_winners,
+                           unsigned *hitler_table,
+                           Candidate *candidates,
+                           Candidate **elected,
+                           Candidate **elected_a,
+                           Candidate **elected_h);
+
+/**
+ * Finds the washington candidate and computes its statistics.
+ *
+ * @param plan bitmask of Stage values; the statistics are only
+ *             computed under STAGE_WASHINGTON_STATISTICS
+ * @param population_size number of voters in the election
+ * @param num_issues number of issues in the election
+ * @param num_candidates number of candidates
+ * @param stance_poll array containing average voter stance on election
+ *                    issues
+ * @param candidates array of candidates
+ * @param washington pointer to the washington candidate
+ *
+ * @return Candidate structure pointed by washington is populated
+ */
+void find_washington_candidate(unsigned plan,
+                               unsigned population_size,
+                               unsigned num_issues,
+                               size_t num_candidates,
+                               unsigned *stance_poll,
+                               Candidate *candidates,
+                               Candidate *washington);
+
+/**
+ * Perform two-party system election between the two candidates with the
+ * most votes.
+ *
+ * @param num_candidates number of candidates
+ * @param candidates array of candidates sorted by descending votes
+ * @param status_quo array to hold the two-party system candidates
+ *                   sorted by descending two-party system votes
+ */
+void perform_two_party_election(size_t num_candidates,
+                                Candidate *candidates,
+                                Candidate *status_quo);
+
+/**
+ * Computes the statistics of an allocated election and decides the
+ * winners of the planned election methods.
+ *
+ * @param plan bitmask of Stage values, usually from plan_election
+ * @param population_size number of voters in the election
+ * @param num_issues number of issues in the election
+ * @param num_candidates number of candidates
+ * @param num_a_winners pointer to the variable to hold the number of
+ *                      approval winners
+ * @param num_h_winners pointer to the variable to hold the number of
+ *                      hitler election winners
+ * @param num_winners pointer to the variable to hold the number of
+ *                    traditional election winners
+ * @param stance_poll array to hold average voter stance on election
+ *                    issues
+ * @param hitler_table array to hold votes in hitler election method
+ * @param candidates array of candidates returned by perform_election;
+ *                   sorted by descending votes on return if STAGE_SORT
+ *                   is planned
+ * @param washington pointer to the washington candidate
+ * @param status_quo array to hold the two-party system candidates
+ * @param elected array to hold pointers to traditional election winners
+ * @param elected_a array to hold pointers to approval winners
+ * @param elected_h array to hold pointers to hitler election winners
+ * @param kernels pointer to the kernels specialized for num_issues, or
+ *                NULL for the generic functions
+ * @param pool pointer to the worker pool splitting the kernels between
+ *             threads, or NULL; the results do not depend on the pool
+ *
+ * @sa election_kernels
+ */
+void decide_election(unsigned plan,
+                     unsigned population_size,
+                     unsigned num_issues,
+                     size_t num_candidates,
+                     size_t *num_a_winners,
+                     size_t *num_h_winners,
+                     size_t *num_winners,
+                     unsigned *stance_poll,
+                     unsigned *hitler_table,
+                     Candidate *candidates,
+                     Candidate *washington,
+                     Candidate *status_quo,
+                     Candidate **elected,
+                     Candidate **elected_a,
+                     Candidate **elected_h,
+                     const ElectionKernels *kernels,
+                     WorkerPool *pool);
+
+/**
+ * Initializes a SwapMap structure for a pool of candidates.
+ *
+ * @param pool_size number of possible candidates
+ * @param swaps pointer to the swap map
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int swap_map_init(size_t pool_size, SwapMap *swaps);
+
+/**
+ * Releases the memory held by a SwapMap structure.
+ *
+ * @param swaps pointer to the swap map
+ */
+void swap_map_free(SwapMap *swaps);
+
 /**
  * Perform traditional election.
  *
+ * The pool is shuffled sparsely through the swap map, starting from
+ * the identity every election, so the cost of an election scales with
+ * its draws rather than with the pool size.
+ *
  * @param voters_left number of voters who have not yet voted
  * @param pool_size number of possible candidates
  * @param num_candidates pointer to the variable holding the number of
  *                       actual candidates
- * @param candidates array to hold actual candidates
+ * @param candidates array to hold actual candidates; when there is a
+ *                   single actual candidate, the id of the candidate
+ *                   following it is set too, for the two-party system
+ *                   election
+ * @param sampler pointer to the sampler supplying the random draws
+ * @param swaps pointer to the swap map of the pool
  *
  * @return candidates array is populated and the number of actual
  *         candidates is stored in the variable pointed by
  *         num_candidates
+ *
+ * @sa Sampler
  */
 void perform_election(unsigned voters_left,
                       size_t pool_size,
                       size_t *num_candidates,
-                      Candidate *candidates);
+                      Candidate *candidates,
+                      Sampler *sampler,
+                      SwapMap *swaps);
+
+/**
+ * Compares Candidate structures by greatest number of votes; for use in
+ * the standard C library qsort function.
+ *
+ * @param a Candidate structure for comparison
+ * @param b Candidate structure for comparison
+ *
+ * @return the relative sorting of the two Candidate structures
+ *
+ * @retval -1 a comes before b
+ * @retval 0 a and b match in ranking
+ * @retval 1 a comes after b
+ *
+ * @sa qsort
+ */
+int sort_candidates(const void *a, const void *b);
 
 /**
- * Print candidate statistics to stdout.
+ * Print candidate statistics to a stream.
  *
  * @param population_size number of voters in the election
  * @param num_issues number of issues in the election
  * @param prefix string prefix for output line
  * @param hitler_table array of votes in hitler election method
  * @param candidate pointer to a candidate
+ * @param stream output stream
  *
  * @sa Candidate
  */
@@ -141,10 +497,11 @@ void print_candidate_statistics(unsigned population_size,
                                 unsigned num_issues,
                                 char *prefix,
                                 unsigned *hitler_table,
-                                Candidate *candidate);
+                                Candidate *candidate,
+                                FILE *stream);
 
 /**
- * Print election statistics to stdout.
+ * Print election statistics to a stream.
  *
  * @param population_size number of voters in the election
  * @param num_issues number of issues in the election
@@ -155,11 +512,14 @@ void print_candidate_statistics(unsigned population_size,
  * @param hitler_table array of votes in hitler election method
  * @param candidates array of candidates
  * @param washington pointer to washington candidate
+ * @param minimax pointer to the minimax platform, printed after the
+ *                washington candidate, or NULL if it was not searched
  * @param status_quo array holding traditional election winner and
  *                   runner-up
  * @param elected array of pointers to traditional election winners
  * @param elected_a array of pointers to approval winners
  * @param elected_h array of pointers to hitler election winners
+ * @param stream output stream
  */
 void print_election_statistics(unsigned population_size,
                                unsigned num_issues,
@@ -170,9 +530,11 @@ void print_election_statistics(unsigned population_size,
                                unsigned *hitler_table,
                                Candidate *candidates,
                                Candidate *washington,
+                               const MinimaxPlatform *minimax,
                                Candidate *status_quo,
                                Candidate **elected,
                                Candidate **elected_a,
-                               Candidate **elected_h);
+                               Candidate **elected_h,
+                               FILE *stream);
 
 #endif
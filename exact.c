@@ -0,0 +1,636 @@
+/*======================================================================
+ *                                exact.c
+ *======================================================================
+ * Exact enumeration of the vote allocations of small elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Exact enumeration of the vote allocations of small elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "election.h"
+#include "exact.h"
+#include "summary.h"
+
+/*
+ * The vote draws of perform_election do not depend on its candidate
+ * draws, and the candidate draws only depend on the pattern of zero and
+ * nonzero vote draws. Every vote draw sequence is therefore enumerated
+ * first and grouped by pattern; each pattern's candidate draws are then
+ * walked once, and the resulting platform tuples are crossed with the
+ * pattern's vote sequences.
+ *
+ * The shuffle of perform_election swaps through the front of the
+ * candidates array, which makes its platform tuples depend on the
+ * initial ordering of the pool; the tuples are thus not symmetric under
+ * relabelling. The election methods are, however, invariant under any
+ * permutation of the issues, so tuples are reduced to a canonical
+ * representative of their orbit before the elections are evaluated.
+ */
+
+/*
+ * A sequence of vote draws.
+ */
+typedef struct{
+    size_t steps; // number of draws
+    uint64_t flags; // bit i set when draw i was nonzero
+    unsigned trailing; // trailing voters form one more candidate
+    size_t num_parts; // number of actual candidates
+    size_t offset; // offset of the votes of each candidate
+    double probability;
+} VoteSequence;
+
+typedef struct{
+    unsigned population_size;
+    unsigned num_issues;
+    size_t pool_size;
+    unsigned plan; // only the winners are needed
+    const ElectionKernels *kernels;
+    int failed;
+
+    // vote draw sequences
+    VoteSequence *sequences;
+    size_t num_sequences;
+    size_t max_sequences;
+    unsigned *parts;
+    size_t num_parts;
+    size_t max_parts;
+    unsigned *draws;
+
+    // candidate draws of the current pattern
+    const VoteSequence *pattern;
+    size_t *arrangement;
+    size_t *labels;
+    size_t *canonical;
+    size_t num_permutations;
+    size_t *permutations;
+
+    // orbits of the current pattern
+    size_t orbit_length;
+    size_t orbit_capacity;
+    size_t num_orbits;
+    size_t *orbit_keys;
+    double *orbit_mass;
+
+    // evaluation buffers
+    Candidate *candidates;
+    unsigned *hitler_table;
+    unsigned *stance_poll;
+    Candidate **elected;
+    Candidate **elected_a;
+    Candidate **elected_h;
+
+    ExactResult *result;
+} ExactWalk;
+
+static double choose(double n, double k){
+    if(k < 0 || k > n){
+        return 0;
+    }
+    double c = 1;
+    double i;
+    for(i = 0; i < k; i++){
+        c = c*(n-i)/(i+1);
+    }
+    return c;
+}
+
+static double falling(double n, double k){
+    double f = 1;
+    double i;
+    for(i = 0; i < k; i++){
+        f *= n-i;
+    }
+    return f;
+}
+
+double exact_state_space(unsigned population_size, unsigned num_issues){
+    double pool = (double)((size_t)1 << num_issues);
+    double symmetry = falling(num_issues, num_issues);
+    double states = 0;
+    double t, k;
+    for(t = 1; t <= pool-1; t++){
+        // patterns whose last draw takes every remaining voter
+        for(k = 1; k <= t && k <= population_size; k++){
+            double patterns = choose(t-1, k-1);
+            double sequences = choose(population_size-1, k-1);
+            double orbits = falling(pool, k)/symmetry + 1;
+            states += patterns*(sequences + falling(pool, t) + orbits*sequences);
+        }
+    }
+    // patterns which run out of draws and leave trailing voters
+    t = pool-1;
+    for(k = 0; k <= t && k < population_size; k++){
+        double patterns = choose(t, k);
+        double sequences = choose(population_size-1, k);
+        double orbits = falling(pool, k+1)/symmetry + 1;
+        states += patterns*(sequences + falling(pool, t) + orbits*sequences);
+    }
+    return states;
+}
+
+static void record_sequence(ExactWalk *walk,
+                            size_t steps,
+                            unsigned voters_left,
+                            uint64_t flags,
+                            size_t num_draws,
+                            double probability){
+    size_t num_parts = num_draws + (voters_left ? 1 : 0);
+    if(walk->num_sequences == walk->max_sequences){
+        size_t max = walk->max_sequences ? 2*walk->max_sequences : 1024;
+        VoteSequence *sequences = realloc(walk->sequences, sizeof(*sequences) * max);
+        if(!sequences){
+            walk->failed = 1;
+            return;
+        }
+        walk->sequences = sequences;
+        walk->max_sequences = max;
+    }
+    if(walk->num_parts + num_parts > walk->max_parts){
+        size_t max = walk->max_parts ? 2*walk->max_parts : 4096;
+        while(max < walk->num_parts + num_parts){
+            max *= 2;
+        }
+        unsigned *parts = realloc(walk->parts, sizeof(*parts) * max);
+        if(!parts){
+            walk->failed = 1;
+            return;
+        }
+        walk->parts = parts;
+        walk->max_parts = max;
+    }
+
+    VoteSequence *sequence = walk->sequences + walk->num_sequences++;
+    sequence->steps = steps;
+    sequence->flags = flags;
+    sequence->trailing = voters_left ? 1 : 0;
+    sequence->num_parts = num_parts;
+    sequence->offset = walk->num_parts;
+    sequence->probability = probability;
+    memcpy(walk->parts + walk->num_parts, walk->draws, sizeof(*walk->draws) * num_draws);
+    if(voters_left){
+        walk->parts[walk->num_parts + num_draws] = voters_left;
+    }
+    walk->num_parts += num_parts;
+}
+
+/*
+ * Mirrors the vote draws of perform_election.
+ */
+static void enumerate_votes(ExactWalk *walk,
+                            size_t step,
+                            unsigned voters_left,
+                            uint64_t flags,
+                            size_t num_draws,
+                            double probability){
+    if(walk->failed){
+        return;
+    }
+    if(!voters_left || step >= walk->pool_size-1){
+        record_sequence(walk, step, voters_left, flags, num_draws, probability);
+        return;
+    }
+
+    probability /= voters_left+1;
+    enumerate_votes(walk, step+1, voters_left, flags, num_draws, probability);
+    unsigned votes;
+    for(votes = 1; votes <= voters_left; votes++){
+        walk->draws[num_draws] = votes;
+        enumerate_votes(walk, step+1, voters_left-votes,
+                        flags | ((uint64_t)1 << step), num_draws+1, probability);
+    }
+}
+
+static int compare_patterns(const void *a, const void *b){
+    const VoteSequence *x = a, *y = b;
+    if(x->steps != y->steps){
+        return (x->steps < y->steps) ? -1 : 1;
+    }
+    if(x->flags != y->flags){
+        return (x->flags < y->flags) ? -1 : 1;
+    }
+    if(x->trailing != y->trailing){
+        return (x->trailing < y->trailing) ? -1 : 1;
+    }
+    return 0;
+}
+
+static size_t hash_labels(const size_t *labels, size_t length){
+    size_t hash = 14695981039346656037ULL & (size_t)(-1);
+    size_t i;
+    for(i = 0; i < length; i++){
+        hash = (hash ^ labels[i]) * (size_t)1099511628211ULL;
+    }
+    return hash;
+}
+
+static int grow_orbits(ExactWalk *walk){
+    size_t capacity = walk->orbit_capacity ? 2*walk->orbit_capacity : 1024;
+    size_t *keys = malloc(sizeof(*keys) * capacity * (walk->orbit_length+1));
+    double *mass = malloc(sizeof(*mass) * capacity);
+    if(!keys || !mass){
+        free(keys);
+        free(mass);
+        return -1;
+    }
+    // key slot 0 holds 1 for occupied entries
+    size_t width = walk->orbit_length+1;
+    size_t e;
+    for(e = 0; e < capacity; e++){
+        keys[e*width] = 0;
+    }
+    for(e = 0; e < walk->orbit_capacity; e++){
+        size_t *old = walk->orbit_keys + e*width;
+        if(!old[0]){
+            continue;
+        }
+        size_t slot = hash_labels(old+1, walk->orbit_length) & (capacity-1);
+        while(keys[slot*width]){
+            slot = (slot+1) & (capacity-1);
+        }
+        memcpy(keys + slot*width, old, sizeof(*keys) * width);
+        mass[slot] = walk->orbit_mass[e];
+    }
+    free(walk->orbit_keys);
+    free(walk->orbit_mass);
+    walk->orbit_keys = keys;
+    walk->orbit_mass = mass;
+    walk->orbit_capacity = capacity;
+    return 0;
+}
+
+/*
+ * Reduces a tuple of platforms to the lexicographically smallest tuple
+ * in its orbit under permutations of the issues.
+ */
+static void add_orbit(ExactWalk *walk, double probability){
+    size_t length = walk->orbit_length;
+    size_t *best = walk->canonical;
+    size_t p, i;
+    memcpy(best, walk->labels, sizeof(*best) * length);
+    for(p = 1; p < walk->num_permutations; p++){
+        const size_t *map = walk->permutations + p*walk->pool_size;
+        for(i = 0; i < length; i++){
+            size_t mapped = map[walk->labels[i]];
+            if(mapped != best[i]){
+                break;
+            }
+        }
+        if(i < length && map[walk->labels[i]] < best[i]){
+            for(; i < length; i++){
+                best[i] = map[walk->labels[i]];
+            }
+        }
+    }
+
+    if(2*(walk->num_orbits+1) > walk->orbit_capacity && grow_orbits(walk)){
+        walk->failed = 1;
+        return;
+    }
+    size_t width = length+1;
+    size_t slot = hash_labels(best, length) & (walk->orbit_capacity-1);
+    for(;;){
+        size_t *key = walk->orbit_keys + slot*width;
+        if(!key[0]){
+            key[0] = 1;
+            memcpy(key+1, best, sizeof(*key) * length);
+            walk->orbit_mass[slot] = probability;
+            walk->num_orbits++;
+            return;
+        }
+        if(!memcmp(key+1, best, sizeof(*key) * length)){
+            walk->orbit_mass[slot] += probability;
+            return;
+        }
+        slot = (slot+1) & (walk->orbit_capacity-1);
+    }
+}
+
+/*
+ * Mirrors the candidate draws of perform_election for the current
+ * pattern of vote draws.
+ */
+static void walk_shuffles(ExactWalk *walk,
+                          size_t step,
+                          size_t num_candidates,
+                          double probability){
+    if(walk->failed){
+        return;
+    }
+    const VoteSequence *pattern = walk->pattern;
+    size_t *arrangement = walk->arrangement;
+    if(step == pattern->steps){
+        memcpy(walk->labels, arrangement, sizeof(*arrangement) * num_candidates);
+        if(pattern->trailing){
+            walk->labels[num_candidates] = arrangement[walk->pool_size-1];
+        }
+        walk->result->num_shuffles++;
+        add_orbit(walk, probability);
+        return;
+    }
+
+    probability /= walk->pool_size-step;
+    size_t next = num_candidates + ((pattern->flags >> step) & 0x1);
+    size_t grab;
+    for(grab = step; grab < walk->pool_size; grab++){
+        size_t toss = arrangement[num_candidates];
+        arrangement[num_candidates] = arrangement[grab];
+        arrangement[grab] = toss;
+
+        walk_shuffles(walk, step+1, next, probability);
+
+        arrangement[grab] = arrangement[num_candidates];
+        arrangement[num_candidates] = toss;
+    }
+}
+
+static unsigned evaluate_outcome(ExactWalk *walk,
+                                 const size_t *labels,
+                                 const unsigned *parts,
+                                 size_t num_candidates){
+    size_t i;
+    for(i = 0; i < num_candidates; i++){
+        walk->candidates[i].id = labels[i];
+        walk->candidates[i].votes = parts[i];
+    }
+    // the two-party system election always draws a second platform
+    if(num_candidates == 1){
+        walk->candidates[1].id = labels[0] ^ 0x1;
+        walk->candidates[1].votes = 0;
+    }
+
+    size_t num_winners, num_a_winners, num_h_winners;
+    Candidate washington, status_quo[2];
+    decide_election(walk->plan,
+                    walk->population_size,
+                    walk->num_issues,
+                    num_candidates,
+                    &num_a_winners,
+                    &num_h_winners,
+                    &num_winners,
+                    walk->stance_poll,
+                    walk->hitler_table,
+                    walk->candidates,
+                    &washington,
+                    status_quo,
+                    walk->elected,
+                    walk->elected_a,
+                    walk->elected_h,
+                    walk->kernels,
+                    NULL);
+    return election_agreements(num_a_winners, num_h_winners, num_winners,
+                               &washington, NULL, status_quo,
+                               walk->elected, walk->elected_a, walk->elected_h);
+}
+
+/*
+ * Crosses the orbits of the current pattern with every vote sequence
+ * of the pattern.
+ */
+static void cross_pattern(ExactWalk *walk, const VoteSequence *first, const VoteSequence *last){
+    size_t width = walk->orbit_length+1;
+    size_t e;
+    for(e = 0; e < walk->orbit_capacity; e++){
+        const size_t *key = walk->orbit_keys + e*width;
+        if(!key[0]){
+            continue;
+        }
+        const VoteSequence *sequence;
+        for(sequence = first; sequence != last; sequence++){
+            double probability = walk->orbit_mass[e] * sequence->probability;
+            unsigned agreements = evaluate_outcome(walk, key+1,
+                                                   walk->parts + sequence->offset,
+                                                   sequence->num_parts);
+            unsigned a;
+            for(a = 0; a < NUM_AGREEMENTS; a++){
+                if((agreements >> a) & 0x1){
+                    walk->result->probability[a] += probability;
+                }
+            }
+            walk->result->total += probability;
+            walk->result->num_outcomes++;
+        }
+    }
+}
+
+/*
+ * Fills the table of platform relabellings induced by every permutation
+ * of the issues; permutation 0 is the identity.
+ */
+static void fill_permutations(ExactWalk *walk){
+    unsigned order[EXACT_MAX_ISSUES];
+    unsigned n = walk->num_issues;
+    unsigned i;
+    for(i = 0; i < n; i++){
+        order[i] = i;
+    }
+    size_t p = 0;
+    for(;;){
+        size_t *map = walk->permutations + p*walk->pool_size;
+        size_t x;
+        for(x = 0; x < walk->pool_size; x++){
+            size_t mapped = 0;
+            for(i = 0; i < n; i++){
+                mapped |= ((x >> i) & 0x1) << order[i];
+            }
+            map[x] = mapped;
+        }
+        p++;
+
+        // next permutation in lexicographic order
+        if(n < 2){
+            break;
+        }
+        int k = n-2;
+        while(k >= 0 && order[k] > order[k+1]){
+            k--;
+        }
+        if(k < 0){
+            break;
+        }
+        unsigned l = n-1;
+        while(order[l] < order[k]){
+            l--;
+        }
+        unsigned swap = order[k];
+        order[k] = order[l];
+        order[l] = swap;
+        unsigned lo = k+1, hi = n-1;
+        while(lo < hi){
+            swap = order[lo];
+            order[lo++] = order[hi];
+            order[hi--] = swap;
+        }
+    }
+    walk->num_permutations = p;
+}
+
+static void free_walk(ExactWalk *walk){
+    free(walk->sequences);
+    free(walk->parts);
+    free(walk->draws);
+    free(walk->arrangement);
+    free(walk->labels);
+    free(walk->canonical);
+    free(walk->permutations);
+    free(walk->orbit_keys);
+    free(walk->orbit_mass);
+    free(walk->candidates);
+    free(walk->hitler_table);
+    free(walk->stance_poll);
+    free(walk->elected);
+    free(walk->elected_a);
+    free(walk->elected_h);
+}
+
+int exact_election_agreements(unsigned population_size,
+                              unsigned num_issues,
+                              ExactResult *result){
+    ExactWalk walk;
+    memset(&walk, 0, sizeof(walk));
+    memset(result, 0, sizeof(*result));
+    walk.population_size = population_size;
+    walk.num_issues = num_issues;
+    walk.pool_size = (size_t)1 << num_issues;
+    walk.plan = plan_election(0, DEFAULT_METHODS);
+    walk.kernels = election_kernels(num_issues);
+    walk.result = result;
+
+    size_t pool_size = walk.pool_size;
+    walk.draws = malloc(sizeof(*walk.draws) * pool_size);
+    walk.arrangement = malloc(sizeof(*walk.arrangement) * pool_size);
+    walk.labels = malloc(sizeof(*walk.labels) * pool_size);
+    walk.canonical = malloc(sizeof(*walk.canonical) * pool_size);
+    walk.permutations = malloc(sizeof(*walk.permutations) * pool_size *
+                               (size_t)falling(num_issues, num_issues));
+    walk.candidates = malloc(sizeof(*walk.candidates) * pool_size);
+    walk.hitler_table = malloc(sizeof(*walk.hitler_table) * pool_size);
+    walk.stance_poll = malloc(sizeof(*walk.stance_poll) * num_issues);
+    walk.elected = malloc(sizeof(*walk.elected) * pool_size);
+    walk.elected_a = malloc(sizeof(*walk.elected_a) * pool_size);
+    walk.elected_h = malloc(sizeof(*walk.elected_h) * pool_size);
+    if(!walk.draws || !walk.arrangement || !walk.labels || !walk.canonical ||
+       !walk.permutations || !walk.candidates || !walk.hitler_table ||
+       !walk.stance_poll || !walk.elected || !walk.elected_a || !walk.elected_h){
+        free_walk(&walk);
+        return -1;
+    }
+    fill_permutations(&walk);
+
+    // enumerate vote draws and group them by pattern
+    enumerate_votes(&walk, 0, population_size, 0, 0, 1.0);
+    if(walk.failed){
+        free_walk(&walk);
+        return -1;
+    }
+    qsort(walk.sequences, walk.num_sequences, sizeof(*walk.sequences), compare_patterns);
+    result->num_sequences = walk.num_sequences;
+
+    size_t first = 0;
+    while(first < walk.num_sequences && !walk.failed){
+        size_t last = first+1;
+        while(last < walk.num_sequences &&
+              !compare_patterns(walk.sequences+first, walk.sequences+last)){
+            last++;
+        }
+        result->num_patterns++;
+
+        // walk the candidate draws of the pattern
+        walk.pattern = walk.sequences+first;
+        walk.orbit_length = walk.pattern->num_parts;
+        free(walk.orbit_keys);
+        free(walk.orbit_mass);
+        walk.orbit_keys = NULL;
+        walk.orbit_mass = NULL;
+        walk.orbit_capacity = 0;
+        walk.num_orbits = 0;
+        if(grow_orbits(&walk)){
+            walk.failed = 1;
+            break;
+        }
+        size_t i;
+        for(i = 0; i < pool_size; i++){
+            walk.arrangement[i] = i;
+        }
+        walk_shuffles(&walk, 0, 0, 1.0);
+
+        cross_pattern(&walk, walk.sequences+first, walk.sequences+last);
+        first = last;
+    }
+
+    int failed = walk.failed;
+    free_walk(&walk);
+    return failed ? -1 : 0;
+}
+
+void print_exact_result(unsigned population_size,
+                        unsigned num_issues,
+                        const ExactResult *result){
+    printf("\n========== EXACT ==========\n");
+    printf("Issues: %u\n", num_issues);
+    printf("Population Size: %u\n", population_size);
+    printf("Vote Draw Sequences: %zu (%zu patterns)\n", result->num_sequences, result->num_patterns);
+    printf("Candidate Draw Sequences: %.0lf\n", result->num_shuffles);
+    printf("Elections Evaluated: %.0lf\n", result->num_outcomes);
+    printf("Total Probability: %.12lf\n", result->total);
+
+    printf("\nWinner Agreement:             Probability\n");
+    unsigned a;
+    // instant-runoff is not enumerated
+    unsigned reported = method_agreements(DEFAULT_METHODS);
+    for(a = 0; a < NUM_AGREEMENTS; a++){
+        if(!((reported >> a) & 0x1)){
+            continue;
+        }
+        printf("  %-26s %12.8lf\n", agreement_name(a), result->probability[a]);
+    }
+
+    printf("\n----------------------------------------------------------------------\n");
+}
@@ -0,0 +1,118 @@
+/*======================================================================
+ *                                exact.h
+ *======================================================================
+ * Exact enumeration of the vote allocations of small elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Exact enumeration of the vote allocations of small elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef EXACT_H
+#define EXACT_H
+
+#include <stddef.h>
+
+#include "summary.h"
+
+/**
+ * Largest number of issues supported by the exact enumeration.
+ */
+#define EXACT_MAX_ISSUES 6
+
+/**
+ * Holds the result of an exact enumeration.
+ */
+typedef struct{
+    double probability[NUM_AGREEMENTS]; /**< probability that each pair
+                                             of methods agrees */
+    double total; /**< total probability walked; 1 up to rounding */
+    size_t num_sequences; /**< number of vote draw sequences */
+    size_t num_patterns; /**< number of distinct patterns of zero and
+                              nonzero vote draws */
+    double num_shuffles; /**< number of candidate draw sequences
+                              walked */
+    double num_outcomes; /**< number of elections evaluated after
+                              symmetry reduction */
+} ExactResult;
+
+/**
+ * Estimates the state space walked by exact_election_agreements.
+ *
+ * @param population_size number of voters in the election
+ * @param num_issues number of issues in the election
+ *
+ * @return the estimated number of states
+ */
+double exact_state_space(unsigned population_size, unsigned num_issues);
+
+/**
+ * Computes the exact probability that each pair of election methods
+ * agrees on a winner, by walking every sequence of draws of
+ * perform_election.
+ *
+ * @param population_size number of voters in the election
+ * @param num_issues number of issues in the election; at most
+ *                   EXACT_MAX_ISSUES
+ * @param result pointer to the result
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int exact_election_agreements(unsigned population_size,
+                              unsigned num_issues,
+                              ExactResult *result);
+
+/**
+ * Print result of an exact enumeration to stdout.
+ *
+ * @param population_size number of voters in the election
+ * @param num_issues number of issues in the election
+ * @param result pointer to the result
+ */
+void print_exact_result(unsigned population_size,
+                        unsigned num_issues,
+                        const ExactResult *result);
+
+#endif
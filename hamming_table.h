@@ -63,6 +63,6 @@ extern const unsigned char HAMMING[65536];
  * The size in bytes of the largest lookup value in the Hamming weight
  * lookup table.
  */
-extern size_t MAX_LOOKUP_SIZE;
+extern const size_t MAX_LOOKUP_SIZE;
 
 #endif
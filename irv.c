@@ -0,0 +1,273 @@
+/*======================================================================
+ *                                 irv.c
+ *======================================================================
+ * Instant-runoff elections with nearest-remaining transfers.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Instant-runoff elections with nearest-remaining transfers.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "election.h"
+#include "hamming_table.h"
+#include "irv.h"
+
+/*
+ * Value of IrvEngine.standing for platforms without a remaining
+ * candidate, and of list links at the end of a list.
+ */
+#define NOT_STANDING UINT_MAX
+
+int irv_init(unsigned num_issues, IrvEngine *engine){
+    memset(engine, 0, sizeof(*engine));
+    engine->num_issues = num_issues;
+    engine->pool_size = (size_t)1 << num_issues;
+    size_t pool_size = engine->pool_size;
+
+    unsigned d;
+    engine->binomial[0] = 1;
+    for(d = 1; d <= num_issues; d++){
+        engine->binomial[d] = engine->binomial[d-1] * (num_issues - d + 1) / d;
+    }
+
+    engine->standing = malloc(sizeof(*engine->standing) * pool_size);
+    engine->tally = malloc(sizeof(*engine->tally) * pool_size);
+    engine->shells = malloc(sizeof(*engine->shells) * pool_size * (num_issues + 1));
+    engine->choice = malloc(sizeof(*engine->choice) * pool_size);
+    engine->distance = malloc(sizeof(*engine->distance) * pool_size);
+    engine->first = malloc(sizeof(*engine->first) * pool_size);
+    engine->next = malloc(sizeof(*engine->next) * pool_size);
+    engine->remaining = malloc(sizeof(*engine->remaining) * pool_size);
+    engine->eliminated = malloc(sizeof(*engine->eliminated) * pool_size);
+    engine->counted = malloc(sizeof(*engine->counted) * pool_size);
+    if(!engine->standing || !engine->tally || !engine->shells || !engine->choice ||
+       !engine->distance || !engine->first || !engine->next || !engine->remaining ||
+       !engine->eliminated || !engine->counted){
+        irv_free(engine);
+        return -1;
+    }
+    // no platform has a candidate between elections
+    for(d = 0; d < pool_size; d++){
+        engine->standing[d] = NOT_STANDING;
+    }
+    return 0;
+}
+
+void irv_free(IrvEngine *engine){
+    free(engine->standing);
+    free(engine->tally);
+    free(engine->shells);
+    free(engine->choice);
+    free(engine->distance);
+    free(engine->first);
+    free(engine->next);
+    free(engine->remaining);
+    free(engine->eliminated);
+    free(engine->counted);
+    memset(engine, 0, sizeof(*engine));
+}
+
+/*
+ * Finds the remaining candidate of lowest index at a distance from a
+ * platform; there is one. Either the platforms of the shell or the
+ * remaining candidates are walked, whichever are fewer.
+ */
+static unsigned nearest_at(size_t platform,
+                           unsigned distance,
+                           size_t num_remaining,
+                           const Candidate *candidates,
+                           const IrvEngine *engine){
+    unsigned best = NOT_STANDING;
+    if(engine->binomial[distance] <= num_remaining){
+        // masks of distance bits in increasing order (Gosper's hack)
+        size_t mask = ((size_t)1 << distance) - 1;
+        while(mask < engine->pool_size){
+            unsigned c = engine->standing[platform ^ mask];
+            if(c < best){
+                best = c;
+            }
+            if(!mask){
+                break;
+            }
+            size_t low = mask & -mask;
+            size_t ripple = mask + low;
+            mask = ripple | (((mask ^ ripple) >> 2) / low);
+        }
+    }else{
+        size_t r;
+        for(r = 0; r < num_remaining; r++){
+            unsigned c = engine->remaining[r];
+            if(c < best && HAMMING[platform ^ candidates[c].id] == distance){
+                best = c;
+            }
+        }
+    }
+    return best;
+}
+
+size_t decide_irv_election(size_t num_groups,
+                           size_t num_candidates,
+                           size_t *num_rounds,
+                           const Candidate *groups,
+                           const Candidate *candidates,
+                           IrvRound *rounds,
+                           IrvEngine *engine){
+    unsigned num_shells = engine->num_issues + 1;
+    unsigned total = 0;
+    size_t c, g;
+    for(c = 0; c < num_candidates; c++){
+        engine->standing[candidates[c].id] = c;
+        engine->tally[c] = 0;
+        engine->first[c] = NOT_STANDING;
+        engine->remaining[c] = c;
+    }
+
+    // every group votes for its nearest candidate
+    for(g = 0; g < num_groups; g++){
+        unsigned *shells = engine->shells + g*num_shells;
+        memset(shells, 0, sizeof(*shells) * num_shells);
+        unsigned nearest = 0;
+        unsigned nearest_distance = num_shells;
+        for(c = 0; c < num_candidates; c++){
+            unsigned d = HAMMING[groups[g].id ^ candidates[c].id];
+            shells[d]++;
+            if(d < nearest_distance){
+                nearest = c;
+                nearest_distance = d;
+            }
+        }
+        engine->choice[g] = nearest;
+        engine->distance[g] = nearest_distance;
+        engine->counted[g] = 0;
+        engine->next[g] = engine->first[nearest];
+        engine->first[nearest] = g;
+        engine->tally[nearest] += groups[g].votes;
+        total += groups[g].votes;
+    }
+
+    size_t num_remaining = num_candidates;
+    size_t num_eliminated = 0;
+    *num_rounds = 0;
+    for(;;){
+        // the leader is the lowest index of the most votes, the loser
+        // the highest index of the fewest
+        size_t r, loser = 0;
+        unsigned leader = engine->remaining[0];
+        for(r = 1; r < num_remaining; r++){
+            unsigned candidate = engine->remaining[r];
+            unsigned votes = engine->tally[candidate];
+            if(votes > engine->tally[leader] ||
+               (votes == engine->tally[leader] && candidate < leader)){
+                leader = candidate;
+            }
+            unsigned lowest = engine->tally[engine->remaining[loser]];
+            if(votes < lowest ||
+               (votes == lowest && candidate > engine->remaining[loser])){
+                loser = r;
+            }
+        }
+
+        unsigned eliminated = engine->remaining[loser];
+        unsigned final = (num_remaining == 1 || 2*(unsigned long)engine->tally[leader] > total);
+        if(rounds){
+            rounds[*num_rounds].leader = candidates[leader].id;
+            rounds[*num_rounds].leader_votes = engine->tally[leader];
+            rounds[*num_rounds].eliminated = final ? IRV_NONE : candidates[eliminated].id;
+            rounds[*num_rounds].eliminated_votes = final ? 0 : engine->tally[eliminated];
+        }
+        (*num_rounds)++;
+        if(final){
+            // clear the platforms for the next election
+            for(r = 0; r < num_remaining; r++){
+                engine->standing[candidates[engine->remaining[r]].id] = NOT_STANDING;
+            }
+            return leader;
+        }
+
+        // eliminate the loser
+        engine->standing[candidates[eliminated].id] = NOT_STANDING;
+        engine->remaining[loser] = engine->remaining[--num_remaining];
+        engine->eliminated[num_eliminated++] = candidates[eliminated].id;
+
+        // move its groups to their nearest remaining candidate, first
+        // counting the eliminations since each group last moved
+        g = engine->first[eliminated];
+        while(g != NOT_STANDING){
+            size_t next = engine->next[g];
+            unsigned *shells = engine->shells + g*num_shells;
+            for(r = engine->counted[g]; r < num_eliminated; r++){
+                shells[HAMMING[groups[g].id ^ engine->eliminated[r]]]--;
+            }
+            engine->counted[g] = num_eliminated;
+            unsigned d = engine->distance[g];
+            while(!shells[d]){
+                d++;
+            }
+            unsigned nearest = nearest_at(groups[g].id, d, num_remaining, candidates, engine);
+            engine->choice[g] = nearest;
+            engine->distance[g] = d;
+            engine->next[g] = engine->first[nearest];
+            engine->first[nearest] = g;
+            engine->tally[nearest] += groups[g].votes;
+            g = next;
+        }
+    }
+}
+
+void print_irv_rounds(size_t num_rounds, const IrvRound *rounds, FILE *stream){
+    size_t r;
+    for(r = 0; r < num_rounds; r++){
+        fprintf(stream, "  %zu) %zu leads with %u", r+1, rounds[r].leader, rounds[r].leader_votes);
+        if(rounds[r].eliminated != IRV_NONE){
+            fprintf(stream, "; %zu eliminated with %u\n", rounds[r].eliminated, rounds[r].eliminated_votes);
+        }else{
+            fputc('\n', stream);
+        }
+    }
+}
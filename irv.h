@@ -0,0 +1,165 @@
+/*======================================================================
+ *                                 irv.h
+ *======================================================================
+ * Instant-runoff elections with nearest-remaining transfers.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Instant-runoff elections with nearest-remaining transfers.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef IRV_H
+#define IRV_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "election.h"
+
+/**
+ * Value of IrvRound.eliminated in the final round.
+ */
+#define IRV_NONE ((size_t)-1)
+
+/**
+ * Tally of one round of an instant-runoff election.
+ */
+typedef struct{
+    size_t leader; /**< id of the candidate with the most votes */
+    unsigned leader_votes; /**< votes of the leader */
+    size_t eliminated; /**< id of the candidate with the fewest votes,
+                            eliminated after the round, or IRV_NONE in
+                            the final round */
+    unsigned eliminated_votes; /**< votes of the eliminated candidate */
+} IrvRound;
+
+/**
+ * Buffers of the instant-runoff engine, sized for a pool of candidates.
+ *
+ * Every voter group votes for its nearest remaining candidate. Each
+ * group keeps the number of remaining candidates at every distance from
+ * it (its shells), and each candidate a list of the groups voting for
+ * it; an elimination moves only the groups of the eliminated candidate,
+ * each to the first nonempty shell at or beyond its old distance. The
+ * shells of a group are brought up to date with the eliminations only
+ * when it moves, so a round costs the groups moved rather than every
+ * group.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    unsigned *standing; /**< index of the remaining candidate with each
+                             platform, or UINT_MAX */
+    unsigned *tally; /**< votes of each candidate */
+    unsigned *shells; /**< remaining candidates at each distance from
+                           each group, num_issues+1 per group */
+    unsigned *choice; /**< candidate each group votes for */
+    unsigned char *distance; /**< distance of each group to its choice */
+    unsigned *first; /**< first group voting for each candidate */
+    unsigned *next; /**< next group voting for the same candidate */
+    unsigned *remaining; /**< indices of the remaining candidates */
+    size_t *eliminated; /**< platforms of the eliminated candidates, in
+                             order of elimination */
+    unsigned *counted; /**< eliminations counted in the shells of each
+                            group */
+    size_t binomial[16]; /**< number of platforms at each distance */
+} IrvEngine;
+
+/**
+ * Initializes an IrvEngine structure.
+ *
+ * @param num_issues number of issues in the election; at most 15
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int irv_init(unsigned num_issues, IrvEngine *engine);
+
+/**
+ * Releases the memory held by an IrvEngine structure.
+ *
+ * @param engine pointer to the engine
+ */
+void irv_free(IrvEngine *engine);
+
+/**
+ * Decides an instant-runoff election.
+ *
+ * Each voter group votes for its nearest remaining candidate, the one
+ * of lowest index among equally near candidates. Each round the
+ * candidate with the fewest votes is eliminated, the one of highest
+ * index on a tie, until a candidate holds a majority of the votes or
+ * only one remains.
+ *
+ * @param num_groups number of voter groups
+ * @param num_candidates number of candidates; at least 1
+ * @param num_rounds pointer to the variable to hold the number of rounds
+ * @param groups array of voter groups, with distinct platforms
+ * @param candidates array of candidates, with distinct platforms; may
+ *                   be groups itself
+ * @param rounds array to hold the tally of each round, num_candidates
+ *               long, or NULL
+ * @param engine pointer to the engine
+ *
+ * @return index of the winner in candidates
+ */
+size_t decide_irv_election(size_t num_groups,
+                           size_t num_candidates,
+                           size_t *num_rounds,
+                           const Candidate *groups,
+                           const Candidate *candidates,
+                           IrvRound *rounds,
+                           IrvEngine *engine);
+
+/**
+ * Prints the rounds of an instant-runoff election.
+ *
+ * @param num_rounds number of rounds
+ * @param rounds array of rounds
+ * @param stream pointer to output stream
+ */
+void print_irv_rounds(size_t num_rounds, const IrvRound *rounds, FILE *stream);
+
+#endif
@@ -0,0 +1,170 @@
+/*======================================================================
+ *                           kernel_template.h
+ *======================================================================
+ * Template of the election kernels for one number of issues.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Template of the election kernels for one number of issues.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+/*
+ * This file is included once per number of issues, with KERNEL_ISSUES
+ * defined to that number, and defines static kernels whose names are
+ * suffixed with it; it deliberately has no include guard. The integer
+ * candidate ids are below 2^KERNEL_ISSUES <= 2^16, so the distance
+ * between two platforms is a single HAMMING lookup.
+ */
+#ifndef KERNEL_ISSUES
+#error "KERNEL_ISSUES must be defined before including kernel_template.h"
+#endif
+
+#define KERNEL(name) KERNEL_NAME(name, KERNEL_ISSUES)
+
+/*
+ * Computes the full statistics of a candidate, as
+ * compute_candidate_statistics does; a distance d maps to pro (0),
+ * medius (1) or contra (2) by comparing 2d with the constant
+ * KERNEL_ISSUES.
+ */
+static void KERNEL(candidate_statistics)(size_t num_candidates,
+                                         Candidate *candidate,
+                                         const Candidate *candidates){
+    unsigned leaning[3] = {0, 0, 0};
+    unsigned sum_disapproval = 0;
+    unsigned max_disapproval = 0;
+    size_t hitler = candidate->id;
+
+    size_t h;
+    for(h = 0; h < num_candidates; h++){
+        unsigned disapproval = HAMMING[candidate->id ^ candidates[h].id];
+        leaning[(2*disapproval > KERNEL_ISSUES) + (2*disapproval >= KERNEL_ISSUES)] += candidates[h].votes;
+        if(disapproval > max_disapproval){
+            hitler = candidates[h].id;
+            max_disapproval = disapproval;
+        }
+        sum_disapproval += disapproval * candidates[h].votes;
+    }
+
+    candidate->pro = leaning[0];
+    candidate->medius = leaning[1];
+    candidate->contra = leaning[2];
+    candidate->sum_disapproval = sum_disapproval;
+    candidate->hitler = hitler;
+}
+
+/*
+ * Computes only the disapproval sum and/or the hitler of a candidate,
+ * as compute_planned_statistics does.
+ */
+static void KERNEL(planned_statistics)(unsigned plan,
+                                       size_t num_candidates,
+                                       Candidate *candidate,
+                                       const Candidate *candidates){
+    unsigned sum_disapproval = 0;
+    unsigned max_disapproval = 0;
+    size_t hitler = candidate->id;
+
+    size_t h;
+    for(h = 0; h < num_candidates; h++){
+        unsigned disapproval = HAMMING[candidate->id ^ candidates[h].id];
+        if((plan & STAGE_HITLER) && disapproval > max_disapproval){
+            hitler = candidates[h].id;
+            max_disapproval = disapproval;
+        }
+        sum_disapproval += disapproval * candidates[h].votes;
+    }
+
+    candidate->sum_disapproval = sum_disapproval;
+    candidate->hitler = hitler;
+}
+
+static void KERNEL(statistics)(unsigned plan,
+                               size_t first,
+                               size_t last,
+                               size_t num_candidates,
+                               Candidate *candidates){
+    size_t i;
+    if(plan & STAGE_LEANING){
+        for(i = first; i < last; i++){
+            KERNEL(candidate_statistics)(num_candidates, candidates+i, candidates);
+        }
+    }else if(plan & (STAGE_DISAPPROVAL | STAGE_HITLER)){
+        for(i = first; i < last; i++){
+            KERNEL(planned_statistics)(plan, num_candidates, candidates+i, candidates);
+        }
+    }
+}
+
+static void KERNEL(stance_tally)(size_t first,
+                                 size_t last,
+                                 unsigned *stance_poll,
+                                 const Candidate *candidates){
+    size_t i;
+    for(i = first; i < last; i++){
+        unsigned w;
+        for(w = 0; w < KERNEL_ISSUES; w++){
+            stance_poll[w] += ((candidates[i].id >> w) & 0x1) * candidates[i].votes;
+        }
+    }
+}
+
+static void KERNEL(two_party)(size_t first,
+                              size_t last,
+                              const Candidate *candidates,
+                              unsigned *votes){
+    size_t i;
+    for(i = first; i < last; i++){
+        unsigned disapproval_0 = HAMMING[candidates[0].id ^ candidates[i].id];
+        unsigned disapproval_1 = HAMMING[candidates[1].id ^ candidates[i].id];
+
+        // if disapproval values are equal, then votes aren't counted
+        if(disapproval_0 != disapproval_1){
+            votes[disapproval_0 > disapproval_1] += candidates[i].votes;
+        }
+    }
+}
+
+#undef KERNEL
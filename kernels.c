@@ -0,0 +1,127 @@
+/*======================================================================
+ *                               kernels.c
+ *======================================================================
+ * Election kernels specialized for each number of issues.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Election kernels specialized for each number of issues.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stddef.h>
+
+#include "election.h"
+#include "hamming_table.h"
+
+#define KERNEL_PASTE(name, issues) name ## _ ## issues
+#define KERNEL_NAME(name, issues) KERNEL_PASTE(name, issues)
+
+#define KERNEL_ISSUES 1
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 2
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 3
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 4
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 5
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 6
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 7
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 8
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 9
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 10
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 11
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 12
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 13
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 14
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+#define KERNEL_ISSUES 15
+#include "kernel_template.h"
+#undef KERNEL_ISSUES
+
+#define KERNEL_ENTRY(issues) {KERNEL_NAME(statistics, issues), \
+                              KERNEL_NAME(stance_tally, issues), \
+                              KERNEL_NAME(two_party, issues)}
+
+/*
+ * Dispatch table of the election kernels, indexed by number of issues.
+ */
+static const ElectionKernels KERNELS[KERNEL_MAX_ISSUES] = {
+    KERNEL_ENTRY(1), KERNEL_ENTRY(2), KERNEL_ENTRY(3),
+    KERNEL_ENTRY(4), KERNEL_ENTRY(5), KERNEL_ENTRY(6),
+    KERNEL_ENTRY(7), KERNEL_ENTRY(8), KERNEL_ENTRY(9),
+    KERNEL_ENTRY(10), KERNEL_ENTRY(11), KERNEL_ENTRY(12),
+    KERNEL_ENTRY(13), KERNEL_ENTRY(14), KERNEL_ENTRY(15)
+};
+
+const ElectionKernels *election_kernels(unsigned num_issues){
+    if(num_issues < 1 || num_issues > KERNEL_MAX_ISSUES){
+        return NULL;
+    }
+    return KERNELS + (num_issues - 1);
+}
@@ -0,0 +1,309 @@
+/*======================================================================
+ *                               margins.c
+ *======================================================================
+ * Margins of victory of the election methods.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Margins of victory of the election methods.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include "bit_functions.h"
+#include "election.h"
+#include "margins.h"
+
+/*
+ * Votes moved from the winner to the runner-up until they tie.
+ */
+static unsigned traditional_margin(size_t num_candidates,
+                                   size_t num_winners,
+                                   const Candidate *candidates){
+    if(num_winners > 1){
+        return 0;
+    }
+    if(num_candidates < 2){
+        return MARGIN_NONE;
+    }
+    return (candidates[0].votes - candidates[1].votes + 1) / 2;
+}
+
+/*
+ * Fewest voters of the groups closest to the winner relative to a
+ * challenger whose moves to the challenger close a disapproval gap.
+ */
+static unsigned approval_challenge(unsigned gap,
+                                   size_t num_candidates,
+                                   const Candidate *candidates,
+                                   size_t challenger,
+                                   size_t winner){
+    const size_t id_c = candidates[challenger].id;
+    const size_t id_w = candidates[winner].id;
+    const unsigned d = hamming_weight(id_c ^ id_w);
+    // a voter's gain is at most 2d, when the winner lies between it and
+    // the challenger
+    unsigned votes[2*KERNEL_MAX_ISSUES + 1] = {0};
+    size_t g;
+    for(g = 0; g < num_candidates; g++){
+        unsigned gain = d + hamming_weight(id_c ^ candidates[g].id) -
+                        hamming_weight(id_w ^ candidates[g].id);
+        votes[gain] += candidates[g].votes;
+    }
+
+    unsigned moved = 0;
+    unsigned gain;
+    for(gain = 2*d; gain > 0 && gap; gain--){
+        // every voter of this gain, or as many as close the gap
+        unsigned wanted = (gap + gain - 1) / gain;
+        unsigned taken = (votes[gain] < wanted) ? votes[gain] : wanted;
+        moved += taken;
+        gap = (taken*gain >= gap) ? 0 : gap - taken*gain;
+    }
+    return gap ? MARGIN_NONE : moved;
+}
+
+/*
+ * Least approval margin over every challenger of the approval winner.
+ */
+static unsigned approval_margin(size_t num_candidates,
+                                size_t num_a_winners,
+                                const Candidate *candidates,
+                                Candidate *const *elected_a){
+    if(num_a_winners > 1){
+        return 0;
+    }
+    const size_t winner = elected_a[0] - candidates;
+    const unsigned sum_w = candidates[winner].sum_disapproval;
+
+    // a moved vote closes at most 2d(c,w) of the gap of c; counting the
+    // challenger of the least such bound first skips most of the others
+    size_t first = num_candidates;
+    unsigned first_bound = MARGIN_NONE;
+    size_t c;
+    for(c = 0; c < num_candidates; c++){
+        if(c == winner){
+            continue;
+        }
+        unsigned gap = candidates[c].sum_disapproval - sum_w;
+        unsigned reach = 2*hamming_weight(candidates[c].id ^ candidates[winner].id);
+        unsigned bound = (gap + reach - 1) / reach;
+        if(bound < first_bound){
+            first = c;
+            first_bound = bound;
+        }
+    }
+    if(first == num_candidates){
+        return MARGIN_NONE;
+    }
+
+    unsigned margin = approval_challenge(candidates[first].sum_disapproval - sum_w,
+                                         num_candidates, candidates, first, winner);
+    for(c = 0; c < num_candidates && margin > first_bound; c++){
+        if(c == winner || c == first){
+            continue;
+        }
+        unsigned gap = candidates[c].sum_disapproval - sum_w;
+        unsigned reach = 2*hamming_weight(candidates[c].id ^ candidates[winner].id);
+        if((gap + reach - 1) / reach >= margin){
+            continue;
+        }
+        unsigned challenge = approval_challenge(gap, num_candidates, candidates, c, winner);
+        margin = (challenge < margin) ? challenge : margin;
+    }
+    return margin;
+}
+
+/*
+ * Voters moved off the runner-up's hitler table entry, onto the
+ * winner's if any group has the winner as its hitler; the hitler of a
+ * group depends only on the candidates standing.
+ */
+static unsigned hitler_margin(unsigned turnout,
+                              size_t num_candidates,
+                              size_t num_h_winners,
+                              const unsigned *hitler_table,
+                              const Candidate *candidates){
+    if(num_h_winners > 1){
+        return 0;
+    }
+    unsigned least = MARGIN_NONE;
+    unsigned runner_up = MARGIN_NONE;
+    size_t c;
+    for(c = 0; c < num_candidates; c++){
+        unsigned votes = hitler_table[candidates[c].id];
+        if(votes < least){
+            runner_up = least;
+            least = votes;
+        }else if(votes < runner_up){
+            runner_up = votes;
+        }
+    }
+    if(runner_up == MARGIN_NONE){
+        return MARGIN_NONE;
+    }
+    if(least){
+        return (runner_up - least + 1) / 2;
+    }
+    // nobody's hitler is the winner, so the runner-up must lose all of
+    // its votes, to a group whose hitler it is not
+    return (runner_up < turnout) ? runner_up : MARGIN_NONE;
+}
+
+/*
+ * Voters moved between the sides of the two parties, or off the winner
+ * until two candidates have more votes.
+ */
+static unsigned two_party_margin(size_t num_candidates,
+                                 const Candidate *candidates,
+                                 const Candidate *status_quo){
+    if(num_candidates < 2){
+        return MARGIN_NONE;
+    }
+    if(status_quo[0].votes == status_quo[1].votes){
+        return 0;
+    }
+    unsigned margin = (status_quo[0].votes - status_quo[1].votes + 1) / 2;
+    if(num_candidates < 3){
+        return margin;
+    }
+
+    // the other two of the three leading candidates; the parties lead
+    // the sorted candidates
+    size_t winner = (candidates[0].id == status_quo[0].id) ? 0 : 1;
+    unsigned votes = candidates[winner].votes;
+    unsigned u1 = candidates[1 - winner].votes;
+    unsigned u2 = candidates[2].votes;
+    // k votes off the winner must lift both above it:
+    // (votes+1-k-u2) <= k and (votes+1-k-u1) + (votes+1-k-u2) <= k
+    unsigned k1 = (votes + 1 > u2) ? (votes + 1 - u2 + 1) / 2 : 0;
+    unsigned k2 = (2*(votes + 1) > u1 + u2) ? (2*(votes + 1) - u1 - u2 + 2) / 3 : 0;
+    unsigned removal = (k1 > k2) ? k1 : k2;
+    if(removal <= votes && removal < margin){
+        margin = removal;
+    }
+    return margin;
+}
+
+/*
+ * Voters moved across the least split issue until its majority turns;
+ * a tie goes to stance 1, as for the washington candidate.
+ */
+static unsigned washington_margin(unsigned turnout, unsigned num_issues, const unsigned *stance_poll){
+    unsigned margin = MARGIN_NONE;
+    unsigned i;
+    for(i = 0; i < num_issues; i++){
+        unsigned stance_1 = stance_poll[i];
+        unsigned stance_0 = turnout - stance_1;
+        unsigned moved = MARGIN_NONE;
+        // only to a candidate of the other stance
+        if(stance_1 >= stance_0 && stance_0){
+            moved = (stance_1 - stance_0) / 2 + 1;
+        }else if(stance_1 < stance_0 && stance_1){
+            moved = (stance_0 - stance_1 + 1) / 2;
+        }
+        margin = (moved < margin) ? moved : margin;
+    }
+    return margin;
+}
+
+void decide_margins(unsigned methods,
+                    unsigned turnout,
+                    unsigned num_issues,
+                    size_t num_candidates,
+                    size_t num_a_winners,
+                    size_t num_h_winners,
+                    size_t num_winners,
+                    const unsigned *stance_poll,
+                    const unsigned *hitler_table,
+                    const Candidate *candidates,
+                    const Candidate *status_quo,
+                    Candidate *const *elected_a,
+                    unsigned *margins){
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        margins[m] = MARGIN_NONE;
+    }
+    if(!num_candidates){
+        return;
+    }
+    if(methods & (1U << METHOD_TRADITIONAL)){
+        margins[METHOD_TRADITIONAL] = traditional_margin(num_candidates, num_winners, candidates);
+    }
+    if(methods & (1U << METHOD_APPROVAL)){
+        margins[METHOD_APPROVAL] = approval_margin(num_candidates, num_a_winners,
+                                                   candidates, elected_a);
+    }
+    if(methods & (1U << METHOD_HITLER)){
+        margins[METHOD_HITLER] = hitler_margin(turnout, num_candidates, num_h_winners,
+                                               hitler_table, candidates);
+    }
+    if(methods & (1U << METHOD_TWO_PARTY)){
+        margins[METHOD_TWO_PARTY] = two_party_margin(num_candidates, candidates, status_quo);
+    }
+    if(methods & (1U << METHOD_WASHINGTON)){
+        margins[METHOD_WASHINGTON] = washington_margin(turnout, num_issues, stance_poll);
+    }
+}
+
+void print_margins(unsigned methods, const unsigned *margins, FILE *stream){
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        if(m == METHOD_IRV || !((methods >> m) & 0x1)){
+            continue;
+        }
+        if(margins[m] == MARGIN_NONE){
+            fprintf(stream, "   > %s: none\n", method_name(m));
+        }else if(margins[m] == 0){
+            // a tie, of the two-party method too: its bound is then exact
+            fprintf(stream, "   > %s: tied\n", method_name(m));
+        }else if(m == METHOD_TWO_PARTY){
+            // only a bound: fewer voters may change the parties
+            fprintf(stream, "   > %s: at most %u voter%s\n", method_name(m), margins[m],
+                    (margins[m] == 1) ? "" : "s");
+        }else{
+            fprintf(stream, "   > %s: %u voter%s\n", method_name(m), margins[m],
+                    (margins[m] == 1) ? "" : "s");
+        }
+    }
+}
@@ -0,0 +1,134 @@
+/*======================================================================
+ *                               margins.h
+ *======================================================================
+ * Margins of victory of the election methods.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Margins of victory of the election methods.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef MARGINS_H
+#define MARGINS_H
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "election.h"
+
+/**
+ * Margin of a method whose outcome no number of voters can change, or
+ * which was not decided.
+ */
+#define MARGIN_NONE UINT_MAX
+
+/**
+ * Computes the margin of victory of every decided method but
+ * instant-runoff: the fewest voters who, moving to the platform of
+ * another candidate, make a candidate other than the winners a winner
+ * or tie. The candidates stand as they are, even when every voter
+ * leaves one.
+ *
+ * Two conventions hold for every consumer of the margins. A tied
+ * election, one with a candidate other than the winners already tied,
+ * has a margin of 0: no voter needs to move. And the two-party margin
+ * is an upper bound rather than exact, so fewer voters than it may
+ * change the parties; a bound of 0 is still exactly a tie.
+ *
+ * The margins of the traditional, hitler, and washington methods are
+ * exact and take a pass over the candidates or issues at most: a moved
+ * vote narrows the gap of the runner-up by at most two. The approval
+ * margin of a challenger c against the winner w is exact too: a voter
+ * of group g moving to c narrows the gap in disapproval by
+ * d(c,w) + d(c,g) - d(w,g), so the voters are taken by that gain, most
+ * first; challengers are bounded by their gap over 2d(c,w) and the
+ * challenger of the least bound is counted first, so most are skipped.
+ * The two-party margin is the fewer of the voters shifting the tallies
+ * of the two parties and of those pushing the winner out of them.
+ *
+ * @param methods set of election methods decided (see Method)
+ * @param turnout number of voters who cast a ballot
+ * @param num_issues number of issues in the election
+ * @param num_candidates number of candidates
+ * @param num_a_winners number of approval winners
+ * @param num_h_winners number of hitler election winners
+ * @param num_winners number of traditional election winners
+ * @param stance_poll voters with a stance of 1 on each issue
+ * @param hitler_table votes in the hitler election method
+ * @param candidates array of the actual candidates, sorted by descending
+ *                   votes, with their disapproval sums
+ * @param status_quo two-party system candidates
+ * @param elected_a approval winners
+ * @param margins array to hold the margin of each method, NUM_METHODS
+ *                long; MARGIN_NONE for the methods not decided
+ */
+void decide_margins(unsigned methods,
+                    unsigned turnout,
+                    unsigned num_issues,
+                    size_t num_candidates,
+                    size_t num_a_winners,
+                    size_t num_h_winners,
+                    size_t num_winners,
+                    const unsigned *stance_poll,
+                    const unsigned *hitler_table,
+                    const Candidate *candidates,
+                    const Candidate *status_quo,
+                    Candidate *const *elected_a,
+                    unsigned *margins);
+
+/**
+ * Prints the margin of victory of each decided method: "tied" for a
+ * margin of 0, "at most" that many voters for the two-party bound, and
+ * "none" for a method no voters can change. The data file keeps the
+ * plain numbers, 0 for a tie.
+ *
+ * @param methods set of election methods decided (see Method)
+ * @param margins array of the margin of each method
+ * @param stream pointer to output stream
+ */
+void print_margins(unsigned methods, const unsigned *margins, FILE *stream);
+
+#endif
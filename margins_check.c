@@ -0,0 +1,325 @@
+/*======================================================================
+ *                            margins_check.c
+ *======================================================================
+ * Brute-force check of the margins of victory.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Brute-force check of the margins of victory.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "confuzz.h"
+#include "election.h"
+#include "margins.h"
+
+/** Most issues of a checked election. */
+#define CHECK_MAX_ISSUES 4
+
+/** Most candidates of a checked election. */
+#define CHECK_MAX_CANDIDATES 6
+
+/** Most voters of a checked candidate. */
+#define CHECK_MAX_VOTES 4
+
+/**
+ * Winners of every method of an election.
+ */
+typedef struct{
+    size_t num_winners[NUM_METHODS]; /**< number of winners of each method */
+    size_t winners[NUM_METHODS][CHECK_MAX_CANDIDATES]; /**< ids of the
+                                                            winners */
+} Outcome;
+
+/**
+ * An election of few voters, small enough to try every move of them.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues */
+    unsigned num_candidates; /**< number of candidates */
+    unsigned turnout; /**< number of voters */
+    size_t ids[CHECK_MAX_CANDIDATES]; /**< platform of each candidate */
+} Election;
+
+/*
+ * Decides the election of the votes given, with its margins if asked.
+ */
+static void decide(const Election *election, const unsigned *votes,
+                   Outcome *outcome, unsigned *margins){
+    Candidate candidates[CHECK_MAX_CANDIDATES];
+    Candidate washington;
+    Candidate status_quo[2];
+    Candidate *elected[CHECK_MAX_CANDIDATES];
+    Candidate *elected_a[CHECK_MAX_CANDIDATES];
+    Candidate *elected_h[CHECK_MAX_CANDIDATES];
+    unsigned stance_poll[CHECK_MAX_ISSUES];
+    unsigned hitler_table[1U << CHECK_MAX_ISSUES] = {0};
+    size_t num_a_winners, num_h_winners, num_winners;
+    size_t c;
+
+    memset(candidates, 0, sizeof(candidates));
+    for(c = 0; c < election->num_candidates; c++){
+        candidates[c].id = election->ids[c];
+        candidates[c].votes = votes[c];
+    }
+    decide_election(plan_election(0, DEFAULT_METHODS), election->turnout,
+                    election->num_issues, election->num_candidates,
+                    &num_a_winners, &num_h_winners, &num_winners,
+                    stance_poll, hitler_table, candidates, &washington,
+                    status_quo, elected, elected_a, elected_h, NULL, NULL);
+
+    memset(outcome, 0, sizeof(*outcome));
+    outcome->num_winners[METHOD_TRADITIONAL] = num_winners;
+    outcome->num_winners[METHOD_APPROVAL] = num_a_winners;
+    outcome->num_winners[METHOD_HITLER] = num_h_winners;
+    for(c = 0; c < num_winners; c++){
+        outcome->winners[METHOD_TRADITIONAL][c] = elected[c]->id;
+    }
+    for(c = 0; c < num_a_winners; c++){
+        outcome->winners[METHOD_APPROVAL][c] = elected_a[c]->id;
+    }
+    for(c = 0; c < num_h_winners; c++){
+        outcome->winners[METHOD_HITLER][c] = elected_h[c]->id;
+    }
+    // tied parties both win
+    outcome->num_winners[METHOD_TWO_PARTY] = (status_quo[0].votes == status_quo[1].votes) ? 2 : 1;
+    outcome->winners[METHOD_TWO_PARTY][0] = status_quo[0].id;
+    outcome->winners[METHOD_TWO_PARTY][1] = status_quo[1].id;
+    outcome->num_winners[METHOD_WASHINGTON] = 1;
+    outcome->winners[METHOD_WASHINGTON][0] = washington.id;
+
+    if(margins){
+        decide_margins(DEFAULT_METHODS, election->turnout, election->num_issues,
+                       election->num_candidates, num_a_winners, num_h_winners,
+                       num_winners, stance_poll, hitler_table, candidates,
+                       status_quo, elected_a, margins);
+    }
+}
+
+/*
+ * Whether a method has a winner or tie that was not a winner before.
+ */
+static int changed(const Outcome *before, const Outcome *after, unsigned method){
+    size_t i, j;
+    for(i = 0; i < after->num_winners[method]; i++){
+        for(j = 0; j < before->num_winners[method]; j++){
+            if(after->winners[method][i] == before->winners[method][j]){
+                break;
+            }
+        }
+        if(j == before->num_winners[method]){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Index of the votes of every candidate but the last, whose votes follow
+ * from the turnout.
+ */
+static size_t vote_index(const Election *election, const unsigned *votes){
+    size_t index = 0;
+    unsigned c;
+    for(c = 0; c + 1 < election->num_candidates; c++){
+        index = index*(election->turnout + 1) + votes[c];
+    }
+    return index;
+}
+
+/*
+ * Finds the true margin of every method by a breadth-first search of
+ * the moves of one voter at a time; returns -1 if out of memory.
+ */
+static int search_margins(const Election *election, const unsigned *votes, unsigned *truth){
+    const unsigned num_candidates = election->num_candidates;
+    Outcome before, after;
+    decide(election, votes, &before, NULL);
+
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        truth[m] = MARGIN_NONE;
+    }
+    truth[METHOD_TRADITIONAL] = (before.num_winners[METHOD_TRADITIONAL] > 1) ? 0 : MARGIN_NONE;
+    truth[METHOD_APPROVAL] = (before.num_winners[METHOD_APPROVAL] > 1) ? 0 : MARGIN_NONE;
+    truth[METHOD_HITLER] = (before.num_winners[METHOD_HITLER] > 1) ? 0 : MARGIN_NONE;
+    truth[METHOD_TWO_PARTY] = (before.num_winners[METHOD_TWO_PARTY] > 1) ? 0 : MARGIN_NONE;
+
+    // the votes of the first candidates index every state
+    size_t num_states = 1;
+    unsigned c;
+    for(c = 0; c + 1 < num_candidates; c++){
+        num_states *= election->turnout + 1;
+    }
+    unsigned char *visited = calloc(num_states, 1);
+    unsigned (*queue)[CHECK_MAX_CANDIDATES] = malloc(num_states*sizeof(*queue));
+    unsigned *depth = malloc(num_states*sizeof(*depth));
+    if(!visited || !queue || !depth){
+        free(visited);
+        free(queue);
+        free(depth);
+        return -1;
+    }
+
+    size_t head = 0;
+    size_t tail = 0;
+    memcpy(queue[tail], votes, num_candidates*sizeof(*votes));
+    depth[tail++] = 0;
+    visited[vote_index(election, votes)] = 1;
+    while(head < tail){
+        const unsigned *state = queue[head];
+        const unsigned moved = depth[head++];
+        if(moved){
+            decide(election, state, &after, NULL);
+            for(m = 0; m < NUM_METHODS; m++){
+                if(m != METHOD_IRV && truth[m] == MARGIN_NONE && changed(&before, &after, m)){
+                    truth[m] = moved;
+                }
+            }
+        }
+        unsigned from, to;
+        for(from = 0; from < num_candidates; from++){
+            if(!state[from]){
+                continue;
+            }
+            for(to = 0; to < num_candidates; to++){
+                if(to == from){
+                    continue;
+                }
+                unsigned next[CHECK_MAX_CANDIDATES];
+                memcpy(next, state, num_candidates*sizeof(*next));
+                next[from]--;
+                next[to]++;
+                size_t index = vote_index(election, next);
+                if(visited[index]){
+                    continue;
+                }
+                visited[index] = 1;
+                memcpy(queue[tail], next, num_candidates*sizeof(*next));
+                depth[tail++] = moved + 1;
+            }
+        }
+    }
+    free(visited);
+    free(queue);
+    free(depth);
+    return 0;
+}
+
+/**
+ * Compares the margins of random small elections with a search of every
+ * move of their voters: the traditional, approval, hitler, and
+ * washington margins must be exact and the two-party margin no less
+ * than the true one.
+ *
+ * Usage: margins_check [SEED [TRIALS]]
+ */
+int main(int argc, char *argv[]){
+    const unsigned long seed = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1;
+    const unsigned long num_trials = (argc > 2) ? strtoul(argv[2], NULL, 10) : 2000;
+    RandomState random;
+    rand_seed(seed, 0, &random);
+
+    unsigned long two_party_exact = 0;
+    unsigned long t;
+    for(t = 0; t < num_trials; t++){
+        Election election;
+        election.num_issues = 2 + rand_ceiling(CHECK_MAX_ISSUES - 1, &random);
+        election.num_candidates = 2 + rand_ceiling(CHECK_MAX_CANDIDATES - 1, &random);
+        if(election.num_candidates > (1U << election.num_issues)){
+            election.num_candidates = 1U << election.num_issues;
+        }
+        // distinct platforms
+        unsigned used[1U << CHECK_MAX_ISSUES] = {0};
+        unsigned votes[CHECK_MAX_CANDIDATES];
+        unsigned c;
+        election.turnout = 0;
+        for(c = 0; c < election.num_candidates; c++){
+            size_t id;
+            do{
+                id = rand_ceiling(1U << election.num_issues, &random);
+            }while(used[id]);
+            used[id] = 1;
+            election.ids[c] = id;
+            votes[c] = 1 + rand_ceiling(CHECK_MAX_VOTES, &random);
+            election.turnout += votes[c];
+        }
+
+        Outcome outcome;
+        unsigned margins[NUM_METHODS];
+        unsigned truth[NUM_METHODS];
+        decide(&election, votes, &outcome, margins);
+        if(search_margins(&election, votes, truth)){
+            fprintf(stderr, "margins_check: out of memory\n");
+            return 1;
+        }
+
+        unsigned m;
+        for(m = 0; m < NUM_METHODS; m++){
+            if(m == METHOD_IRV){
+                continue;
+            }
+            if(m == METHOD_TWO_PARTY){
+                // an upper bound
+                if(margins[m] < truth[m]){
+                    printf("trial %lu: %s margin %u below the true %u\n",
+                           t, method_name(m), margins[m], truth[m]);
+                    return 1;
+                }
+                two_party_exact += (margins[m] == truth[m]);
+            }else if(margins[m] != truth[m]){
+                printf("trial %lu: %s margin %u, not the true %u (%u issues, %u candidates)\n",
+                       t, method_name(m), margins[m], truth[m],
+                       election.num_issues, election.num_candidates);
+                return 1;
+            }
+        }
+    }
+    printf("%lu elections checked; two-party bound exact in %lu\n", num_trials, two_party_exact);
+    return 0;
+}
@@ -0,0 +1,294 @@
+/*======================================================================
+ *                               minimax.c
+ *======================================================================
+ * Minimax compromise platforms by branch and bound.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Minimax compromise platforms by branch and bound.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "election.h"
+#include "minimax.h"
+#include "telemetry.h"
+
+/**
+ * State of a search, threaded through its recursion.
+ */
+typedef struct{
+    size_t num_groups; /**< number of voter groups with votes */
+    unsigned order[KERNEL_MAX_ISSUES]; /**< issue assigned at each depth */
+    unsigned majority; /**< majority stance on every issue */
+    unsigned best; /**< largest distance of the best platform found */
+    size_t best_id; /**< best platform found */
+    unsigned open; /**< least bound of the partial platforms left
+                        unsearched */
+    unsigned timed_out; /**< whether the budget ran out */
+    uint64_t start; /**< clock at the start of the search */
+    unsigned long num_nodes; /**< partial platforms searched */
+    MinimaxEngine *engine; /**< engine of the search */
+} Search;
+
+int minimax_init(unsigned num_issues, double budget, MinimaxEngine *engine){
+    memset(engine, 0, sizeof(*engine));
+    engine->num_issues = num_issues;
+    engine->pool_size = (size_t)1 << num_issues;
+    engine->budget = (budget > 0) ? (uint64_t)(budget * 1e9) : 0;
+    engine->ids = malloc(sizeof(*engine->ids) * engine->pool_size);
+    engine->distances = malloc(sizeof(*engine->distances) * engine->pool_size * (num_issues + 1));
+    if(!engine->ids || !engine->distances){
+        minimax_free(engine);
+        return -1;
+    }
+    return 0;
+}
+
+void minimax_free(MinimaxEngine *engine){
+    free(engine->ids);
+    free(engine->distances);
+    memset(engine, 0, sizeof(*engine));
+}
+
+/*
+ * Hamming weight of a platform difference, in arithmetic rather than a
+ * table lookup so that loops over the groups vectorize; platforms have
+ * at most 15 issues.
+ */
+static unsigned distance(unsigned difference){
+    difference = difference - ((difference >> 1) & 0x5555);
+    difference = (difference & 0x3333) + ((difference >> 2) & 0x3333);
+    difference = (difference + (difference >> 4)) & 0x0f0f;
+    return (difference + (difference >> 8)) & 0x1f;
+}
+
+/*
+ * Returns the largest distance from a platform to a voter group.
+ */
+static unsigned farthest_distance(unsigned platform, size_t num_groups, const unsigned *ids){
+    unsigned farthest = 0;
+    size_t g;
+    for(g = 0; g < num_groups; g++){
+        unsigned d = distance(platform ^ ids[g]);
+        farthest = (d > farthest) ? d : farthest;
+    }
+    return farthest;
+}
+
+/*
+ * Returns the voter group farthest from a platform, the one of lowest
+ * index on a tie.
+ */
+static size_t farthest_group(unsigned platform, size_t num_groups, const unsigned *ids){
+    size_t farthest = 0;
+    unsigned farthest_d = 0;
+    size_t g;
+    for(g = 0; g < num_groups; g++){
+        unsigned d = distance(platform ^ ids[g]);
+        if(d > farthest_d){
+            farthest = g;
+            farthest_d = d;
+        }
+    }
+    return farthest;
+}
+
+/*
+ * Completes a partial platform and keeps it if it beats the best found.
+ */
+static void complete_platform(unsigned platform, Search *search){
+    unsigned farthest = farthest_distance(platform, search->num_groups, search->engine->ids);
+    if(farthest < search->best){
+        search->best = farthest;
+        search->best_id = platform;
+    }
+}
+
+/*
+ * Searches below a partial platform of depth issues, whose distances
+ * are in row depth and whose bound is less than the best found.
+ */
+static void search_platforms(unsigned depth, unsigned platform, unsigned bound, Search *search){
+    MinimaxEngine *engine = search->engine;
+    if(search->timed_out){
+        search->open = (bound < search->open) ? bound : search->open;
+        return;
+    }
+    search->num_nodes++;
+    if(engine->budget && !(search->num_nodes & 0xff) &&
+       telemetry_clock() - search->start >= engine->budget){
+        search->timed_out = 1;
+        search->open = (bound < search->open) ? bound : search->open;
+        return;
+    }
+
+    const size_t num_groups = search->num_groups;
+    const size_t pool_size = engine->pool_size;
+    const unsigned *ids = engine->ids;
+    const unsigned issue = search->order[depth];
+    const unsigned *order = search->order;
+    const unsigned char *row = engine->distances + depth*pool_size;
+    unsigned char *next = engine->distances + (depth + 1)*pool_size;
+    unsigned remaining = 0;
+    unsigned j;
+    for(j = depth + 1; j < engine->num_issues; j++){
+        remaining |= 1u << order[j];
+    }
+
+    unsigned choice;
+    for(choice = 0; choice < 2; choice++){
+        // the majority stance first
+        const unsigned stance = ((search->majority >> issue) & 0x1) ^ choice;
+        const unsigned child = platform | (stance << issue);
+        unsigned farthest = 0;
+        size_t g;
+        for(g = 0; g < num_groups; g++){
+            next[g] = row[g] + (((ids[g] >> issue) & 0x1) ^ stance);
+            farthest = (next[g] > farthest) ? next[g] : farthest;
+        }
+        if(farthest >= search->best){
+            continue;
+        }
+        if(depth + 1 == engine->num_issues){
+            search->best = farthest;
+            search->best_id = child;
+            continue;
+        }
+
+        // pair the farthest group with every other, and gather the
+        // groups which must agree with the rest of the platform
+        size_t f = 0;
+        while(next[f] != farthest){
+            f++;
+        }
+        const unsigned id_f = ids[f] & remaining;
+        const unsigned tight = search->best - 1;
+        unsigned pair = 0;
+        unsigned tight_and = remaining;
+        unsigned tight_or = 0;
+        unsigned num_tight = 0;
+        for(g = 0; g < num_groups; g++){
+            unsigned p = (farthest + next[g] + distance(id_f ^ (ids[g] & remaining)) + 1) / 2;
+            pair = (p > pair) ? p : pair;
+            unsigned is_tight = (next[g] == tight);
+            tight_and &= is_tight ? ids[g] : ~0u;
+            tight_or |= is_tight ? ids[g] : 0;
+            num_tight += is_tight;
+        }
+        unsigned child_bound = (farthest > bound) ? farthest : bound;
+        child_bound = (pair > child_bound) ? pair : child_bound;
+        if(child_bound >= search->best){
+            continue;
+        }
+        if(num_tight){
+            // the tight groups fix the rest of the platform, unless they
+            // differ on it
+            if(!((tight_or & ~tight_and) & remaining)){
+                complete_platform(child | (tight_and & remaining), search);
+            }
+            continue;
+        }
+        search_platforms(depth + 1, child, child_bound, search);
+    }
+}
+
+void decide_minimax_election(unsigned turnout,
+                             size_t num_groups,
+                             const Candidate *groups,
+                             const unsigned *stance_poll,
+                             MinimaxPlatform *minimax,
+                             MinimaxEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    Search search;
+    memset(&search, 0, sizeof(search));
+    search.engine = engine;
+    search.open = UINT_MAX;
+    search.start = telemetry_clock();
+
+    size_t g;
+    for(g = 0; g < num_groups; g++){
+        if(groups[g].votes){
+            engine->ids[search.num_groups++] = groups[g].id;
+        }
+    }
+
+    // most evenly split issues first, where the bounds bite soonest
+    unsigned balance[KERNEL_MAX_ISSUES];
+    unsigned i, j;
+    for(i = 0; i < num_issues; i++){
+        unsigned stance_1 = 2*stance_poll[i];
+        balance[i] = (stance_1 > turnout) ? stance_1 - turnout : turnout - stance_1;
+        // ties go to stance 1, as for the washington candidate
+        search.majority |= (stance_1 >= turnout) << i;
+        for(j = i; j > 0 && balance[search.order[j - 1]] > balance[i]; j--){
+            search.order[j] = search.order[j - 1];
+        }
+        search.order[j] = i;
+    }
+
+    // start from the washington platform, and bound every platform by
+    // half the distance of a far pair of groups
+    search.best_id = search.majority;
+    search.best = farthest_distance(search.majority, search.num_groups, engine->ids);
+    unsigned root_bound = 0;
+    if(search.num_groups){
+        size_t h1 = farthest_group(engine->ids[0], search.num_groups, engine->ids);
+        size_t h2 = farthest_group(engine->ids[h1], search.num_groups, engine->ids);
+        root_bound = (distance(engine->ids[h1] ^ engine->ids[h2]) + 1) / 2;
+    }
+    if(root_bound < search.best){
+        memset(engine->distances, 0, sizeof(*engine->distances) * search.num_groups);
+        search_platforms(0, 0, root_bound, &search);
+    }
+
+    minimax->id = search.best_id;
+    minimax->distance = search.best;
+    minimax->lower_bound = (search.open < search.best) ? search.open : search.best;
+    minimax->num_nodes = search.num_nodes;
+}
@@ -0,0 +1,134 @@
+/*======================================================================
+ *                               minimax.h
+ *======================================================================
+ * Minimax compromise platforms by branch and bound.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Minimax compromise platforms by branch and bound.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef MINIMAX_H
+#define MINIMAX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "election.h"
+
+/**
+ * Buffers of the minimax engine, sized for a pool of candidates.
+ *
+ * The minimax platform is the platform of the whole pool, standing or
+ * not, whose largest distance to a voter group is least: the closest
+ * string of the groups' platforms. Where the washington candidate
+ * follows the majority on every issue, the minimax platform protects
+ * the most distant minority.
+ *
+ * The search assigns the issues one at a time, the most evenly split
+ * by the stance poll first and the majority stance of each first, and
+ * starts from the washington platform as the best found. A partial
+ * platform is bounded below by the largest distance of a group on the
+ * issues assigned, and by the farthest group f paired with every other
+ * group h: a platform is at least (d_f + d_h + r)/2 from one of the
+ * two, r being the unassigned issues on which they differ. Groups one
+ * issue short of the best distance must agree with the rest of the
+ * platform: a partial platform leaving unassigned an issue on which
+ * their platforms differ is pruned, and any other is completed with
+ * their common stances without branching.
+ *
+ * The distances of every group on the issues assigned are kept per
+ * depth, so each step is a pass over the groups which the compiler
+ * vectorizes. The search stops at the time budget, leaving the best
+ * platform found and the least bound of the partial platforms left.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    uint64_t budget; /**< time budget of a search in nanoseconds, or 0
+                          for none */
+    unsigned *ids; /**< platform of each voter group */
+    unsigned char *distances; /**< distance of each group on the issues
+                                   assigned, num_issues+1 rows of
+                                   pool_size */
+} MinimaxEngine;
+
+/**
+ * Initializes a MinimaxEngine structure.
+ *
+ * @param num_issues number of issues in the election; at most 15
+ * @param budget seconds a search may take, or 0 for no limit
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int minimax_init(unsigned num_issues, double budget, MinimaxEngine *engine);
+
+/**
+ * Releases the memory held by a MinimaxEngine structure.
+ *
+ * @param engine pointer to the engine
+ */
+void minimax_free(MinimaxEngine *engine);
+
+/**
+ * Searches for the minimax platform of an election.
+ *
+ * @param turnout number of voters who cast a ballot
+ * @param num_groups number of voter groups
+ * @param groups array of voter groups, each with at least one vote
+ * @param stance_poll voters with a stance of 1 on each issue, as
+ *                    computed for the washington candidate
+ * @param minimax pointer to the minimax platform found
+ * @param engine pointer to the engine
+ */
+void decide_minimax_election(unsigned turnout,
+                             size_t num_groups,
+                             const Candidate *groups,
+                             const unsigned *stance_poll,
+                             MinimaxPlatform *minimax,
+                             MinimaxEngine *engine);
+
+#endif
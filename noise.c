@@ -0,0 +1,264 @@
+/*======================================================================
+ *                                noise.c
+ *======================================================================
+ * Noisy voters moved between platforms in aggregate.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Noisy voters moved between platforms in aggregate.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "checkpoint.h"
+#include "noise.h"
+
+int parse_errors(const char *list, size_t *num_errors, double *errors){
+    *num_errors = 0;
+    do{
+        char *check;
+        double error = strtod(list, &check);
+        if(check == list || (*check && *check != ',') || !(error >= 0 && error <= 1) ||
+           *num_errors == KERNEL_MAX_ISSUES){
+            return -1;
+        }
+        errors[(*num_errors)++] = error;
+        list = check;
+    }while(*list++);
+    return 0;
+}
+
+int noise_init(unsigned num_issues,
+               double abstention,
+               size_t num_errors,
+               const double *errors,
+               NoiseModel *noise){
+    memset(noise, 0, sizeof(*noise));
+    double total = abstention;
+    size_t d;
+    for(d = 0; d < num_errors && d < num_issues; d++){
+        total += errors[d];
+        if(!(errors[d] >= 0)){
+            return -1;
+        }
+    }
+    // a little slack for probabilities written in decimal
+    if(num_errors > num_issues || !(abstention >= 0 && abstention < 1) || total > 1 + 1e-9){
+        return -1;
+    }
+
+    noise->num_issues = num_issues;
+    noise->pool_size = (size_t)1 << num_issues;
+    noise->abstention = abstention;
+    noise->num_errors = num_errors;
+    double shell = 1;
+    for(d = 0; d < num_issues; d++){
+        noise->errors[d] = (d < num_errors) ? errors[d] : 0;
+        shell = shell*(num_issues - d)/(d + 1);
+        noise->shells[d] = shell;
+        noise->issues[d] = d;
+    }
+    noise->stamps = calloc(noise->pool_size, sizeof(*noise->stamps));
+    noise->slots = malloc(sizeof(*noise->slots) * noise->pool_size);
+    noise->ballots = malloc(sizeof(*noise->ballots) * noise->pool_size);
+    if(!noise->stamps || !noise->slots || !noise->ballots){
+        noise_free(noise);
+        return -1;
+    }
+    return 0;
+}
+
+void noise_free(NoiseModel *noise){
+    free(noise->stamps);
+    free(noise->slots);
+    free(noise->ballots);
+    memset(noise, 0, sizeof(*noise));
+}
+
+void noise_reset(NoiseModel *noise){
+    unsigned d;
+    for(d = 0; d < noise->num_issues; d++){
+        noise->issues[d] = d;
+    }
+}
+
+int noise_save(const NoiseModel *noise, FILE *stream){
+    return -(checkpoint_put(&noise->num_issues, sizeof(noise->num_issues), stream) ||
+             checkpoint_put(noise->issues, sizeof(*noise->issues) * noise->num_issues, stream));
+}
+
+int noise_load(FILE *stream, NoiseModel *noise){
+    unsigned num_issues;
+    if(checkpoint_get(&num_issues, sizeof(num_issues), stream) ||
+       num_issues != noise->num_issues ||
+       checkpoint_get(noise->issues, sizeof(*noise->issues) * num_issues, stream)){
+        return -1;
+    }
+    // a permutation of the issues, or the shuffles would go astray
+    unsigned seen = 0, d;
+    for(d = 0; d < num_issues; d++){
+        if(noise->issues[d] >= num_issues || (seen >> noise->issues[d]) & 0x1){
+            return -1;
+        }
+        seen |= 1U << noise->issues[d];
+    }
+    return 0;
+}
+
+/* Adds ballots to a platform, appending it on its first ballots. */
+static void add_ballots(size_t id, unsigned votes, size_t *num_ballots, NoiseModel *noise){
+    if(noise->stamps[id] != noise->epoch){
+        noise->stamps[id] = noise->epoch;
+        noise->slots[id] = *num_ballots;
+        noise->ballots[*num_ballots].id = id;
+        noise->ballots[*num_ballots].votes = 0;
+        (*num_ballots)++;
+    }
+    noise->ballots[noise->slots[id]].votes += votes;
+}
+
+/* Returns a uniform platform at a distance from a platform. */
+static size_t random_neighbour(size_t id, unsigned distance, RandomState *random,
+                               NoiseModel *noise){
+    // the first issues of a partial Fisher-Yates shuffle
+    unsigned j;
+    for(j = 0; j < distance; j++){
+        unsigned k = j + rand_ceiling(noise->num_issues - j, random);
+        unsigned issue = noise->issues[k];
+        noise->issues[k] = noise->issues[j];
+        noise->issues[j] = issue;
+        id ^= (size_t)1 << issue;
+    }
+    return id;
+}
+
+/*
+ * Spreads ballots uniformly over the platforms at a distance from a
+ * platform: ballot by ballot when they are fewer than the platforms,
+ * otherwise by a binomial per platform, visiting the masks of the
+ * distance in increasing order (Gosper's hack).
+ */
+static void spread_ballots(size_t id, unsigned distance, unsigned votes, size_t *num_ballots,
+                           RandomState *random, NoiseModel *noise){
+    double shell = noise->shells[distance-1];
+    if(votes < shell){
+        unsigned v;
+        for(v = 0; v < votes; v++){
+            add_ballots(random_neighbour(id, distance, random, noise), 1, num_ballots, noise);
+        }
+        return;
+    }
+    size_t mask = ((size_t)1 << distance) - 1;
+    for(; votes && mask < noise->pool_size; shell--){
+        unsigned moved = (shell > 1) ? rand_binomial(votes, 1/shell, random) : votes;
+        if(moved){
+            add_ballots(id ^ mask, moved, num_ballots, noise);
+            votes -= moved;
+        }
+        size_t low = mask & -mask;
+        size_t high = mask + low;
+        mask = high | (((mask ^ high) >> 2) / low);
+    }
+}
+
+unsigned noise_apply(size_t *num_groups, Candidate *groups, RandomState *random, NoiseModel *noise){
+    size_t num_ballots;
+    unsigned turnout;
+    do{
+        // a new epoch forgets the platforms of the previous election
+        if(!++noise->epoch){
+            memset(noise->stamps, 0, sizeof(*noise->stamps) * noise->pool_size);
+            noise->epoch = 1;
+        }
+        num_ballots = 0;
+        size_t i;
+        for(i = 0; i < *num_groups; i++){
+            add_ballots(groups[i].id, 0, &num_ballots, noise);
+        }
+
+        for(i = 0; i < *num_groups; i++){
+            // each outcome draws from the voters left by the ones before
+            unsigned left = groups[i].votes;
+            double mass = 1;
+            left -= rand_binomial(left, noise->abstention, random);
+            mass -= noise->abstention;
+            size_t d;
+            for(d = 0; d < noise->num_errors && left; d++){
+                double p = (mass > noise->errors[d]) ? noise->errors[d]/mass : 1;
+                unsigned moved = rand_binomial(left, p, random);
+                if(moved){
+                    spread_ballots(groups[i].id, d+1, moved, &num_ballots, random, noise);
+                    left -= moved;
+                }
+                mass -= noise->errors[d];
+            }
+            noise->ballots[noise->slots[groups[i].id]].votes += left;
+        }
+
+        // platforms without ballots are dropped
+        size_t n = 0;
+        turnout = 0;
+        for(i = 0; i < num_ballots; i++){
+            if(noise->ballots[i].votes){
+                turnout += noise->ballots[i].votes;
+                noise->ballots[n++] = noise->ballots[i];
+            }
+        }
+        num_ballots = n;
+    }while(!turnout);
+
+    size_t i;
+    for(i = 0; i < num_ballots; i++){
+        groups[i].id = noise->ballots[i].id;
+        groups[i].votes = noise->ballots[i].votes;
+    }
+    // the two-party system election always draws a second platform
+    if(num_ballots == 1){
+        groups[1].id = (groups[0].id + 1) & (noise->pool_size - 1);
+    }
+    *num_groups = num_ballots;
+    return turnout;
+}
@@ -0,0 +1,189 @@
+/*======================================================================
+ *                                noise.h
+ *======================================================================
+ * Noisy voters moved between platforms in aggregate.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Noisy voters moved between platforms in aggregate.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef NOISE_H
+#define NOISE_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "confuzz.h"
+#include "election.h"
+
+/**
+ * Voter behaviour departing from a ballot for the voter's own platform:
+ * each voter abstains, or casts a ballot for a platform at distance d
+ * from their own, with a probability for each, and otherwise votes as
+ * before.
+ *
+ * The ballots are moved per voter group rather than per voter: the
+ * voters of a group are split between staying, abstaining, and each
+ * distance by a chain of binomial draws, and the ballots moved to a
+ * distance are spread uniformly over the platforms at that distance,
+ * one platform per ballot while there are fewer ballots than platforms
+ * and one binomial per platform otherwise. A group thus costs
+ * num_errors+1 draws plus, at distance d, at most the smaller of its
+ * moved ballots and the n-choose-d platforms, so that errors to nearby
+ * platforms cost in proportion to the issues rather than the voters.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible platforms */
+    double abstention; /**< probability that a voter abstains */
+    size_t num_errors; /**< largest distance of an error */
+    double errors[KERNEL_MAX_ISSUES]; /**< probability that a voter votes
+                                           for a platform at distance
+                                           d+1, per d */
+    double shells[KERNEL_MAX_ISSUES]; /**< number of platforms at
+                                           distance d+1, per d */
+    unsigned issues[KERNEL_MAX_ISSUES]; /**< issues in the order of the
+                                             latest partial shuffle */
+    unsigned epoch; /**< stamp of the current election */
+    unsigned *stamps; /**< epoch in which each platform last received
+                           ballots */
+    unsigned *slots; /**< index of each stamped platform in ballots */
+    Candidate *ballots; /**< platforms receiving ballots */
+} NoiseModel;
+
+/**
+ * Parses a comma-separated list of error probabilities, the first for
+ * distance 1.
+ *
+ * @param list the list of probabilities
+ * @param num_errors pointer to the variable to hold the number of
+ *                   probabilities
+ * @param errors array to hold the probabilities, of KERNEL_MAX_ISSUES
+ *
+ * @return 0 on success, -1 if the list is malformed, empty, longer than
+ *         KERNEL_MAX_ISSUES, or holds a probability outside [0, 1]
+ */
+int parse_errors(const char *list, size_t *num_errors, double *errors);
+
+/**
+ * Initializes a NoiseModel structure.
+ *
+ * @param num_issues number of issues in the election
+ * @param abstention probability that a voter abstains; less than 1
+ * @param num_errors number of error probabilities; at most num_issues
+ * @param errors probability that a voter votes for a platform at
+ *               distance d+1, per d; the probabilities and abstention
+ *               add up to at most 1
+ * @param noise pointer to the noise model
+ *
+ * @return 0 on success, -1 if the probabilities are invalid or memory
+ *         could not be allocated
+ */
+int noise_init(unsigned num_issues,
+               double abstention,
+               size_t num_errors,
+               const double *errors,
+               NoiseModel *noise);
+
+/**
+ * Releases the memory held by a NoiseModel structure.
+ *
+ * @param noise pointer to the noise model
+ */
+void noise_free(NoiseModel *noise);
+
+/**
+ * Restarts a noise model as if freshly initialized: the errors of the
+ * next election shuffle the issues from their initial order.
+ *
+ * @param noise pointer to the noise model
+ */
+void noise_reset(NoiseModel *noise);
+
+/**
+ * Saves the order of the issues of a noise model, which the errors of
+ * the next election shuffle from, to a checkpoint.
+ *
+ * @param noise pointer to the noise model
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the write failed
+ *
+ * @sa checkpoint_begin
+ */
+int noise_save(const NoiseModel *noise, FILE *stream);
+
+/**
+ * Restores the order of the issues of a noise model saved by
+ * noise_save.
+ *
+ * @param stream stream of the checkpoint
+ * @param noise pointer to a noise model of the same number of issues as
+ *              the one saved
+ *
+ * @return 0 on success, -1 if the checkpoint ended first or does not
+ *         fit the noise model
+ */
+int noise_load(FILE *stream, NoiseModel *noise);
+
+/**
+ * Moves the ballots of an allocated election by the noise model. The
+ * platforms keep their order, with the platforms first receiving
+ * ballots after them, and platforms left without ballots are dropped.
+ * An election in which every voter abstains is drawn again.
+ *
+ * @param num_groups pointer to the variable holding the number of voter
+ *                   groups
+ * @param groups array of voter groups, as returned by perform_election;
+ *               of the pool size
+ * @param random pointer to the generator state of the draws
+ * @param noise pointer to the noise model
+ *
+ * @return the number of voters who cast a ballot
+ */
+unsigned noise_apply(size_t *num_groups, Candidate *groups, RandomState *random, NoiseModel *noise);
+
+#endif
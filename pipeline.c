@@ -0,0 +1,706 @@
+/*======================================================================
+ *                              pipeline.c
+ *======================================================================
+ * Producer/consumer pipeline for formatting and writing election results.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Producer/consumer pipeline for formatting and writing election results.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "approximate.h"
+#include "committee.h"
+#include "districts.h"
+#include "election.h"
+#include "irv.h"
+#include "margins.h"
+#include "pipeline.h"
+#include "threshold.h"
+
+/*
+ * Size of the stdio buffers of the output streams; the writer hands the
+ * operating system large blocks instead of a line at a time.
+ */
+#define STREAM_BUFFER_SIZE (1<<20)
+
+/*
+ * Methods in the order of their winner columns in the data file.
+ */
+static const unsigned DATA_COLUMNS[NUM_METHODS] = {
+    METHOD_TRADITIONAL, METHOD_APPROVAL, METHOD_HITLER,
+    METHOD_WASHINGTON, METHOD_TWO_PARTY, METHOD_IRV
+};
+
+typedef struct{
+    Candidate candidate;
+    unsigned hitler_votes;
+} CandidateRow;
+
+/*
+ * Header of an election record; it is followed by num_radii threshold
+ * approval winners, then by the num_threshold_ids ids of those winners,
+ * then by num_electoral electoral winners, then by the
+ * num_electoral_ids ids of those winners, then by the num_members seats of each of the two committees, then by the
+ * rows of the traditional election,
+ * approval, and hitler election winners, then by
+ * num_rows rows of per-candidate detail, then by num_rounds
+ * instant-runoff rounds.
+ */
+typedef struct{
+    size_t length;
+    unsigned long election;
+    unsigned turnout;
+    size_t num_candidates;
+    size_t num_rows;
+    size_t num_winners;
+    size_t num_a_winners;
+    size_t num_h_winners;
+    size_t num_rounds;
+    size_t num_radii;
+    size_t num_threshold_ids;
+    size_t num_electoral;
+    size_t num_electoral_ids;
+    size_t num_members;
+    unsigned agreements;
+    unsigned dropped;
+    Candidate washington;
+    Candidate status_quo[2];
+    CandidateRow irv;
+    unsigned has_minimax;
+    MinimaxPlatform minimax;
+    unsigned has_margins;
+    unsigned margins[NUM_METHODS];
+    unsigned has_approximate;
+    ApproximateReport approximate;
+} RecordHeader;
+
+/*
+ * Yields the processor while waiting on the other side of the ring:
+ * spin briefly, then sleep.
+ */
+static void backoff(unsigned *attempts){
+    if(++(*attempts) < 64){
+        return;
+    }
+    struct timespec nap = {0, 100000};
+    nanosleep(&nap, NULL);
+}
+
+/*
+ * Reserves length contiguous bytes in the ring; returns NULL if block
+ * is not set and the ring is full.
+ */
+static void *ring_reserve(RecordRing *ring,
+                          size_t length,
+                          unsigned block,
+                          unsigned long *num_stalls){
+    size_t head = ring->head;
+    size_t offset = head & (ring->capacity-1);
+    size_t contiguous = ring->capacity - offset;
+    size_t needed = (length <= contiguous) ? length : contiguous + length;
+
+    unsigned attempts = 0;
+    while(head + needed - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) > ring->capacity){
+        if(!block){
+            return NULL;
+        }
+        if(!attempts){
+            (*num_stalls)++;
+        }
+        backoff(&attempts);
+    }
+
+    if(length > contiguous){
+        // leave the rest of the buffer unused
+        *(size_t*)(ring->buffer + offset) = 0;
+        head += contiguous;
+        offset = 0;
+    }
+    ring->reserved = head + length;
+    return ring->buffer + offset;
+}
+
+static void ring_commit(RecordRing *ring){
+    __atomic_store_n(&ring->head, ring->reserved, __ATOMIC_RELEASE);
+}
+
+static void copy_rows(size_t num_rows,
+                      const unsigned *hitler_table,
+                      Candidate **candidates,
+                      CandidateRow *rows){
+    size_t i;
+    for(i = 0; i < num_rows; i++){
+        rows[i].candidate = *candidates[i];
+        rows[i].hitler_votes = hitler_table[candidates[i]->id];
+    }
+}
+
+void pipeline_submit(const ElectionResult *result, Pipeline *pipeline){
+    const Candidate *irv = result->rounds ? &result->irv : NULL;
+    size_t num_elected = result->num_winners + result->num_a_winners + result->num_h_winners;
+    size_t num_radii = result->threshold ? pipeline->config.num_issues + 1 : 0;
+    size_t num_threshold_ids = result->threshold ?
+                               threshold_num_ids(pipeline->config.num_issues, result->threshold) : 0;
+    size_t num_electoral = result->electoral ? NUM_METHODS : 0;
+    size_t num_electoral_ids = result->electoral ? district_num_ids(result->electoral) : 0;
+    size_t num_seats = result->chamberlin_courant ? 2*result->num_members : 0;
+    // per-candidate detail and rounds are only printed to the screen
+    size_t num_rows = pipeline->screen ? result->num_candidates : 0;
+    size_t num_rounds = result->num_rounds;
+    if(!pipeline->screen || !pipeline->config.irv_rounds || !irv){
+        num_rounds = 0;
+    }
+    size_t length = sizeof(RecordHeader) + sizeof(ThresholdWinner)*num_radii +
+                    sizeof(size_t)*num_threshold_ids + sizeof(ElectoralWinner)*num_electoral +
+                    sizeof(size_t)*num_electoral_ids + sizeof(CommitteeSeat)*num_seats +
+                    sizeof(CandidateRow)*(num_elected + num_rows) + sizeof(IrvRound)*num_rounds;
+
+    unsigned block = (pipeline->config.backpressure == BACKPRESSURE_BLOCK);
+    RecordHeader *header = ring_reserve(&pipeline->ring, length, block, &pipeline->num_stalls);
+    unsigned dropped = 0;
+    if(!header){
+        // drop the detail, waiting only if even the winners do not fit
+        dropped = (num_rows != 0 || num_rounds != 0);
+        num_rows = 0;
+        num_rounds = 0;
+        length = sizeof(RecordHeader) + sizeof(ThresholdWinner)*num_radii +
+                 sizeof(size_t)*num_threshold_ids + sizeof(ElectoralWinner)*num_electoral +
+                    sizeof(size_t)*num_electoral_ids + sizeof(CommitteeSeat)*num_seats +
+                 sizeof(CandidateRow)*num_elected;
+        header = ring_reserve(&pipeline->ring, length, 1, &pipeline->num_stalls);
+        pipeline->num_dropped += dropped;
+    }
+
+    header->length = length;
+    header->election = result->election;
+    header->turnout = result->turnout;
+    header->num_candidates = result->num_candidates;
+    header->num_rows = num_rows;
+    header->num_winners = result->num_winners;
+    header->num_a_winners = result->num_a_winners;
+    header->num_h_winners = result->num_h_winners;
+    header->num_rounds = num_rounds;
+    header->num_radii = num_radii;
+    header->num_threshold_ids = num_threshold_ids;
+    header->num_electoral = num_electoral;
+    header->num_electoral_ids = num_electoral_ids;
+    header->num_members = num_seats/2;
+    header->agreements = result->agreements;
+    header->dropped = dropped;
+    header->washington = result->washington;
+    header->has_minimax = (result->minimax != NULL);
+    if(result->minimax){
+        header->minimax = *result->minimax;
+    }
+    header->has_margins = (result->margins != NULL);
+    if(result->margins){
+        memcpy(header->margins, result->margins, sizeof(header->margins));
+    }
+    header->has_approximate = (result->approximate != NULL);
+    if(result->approximate){
+        header->approximate = *result->approximate;
+    }
+    header->status_quo[0] = result->status_quo[0];
+    header->status_quo[1] = result->status_quo[1];
+    if(irv){
+        header->irv.candidate = *irv;
+        header->irv.hitler_votes = result->hitler_table[irv->id];
+    }
+
+    ThresholdWinner *radii = (ThresholdWinner*)(header+1);
+    size_t *threshold_ids = (size_t*)(radii + num_radii);
+    if(num_radii){
+        memcpy(radii, result->threshold, sizeof(*radii) * num_radii);
+        memcpy(threshold_ids, result->threshold_ids, sizeof(*threshold_ids) * num_threshold_ids);
+    }
+    ElectoralWinner *winners = (ElectoralWinner*)(threshold_ids + num_threshold_ids);
+    size_t *electoral_ids = (size_t*)(winners + num_electoral);
+    if(num_electoral){
+        memcpy(winners, result->electoral, sizeof(*winners) * num_electoral);
+        memcpy(electoral_ids, result->electoral_ids, sizeof(*electoral_ids) * num_electoral_ids);
+    }
+    CommitteeSeat *seats = (CommitteeSeat*)(electoral_ids + num_electoral_ids);
+    if(num_seats){
+        memcpy(seats, result->chamberlin_courant, sizeof(*seats) * result->num_members);
+        memcpy(seats + result->num_members, result->sequential,
+               sizeof(*seats) * result->num_members);
+    }
+    CandidateRow *rows = (CandidateRow*)(seats + num_seats);
+    copy_rows(result->num_winners, result->hitler_table, result->elected, rows);
+    rows += result->num_winners;
+    copy_rows(result->num_a_winners, result->hitler_table, result->elected_a, rows);
+    rows += result->num_a_winners;
+    copy_rows(result->num_h_winners, result->hitler_table, result->elected_h, rows);
+    rows += result->num_h_winners;
+    size_t i;
+    for(i = 0; i < num_rows; i++){
+        rows[i].candidate = result->candidates[i];
+        rows[i].hitler_votes = result->hitler_table[result->candidates[i].id];
+    }
+    if(num_rounds){
+        memcpy(rows + num_rows, result->rounds, sizeof(*result->rounds) * num_rounds);
+    }
+
+    ring_commit(&pipeline->ring);
+}
+
+/*
+ * Rebuilds the winners of one method from their rows.
+ */
+static void restore_rows(size_t num_rows,
+                         unsigned *hitler_table,
+                         Candidate *candidates,
+                         Candidate **elected,
+                         const CandidateRow *rows){
+    size_t i;
+    for(i = 0; i < num_rows; i++){
+        candidates[i] = rows[i].candidate;
+        hitler_table[rows[i].candidate.id] = rows[i].hitler_votes;
+        if(elected){
+            elected[i] = candidates+i;
+        }
+    }
+}
+
+static void print_winner_ids(size_t num_winners, Candidate **elected, FILE *stream){
+    size_t i;
+    for(i = 0; i < num_winners; i++){
+        fprintf(stream, i ? " %zu" : "%zu", elected[i]->id);
+    }
+}
+
+static void write_record(const RecordHeader *header, Pipeline *pipeline){
+    const ThresholdWinner *radii = (const ThresholdWinner*)(header+1);
+    const size_t *threshold_ids = (const size_t*)(radii + header->num_radii);
+    const ElectoralWinner *electoral = (const ElectoralWinner*)(threshold_ids +
+                                                                header->num_threshold_ids);
+    const size_t *electoral_ids = (const size_t*)(electoral + header->num_electoral);
+    const CommitteeSeat *seats = (const CommitteeSeat*)(electoral_ids + header->num_electoral_ids);
+    const CandidateRow *rows = (const CandidateRow*)(seats + 2*header->num_members);
+    size_t num_elected = header->num_winners + header->num_a_winners + header->num_h_winners;
+
+    // candidate rows come first, the winners after them
+    Candidate *candidates = pipeline->candidates;
+    Candidate *winners = candidates + header->num_rows;
+    restore_rows(header->num_rows, pipeline->hitler_table, candidates, NULL, rows + num_elected);
+    restore_rows(header->num_winners, pipeline->hitler_table,
+                 winners, pipeline->elected, rows);
+    rows += header->num_winners;
+    winners += header->num_winners;
+    restore_rows(header->num_a_winners, pipeline->hitler_table,
+                 winners, pipeline->elected_a, rows);
+    rows += header->num_a_winners;
+    winners += header->num_a_winners;
+    restore_rows(header->num_h_winners, pipeline->hitler_table,
+                 winners, pipeline->elected_h, rows);
+
+    Candidate washington = header->washington;
+    Candidate status_quo[2] = {header->status_quo[0], header->status_quo[1]};
+    Candidate irv = header->irv.candidate;
+    unsigned decided_irv = pipeline->config.methods & (1U << METHOD_IRV);
+
+    if(pipeline->screen){
+        // one lock for the whole record rather than one per call
+        flockfile(pipeline->screen);
+        fprintf(pipeline->screen, "\n========== ELECTION #%lu ==========\n", header->election+1);
+        if(header->dropped){
+            fprintf(pipeline->screen, "(detail of %zu candidates dropped)\n", header->num_candidates);
+        }
+        if(pipeline->config.turnout){
+            fprintf(pipeline->screen, "Turnout: %u of %u\n", header->turnout,
+                    pipeline->config.population_size);
+        }
+        print_election_statistics(header->turnout, pipeline->config.num_issues,
+                                  header->num_a_winners, header->num_rows,
+                                  header->num_h_winners, header->num_winners,
+                                  pipeline->hitler_table, candidates, &washington,
+                                  header->has_minimax ? &header->minimax : NULL, status_quo,
+                                  pipeline->elected, pipeline->elected_a, pipeline->elected_h,
+                                  pipeline->screen);
+        if(decided_irv){
+            // restored last, so a winner row cannot overwrite its votes
+            pipeline->hitler_table[irv.id] = header->irv.hitler_votes;
+            fprintf(pipeline->screen, "\nInstant-Runoff Election: \n");
+            print_irv_rounds(header->num_rounds,
+                             (const IrvRound*)(rows + header->num_h_winners + header->num_rows),
+                             pipeline->screen);
+            print_candidate_statistics(header->turnout, pipeline->config.num_issues, "   > ",
+                                       pipeline->hitler_table, &irv, pipeline->screen);
+            fprintf(pipeline->screen, "\n----------------------------------------------------------------------\n");
+        }
+        if(header->num_radii){
+            fprintf(pipeline->screen, "\nThreshold Approval Winners: \n");
+            print_threshold_winners(pipeline->config.num_issues, radii, threshold_ids,
+                                    pipeline->screen);
+            fprintf(pipeline->screen, "\n----------------------------------------------------------------------\n");
+        }
+        if(pipeline->config.num_seats){
+            fputc('\n', pipeline->screen);
+            print_committees(pipeline->config.num_issues, header->turnout, header->num_members,
+                             seats, seats + header->num_members, pipeline->screen);
+            fprintf(pipeline->screen, "\n----------------------------------------------------------------------\n");
+        }
+        if(header->has_margins){
+            fprintf(pipeline->screen, "\nMargins of Victory: \n");
+            print_margins(pipeline->config.methods, header->margins, pipeline->screen);
+            fprintf(pipeline->screen, "\n----------------------------------------------------------------------\n");
+        }
+        if(header->num_electoral){
+            fprintf(pipeline->screen, "\nElectoral Winners: \n");
+            print_electoral_winners(pipeline->config.methods, pipeline->config.num_districts,
+                                    electoral, electoral_ids, pipeline->screen);
+            fprintf(pipeline->screen, "\n----------------------------------------------------------------------\n");
+        }
+        funlockfile(pipeline->screen);
+    }
+
+    if(pipeline->data){
+        FILE *data = pipeline->data;
+        fprintf(data, "%lu,%zu,", header->election+1, header->num_candidates);
+        print_winner_ids(header->num_winners, pipeline->elected, data);
+        fputc(',', data);
+        print_winner_ids(header->num_a_winners, pipeline->elected_a, data);
+        fputc(',', data);
+        print_winner_ids(header->num_h_winners, pipeline->elected_h, data);
+        fputc(',', data);
+        if(pipeline->config.methods & (1U << METHOD_WASHINGTON)){
+            fprintf(data, "%zu", washington.id);
+        }
+        fputc(',', data);
+        if(pipeline->config.methods & (1U << METHOD_TWO_PARTY)){
+            fprintf(data, "%zu", status_quo[0].id);
+            if(status_quo[0].votes == status_quo[1].votes){
+                fprintf(data, " %zu", status_quo[1].id);
+            }
+        }
+        if(decided_irv){
+            fprintf(data, ",%zu", irv.id);
+        }
+        if(pipeline->config.threshold){
+            // the radii by spaces, the winners tied at a radius by slashes
+            const size_t *id = threshold_ids;
+            size_t r, w;
+            fputc(',', data);
+            for(r = 0; r < header->num_radii; r++){
+                for(w = 0; w < radii[r].num_winners; w++){
+                    fprintf(data, w ? "/%zu" : r ? " %zu" : "%zu", *id++);
+                }
+            }
+        }
+        if(pipeline->config.turnout){
+            fprintf(data, ",%u", header->turnout);
+        }
+        if(pipeline->config.num_districts){
+            // in the order of the winner columns, the ids in the order
+            // of the methods
+            const size_t *first[NUM_METHODS];
+            const size_t *id = electoral_ids;
+            unsigned m;
+            for(m = 0; m < NUM_METHODS; m++){
+                first[m] = id;
+                id += header->num_electoral ? electoral[m].num_winners : 0;
+            }
+            for(m = 0; m < NUM_METHODS; m++){
+                unsigned method = DATA_COLUMNS[m];
+                size_t w;
+                if(method == METHOD_IRV && !decided_irv){
+                    continue;
+                }
+                fputc(',', data);
+                for(w = 0; header->num_electoral && w < electoral[method].num_winners; w++){
+                    fprintf(data, w ? " %zu" : "%zu", first[method][w]);
+                }
+            }
+        }
+        if(pipeline->config.num_seats){
+            size_t s;
+            fputc(',', data);
+            for(s = 0; s < header->num_members; s++){
+                fprintf(data, s ? " %zu" : "%zu", seats[s].id);
+            }
+            fputc(',', data);
+            for(s = 0; s < header->num_members; s++){
+                fprintf(data, s ? " %zu" : "%zu", seats[header->num_members + s].id);
+            }
+        }
+        if(pipeline->config.minimax){
+            fprintf(data, ",%zu", header->minimax.id);
+        }
+        if(pipeline->config.margins){
+            unsigned m;
+            for(m = 0; m < NUM_METHODS; m++){
+                unsigned method = DATA_COLUMNS[m];
+                if(method == METHOD_IRV){
+                    continue;
+                }
+                fputc(',', data);
+                if(((pipeline->config.methods >> method) & 0x1) && header->margins[method] != MARGIN_NONE){
+                    fprintf(data, "%u", header->margins[method]);
+                }
+            }
+        }
+        if(pipeline->config.approximate){
+            // elections decided exactly leave the columns empty
+            if(header->has_approximate && header->approximate.num_samples){
+                fprintf(data, ",%lu,%zu,%.1f", header->approximate.num_samples,
+                        header->approximate.num_contenders, header->approximate.error);
+            }else{
+                fprintf(data, ",,,");
+            }
+        }
+        fputc('\n', data);
+    }
+}
+
+static void *writer_main(void *argument){
+    Pipeline *pipeline = argument;
+    RecordRing *ring = &pipeline->ring;
+    size_t tail = ring->tail;
+
+    unsigned attempts = 0;
+    for(;;){
+        size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        if(tail == head){
+            if(__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE) &&
+               __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail){
+                break;
+            }
+            backoff(&attempts);
+            continue;
+        }
+        attempts = 0;
+
+        size_t offset = tail & (ring->capacity-1);
+        const RecordHeader *header = (const RecordHeader*)(ring->buffer + offset);
+        if(!header->length){
+            // rest of the buffer is unused
+            tail += ring->capacity - offset;
+        }else{
+            write_record(header, pipeline);
+            tail += header->length;
+            if(pipeline->telemetry){
+                TELEMETRY_ADD(pipeline->telemetry->records, 1);
+                TELEMETRY_ADD(pipeline->telemetry->record_bytes, header->length);
+            }
+        }
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+    }
+
+    if(pipeline->screen){
+        fflush(pipeline->screen);
+    }
+    if(pipeline->data){
+        fflush(pipeline->data);
+    }
+    return NULL;
+}
+
+static void free_pipeline(Pipeline *pipeline){
+    if(pipeline->screen){
+        fclose(pipeline->screen);
+    }
+    if(pipeline->data){
+        fclose(pipeline->data);
+    }
+    free(pipeline->screen_buffer);
+    free(pipeline->data_buffer);
+    free(pipeline->ring.buffer);
+    free(pipeline->hitler_table);
+    free(pipeline->candidates);
+    free(pipeline->elected);
+    free(pipeline->elected_a);
+    free(pipeline->elected_h);
+}
+
+void pipeline_default_config(PipelineConfig *config){
+    memset(config, 0, sizeof(*config));
+    config->methods = DEFAULT_METHODS;
+    config->ring_size = PIPELINE_RING_SIZE;
+    config->backpressure = BACKPRESSURE_BLOCK;
+}
+
+int pipeline_start(const PipelineConfig *config,
+                   FILE *data,
+                   TelemetryCounters *telemetry,
+                   Pipeline *pipeline){
+    memset(pipeline, 0, sizeof(*pipeline));
+    pipeline->config = *config;
+    pipeline->pool_size = (size_t)1 << config->num_issues;
+    pipeline->data = data;
+    pipeline->telemetry = telemetry;
+    const unsigned methods = config->methods;
+    const unsigned num_issues = config->num_issues;
+    const size_t num_seats = config->num_seats;
+    size_t pool_size = pipeline->pool_size;
+
+    // the largest record (every candidate a winner of every method, of
+    // every threshold radius and in every district, a round per
+    // candidate, and every seat filled) must fit in half the ring
+    size_t largest = sizeof(RecordHeader) + sizeof(CandidateRow)*4*pool_size +
+                     sizeof(IrvRound)*pool_size + sizeof(ThresholdWinner)*(num_issues + 1) +
+                     (config->threshold ? sizeof(size_t)*(num_issues + 1)*pool_size : 0) +
+                     sizeof(ElectoralWinner)*NUM_METHODS +
+                     (config->num_districts ? sizeof(size_t)*NUM_METHODS*pool_size : 0) +
+                     sizeof(CommitteeSeat)*2*((num_seats < pool_size) ? num_seats : pool_size);
+    size_t capacity = 64;
+    while(capacity < config->ring_size || capacity < 2*largest){
+        capacity <<= 1;
+    }
+    pipeline->ring.capacity = capacity;
+    pipeline->ring.buffer = malloc(capacity);
+    pipeline->hitler_table = malloc(sizeof(*pipeline->hitler_table) * pool_size);
+    pipeline->candidates = malloc(sizeof(*pipeline->candidates) * 4*pool_size);
+    pipeline->elected = malloc(sizeof(*pipeline->elected) * pool_size);
+    pipeline->elected_a = malloc(sizeof(*pipeline->elected_a) * pool_size);
+    pipeline->elected_h = malloc(sizeof(*pipeline->elected_h) * pool_size);
+    if(!pipeline->ring.buffer || !pipeline->hitler_table || !pipeline->candidates ||
+       !pipeline->elected || !pipeline->elected_a || !pipeline->elected_h){
+        free_pipeline(pipeline);
+        return -1;
+    }
+
+    if(config->verbose){
+        // write through a private stream so its buffer can be enlarged
+        fflush(stdout);
+        int fd = dup(fileno(stdout));
+        pipeline->screen = (fd < 0) ? NULL : fdopen(fd, "w");
+        if(!pipeline->screen){
+            if(fd >= 0){
+                close(fd);
+            }
+            free_pipeline(pipeline);
+            return -1;
+        }
+        pipeline->screen_buffer = malloc(STREAM_BUFFER_SIZE);
+        if(pipeline->screen_buffer){
+            setvbuf(pipeline->screen, pipeline->screen_buffer, _IOFBF, STREAM_BUFFER_SIZE);
+        }
+    }
+    if(data){
+        pipeline->data_buffer = malloc(STREAM_BUFFER_SIZE);
+        if(pipeline->data_buffer){
+            setvbuf(data, pipeline->data_buffer, _IOFBF, STREAM_BUFFER_SIZE);
+        }
+    }
+    // a resumed data file already has its header
+    if(data && !ftello(data)){
+        fprintf(data, "election,candidates,traditional,approval,hitler,washington,two_party%s%s%s",
+                (methods & (1U << METHOD_IRV)) ? ",irv" : "", config->threshold ? ",threshold" : "",
+                config->turnout ? ",turnout" : "");
+        if(config->num_districts){
+            unsigned m;
+            for(m = 0; m < NUM_METHODS; m++){
+                if(DATA_COLUMNS[m] != METHOD_IRV || (methods & (1U << METHOD_IRV))){
+                    fprintf(data, ",%s_electoral", method_name(DATA_COLUMNS[m]));
+                }
+            }
+        }
+        if(num_seats){
+            fprintf(data, ",chamberlin_courant,sequential_approval");
+        }
+        if(config->minimax){
+            fprintf(data, ",minimax");
+        }
+        if(config->margins){
+            // in the order of the winner columns
+            unsigned m;
+            for(m = 0; m < NUM_METHODS; m++){
+                if(DATA_COLUMNS[m] != METHOD_IRV){
+                    // the two-party margin is only an upper bound
+                    fprintf(data, ",%s_margin%s", method_name(DATA_COLUMNS[m]),
+                            (DATA_COLUMNS[m] == METHOD_TWO_PARTY) ? "_bound" : "");
+                }
+            }
+        }
+        if(config->approximate){
+            fprintf(data, ",approximate_samples,approximate_contenders,approximate_error");
+        }
+        fputc('\n', data);
+    }
+
+    if(pthread_create(&pipeline->writer, NULL, writer_main, pipeline)){
+        free_pipeline(pipeline);
+        return -1;
+    }
+    return 0;
+}
+
+int pipeline_sync(Pipeline *pipeline, uint64_t *length){
+    RecordRing *ring = &pipeline->ring;
+    unsigned attempts = 0;
+    while(__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) != ring->head){
+        backoff(&attempts);
+    }
+
+    // the writer is idle until the next record
+    *length = 0;
+    if(pipeline->screen){
+        fflush(pipeline->screen);
+    }
+    if(pipeline->data){
+        off_t offset;
+        if(fflush(pipeline->data) || fsync(fileno(pipeline->data)) ||
+           (offset = ftello(pipeline->data)) < 0){
+            return -1;
+        }
+        *length = offset;
+    }
+    return 0;
+}
+
+void pipeline_finish(Pipeline *pipeline){
+    __atomic_store_n(&pipeline->ring.closed, 1, __ATOMIC_RELEASE);
+    pthread_join(pipeline->writer, NULL);
+    free_pipeline(pipeline);
+}
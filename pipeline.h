@@ -0,0 +1,219 @@
+/*======================================================================
+ *                              pipeline.h
+ *======================================================================
+ * Producer/consumer pipeline for formatting and writing election results.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Producer/consumer pipeline for formatting and writing election results.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "election.h"
+#include "simulation.h"
+#include "telemetry.h"
+
+/**
+ * Behaviours of the simulation when the output ring is full.
+ */
+typedef enum{
+    BACKPRESSURE_BLOCK, /**< wait for the writer to make room */
+    BACKPRESSURE_DROP /**< drop the per-candidate detail of the record */
+} Backpressure;
+
+/**
+ * Bounded lock-free single-producer/single-consumer ring of variable
+ * length records.
+ *
+ * The head and tail are byte offsets which only ever grow; the producer
+ * owns head and the consumer owns tail. A record never wraps around the
+ * end of the buffer: a zero length marks the rest of the buffer as
+ * unused.
+ */
+typedef struct{
+    unsigned char *buffer; /**< storage of the records */
+    size_t capacity; /**< size in bytes of the buffer; a power of 2 */
+    size_t head; /**< offset where the next record is written */
+    size_t tail; /**< offset of the oldest unread record */
+    size_t reserved; /**< end of the record being written; private to
+                          the producer */
+    unsigned closed; /**< set once the producer has finished */
+} RecordRing;
+
+/**
+ * Default size in bytes of the record ring.
+ */
+#define PIPELINE_RING_SIZE ((size_t)1 << 23)
+
+/**
+ * Configuration of an output pipeline.
+ */
+typedef struct{
+    unsigned methods; /**< set of election methods whose winners are
+                           written to the data file; the fields of other
+                           methods are empty */
+    unsigned population_size; /**< number of voters in the election */
+    unsigned num_issues; /**< number of issues in the election */
+    unsigned verbose; /**< whether to write election statistics to
+                           stdout */
+    unsigned irv_rounds; /**< whether to write the instant-runoff rounds
+                              with the election statistics */
+    unsigned threshold; /**< whether the results submitted carry
+                             threshold approval winners, which are
+                             written to the data file */
+    unsigned turnout; /**< whether to write the turnout of every
+                           election, for voters who may abstain; the
+                           statistics are always relative to the
+                           turnout */
+    unsigned num_districts; /**< number of districts deciding each
+                                 election, whose electoral winners are
+                                 written, or 0 */
+    size_t num_seats; /**< seats of the committees written, or 0 */
+    unsigned minimax; /**< whether to write the minimax platform to the
+                           data file */
+    unsigned margins; /**< whether to write the margins of victory to
+                           the data file */
+    unsigned approximate; /**< whether to write the bounds of the
+                               approximate approval election to the data
+                               file */
+    size_t ring_size; /**< size in bytes of the record ring */
+    Backpressure backpressure; /**< behaviour when the ring is full */
+} PipelineConfig;
+
+/**
+ * Formats and writes election results on a dedicated writer thread.
+ */
+typedef struct{
+    PipelineConfig config; /**< configuration of the pipeline */
+    size_t pool_size; /**< number of possible candidates */
+    RecordRing ring; /**< ring of election records */
+    FILE *screen; /**< stream for election statistics, or NULL */
+    FILE *data; /**< stream for election data, or NULL */
+    char *screen_buffer; /**< buffer of the screen stream */
+    char *data_buffer; /**< buffer of the data stream */
+    unsigned long num_dropped; /**< records whose per-candidate detail
+                                    was dropped */
+    unsigned long num_stalls; /**< times the producer waited for room */
+    pthread_t writer; /**< writer thread */
+    TelemetryCounters *telemetry; /**< counters of the writer, or NULL */
+
+    // writer-side scratch space for rebuilding elections
+    unsigned *hitler_table; /**< hitler votes indexed by platform */
+    Candidate *candidates; /**< candidates of the record */
+    Candidate **elected; /**< traditional election winners */
+    Candidate **elected_a; /**< approval winners */
+    Candidate **elected_h; /**< hitler election winners */
+} Pipeline;
+
+/**
+ * Fills a PipelineConfig structure with the default configuration:
+ * DEFAULT_METHODS, no election statistics nor optional columns, and a
+ * ring of PIPELINE_RING_SIZE bytes which blocks when full. The number of
+ * issues and the population size are left at 0 and must be set by the
+ * caller.
+ *
+ * @param config pointer to the configuration
+ */
+void pipeline_default_config(PipelineConfig *config);
+
+/**
+ * Starts an output pipeline and its writer thread.
+ *
+ * Election statistics are written to standard output when verbose is
+ * configured; election data are written to data when it is not NULL,
+ * the column header first unless data is past its start, as when a run
+ * is resumed. The pipeline takes ownership of data and closes it in
+ * pipeline_finish.
+ *
+ * @param config pointer to the configuration, copied into the pipeline
+ * @param data stream for election data, or NULL
+ * @param telemetry counters for the writer thread, or NULL
+ * @param pipeline pointer to the pipeline
+ *
+ * @return 0 on success, -1 on failure
+ */
+int pipeline_start(const PipelineConfig *config,
+                   FILE *data,
+                   TelemetryCounters *telemetry,
+                   Pipeline *pipeline);
+
+/**
+ * Submits the results of an election to the pipeline. The parts of the
+ * result which are not decided (NULL) are left out of the record, and
+ * the instant-runoff winner is only written when its rounds are.
+ *
+ * @param result pointer to the result of the election
+ * @param pipeline pointer to the pipeline
+ */
+void pipeline_submit(const ElectionResult *result, Pipeline *pipeline);
+
+/**
+ * Waits for the writer to write every election submitted, then flushes
+ * the streams and synchronizes the data file to disk; for use by the
+ * thread submitting the elections.
+ *
+ * @param pipeline pointer to the pipeline
+ * @param length pointer to the variable to hold the length in bytes of
+ *               the data file, 0 if there is none
+ *
+ * @return 0 on success, -1 if the data file could not be written
+ */
+int pipeline_sync(Pipeline *pipeline, uint64_t *length);
+
+/**
+ * Waits for the writer to drain the pipeline, then releases it.
+ *
+ * @param pipeline pointer to the pipeline
+ */
+void pipeline_finish(Pipeline *pipeline);
+
+#endif
@@ -0,0 +1,432 @@
+/*======================================================================
+ *                              sampling.c
+ *======================================================================
+ * Variance-reduction schemes for drawing vote allocations.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Variance-reduction schemes for drawing vote allocations.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "checkpoint.h"
+#include "confuzz.h"
+#include "sampling.h"
+
+/*
+ * Primitive polynomials and initial direction numbers of the Sobol'
+ * sequence for dimensions 1 through 31 (Joe and Kuo, 2008); dimension 0
+ * is the van der Corput sequence. Each row holds the degree s, the
+ * coefficients a, and the initial direction numbers m_1..m_s.
+ */
+static const unsigned SOBOL_TABLE[SOBOL_DIMENSIONS-1][9] = {
+    {1, 0, 1},
+    {2, 1, 1, 3},
+    {3, 1, 1, 3, 1},
+    {3, 2, 1, 1, 1},
+    {4, 1, 1, 1, 3, 3},
+    {4, 4, 1, 3, 5, 13},
+    {5, 2, 1, 1, 5, 5, 17},
+    {5, 4, 1, 1, 5, 5, 5},
+    {5, 7, 1, 1, 7, 11, 19},
+    {5, 11, 1, 1, 5, 1, 1},
+    {5, 13, 1, 1, 1, 3, 11},
+    {5, 14, 1, 3, 5, 5, 31},
+    {6, 1, 1, 3, 3, 9, 7, 49},
+    {6, 13, 1, 1, 1, 15, 21, 21},
+    {6, 16, 1, 3, 1, 13, 27, 49},
+    {6, 19, 1, 1, 1, 15, 7, 5},
+    {6, 22, 1, 3, 1, 15, 13, 25},
+    {6, 25, 1, 1, 5, 5, 19, 61},
+    {7, 1, 1, 3, 7, 11, 23, 15, 103},
+    {7, 4, 1, 3, 7, 13, 13, 15, 69},
+    {7, 7, 1, 1, 3, 13, 7, 35, 63},
+    {7, 8, 1, 3, 5, 9, 1, 25, 53},
+    {7, 14, 1, 3, 1, 13, 9, 35, 107},
+    {7, 19, 1, 3, 1, 5, 27, 61, 31},
+    {7, 21, 1, 1, 5, 11, 19, 41, 61},
+    {7, 28, 1, 3, 5, 3, 3, 13, 69},
+    {7, 31, 1, 1, 7, 13, 1, 19, 1},
+    {7, 32, 1, 3, 7, 5, 13, 19, 59},
+    {7, 37, 1, 1, 3, 9, 25, 29, 41},
+    {7, 41, 1, 3, 5, 13, 23, 1, 55},
+    {7, 42, 1, 3, 7, 3, 13, 59, 17}
+};
+
+static const char *SAMPLING_NAMES[] = {"plain", "antithetic", "stratified", "sobol"};
+
+/*
+ * rand_next supplies 31 bits per draw, so random words are assembled
+ * from two draws.
+ */
+static uint32_t random_word(RandomState *random){
+    uint32_t word = rand_next(random);
+    return (word<<1) | (rand_next(random) & 0x1);
+}
+
+/*
+ * Maps a uniform in [0, 1) to a draw in [0, ceiling).
+ */
+static unsigned scale_uniform(unsigned ceiling, double uniform){
+    unsigned draw = uniform*ceiling;
+    return (draw < ceiling) ? draw : ceiling-1;
+}
+
+/*
+ * Linear (Matousek) scrambling of a direction number: output bit k
+ * (counted from the most significant bit) is the parity of the input
+ * bits selected by a random lower-triangular row with a unit diagonal.
+ */
+static uint32_t scramble_direction(uint32_t direction, const uint32_t *rows){
+    uint32_t scrambled = 0;
+    unsigned k;
+    for(k = 0; k < 32; k++){
+        uint32_t bits = direction & rows[k];
+        unsigned parity = 0;
+        while(bits){
+            parity ^= 1;
+            bits &= bits - 1;
+        }
+        scrambled |= (uint32_t)parity << (31-k);
+    }
+    return scrambled;
+}
+
+static void init_sobol_replicate(RandomState *random,
+                                 uint32_t *directions,
+                                 uint32_t *point){
+    size_t d;
+    for(d = 0; d < SOBOL_DIMENSIONS; d++){
+        uint32_t *v = directions + d*32;
+        unsigned k;
+        if(d == 0){
+            for(k = 0; k < 32; k++){
+                v[k] = (uint32_t)1 << (31-k);
+            }
+        }else{
+            const unsigned *row = SOBOL_TABLE[d-1];
+            unsigned s = row[0], a = row[1];
+            for(k = 0; k < s; k++){
+                v[k] = (uint32_t)row[2+k] << (31-k);
+            }
+            for(k = s; k < 32; k++){
+                v[k] = v[k-s] ^ (v[k-s] >> s);
+                unsigned i;
+                for(i = 1; i < s; i++){
+                    if((a >> (s-1-i)) & 0x1){
+                        v[k] ^= v[k-i];
+                    }
+                }
+            }
+        }
+
+        // scramble direction numbers with a random lower-triangular matrix
+        uint32_t rows[32];
+        for(k = 0; k < 32; k++){
+            uint32_t upper = k ? ~(((uint32_t)(-1)) >> k) : 0;
+            rows[k] = (random_word(random) & upper) | ((uint32_t)1 << (31-k));
+        }
+        for(k = 0; k < 32; k++){
+            v[k] = scramble_direction(v[k], rows);
+        }
+
+        // random digital shift
+        point[d] = random_word(random);
+    }
+}
+
+int parse_sampling_scheme(const char *name, SamplingScheme *scheme){
+    size_t i;
+    for(i = 0; i < sizeof(SAMPLING_NAMES)/sizeof(*SAMPLING_NAMES); i++){
+        if(!strcmp(name, SAMPLING_NAMES[i])){
+            *scheme = i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *sampling_scheme_name(SamplingScheme scheme){
+    return SAMPLING_NAMES[scheme];
+}
+
+int sampler_init(unsigned num_replicates,
+                 size_t pool_size,
+                 SamplingScheme scheme,
+                 RandomState *random,
+                 Sampler *sampler){
+    memset(sampler, 0, sizeof(*sampler));
+    sampler->scheme = scheme;
+    sampler->random = random;
+    // each step of perform_election draws a candidate and its votes
+    sampler->num_dimensions = 2*pool_size;
+    sampler->num_replicates = 1;
+
+    if(scheme == SAMPLING_ANTITHETIC){
+        sampler->uniforms = malloc(sizeof(*sampler->uniforms) * sampler->num_dimensions);
+        if(!sampler->uniforms){
+            return -1;
+        }
+    }else if(scheme == SAMPLING_SOBOL){
+        sampler->num_replicates = num_replicates ? num_replicates : 1;
+        sampler->directions = malloc(sizeof(*sampler->directions) *
+                                     sampler->num_replicates * SOBOL_DIMENSIONS * 32);
+        sampler->points = malloc(sizeof(*sampler->points) *
+                                 sampler->num_replicates * SOBOL_DIMENSIONS);
+        sampler->point = malloc(sizeof(*sampler->point) * SOBOL_DIMENSIONS);
+        if(!sampler->directions || !sampler->points || !sampler->point){
+            sampler_free(sampler);
+            return -1;
+        }
+        unsigned r;
+        for(r = 0; r < sampler->num_replicates; r++){
+            init_sobol_replicate(random,
+                                 sampler->directions + r*SOBOL_DIMENSIONS*32,
+                                 sampler->points + r*SOBOL_DIMENSIONS);
+        }
+    }
+    return 0;
+}
+
+void sampler_reset(Sampler *sampler){
+    sampler->num_begun = 0;
+    sampler->dimension = 0;
+    sampler->num_recorded = 0;
+    if(sampler->scheme == SAMPLING_SOBOL){
+        unsigned r;
+        for(r = 0; r < sampler->num_replicates; r++){
+            init_sobol_replicate(sampler->random,
+                                 sampler->directions + r*SOBOL_DIMENSIONS*32,
+                                 sampler->points + r*SOBOL_DIMENSIONS);
+        }
+    }
+}
+
+void sampler_free(Sampler *sampler){
+    free(sampler->uniforms);
+    free(sampler->directions);
+    free(sampler->points);
+    free(sampler->point);
+    sampler->uniforms = NULL;
+    sampler->directions = NULL;
+    sampler->points = NULL;
+    sampler->point = NULL;
+}
+
+int sampler_save(const Sampler *sampler, FILE *stream){
+    size_t num_points = (sampler->scheme == SAMPLING_SOBOL) ?
+                        sampler->num_replicates * SOBOL_DIMENSIONS : 0;
+    size_t num_recorded = (sampler->scheme == SAMPLING_ANTITHETIC) ? sampler->num_recorded : 0;
+    return -(checkpoint_put(&sampler->num_begun, sizeof(sampler->num_begun), stream) ||
+             checkpoint_put(&num_recorded, sizeof(num_recorded), stream) ||
+             checkpoint_put(sampler->uniforms, sizeof(*sampler->uniforms) * num_recorded, stream) ||
+             checkpoint_put(sampler->points, sizeof(*sampler->points) * num_points, stream));
+}
+
+int sampler_load(FILE *stream, Sampler *sampler){
+    size_t num_points = (sampler->scheme == SAMPLING_SOBOL) ?
+                        sampler->num_replicates * SOBOL_DIMENSIONS : 0;
+    size_t num_recorded;
+    if(checkpoint_get(&sampler->num_begun, sizeof(sampler->num_begun), stream) ||
+       checkpoint_get(&num_recorded, sizeof(num_recorded), stream) ||
+       (num_recorded && (sampler->scheme != SAMPLING_ANTITHETIC ||
+                         num_recorded > sampler->num_dimensions))){
+        return -1;
+    }
+    // elections begin with their first draw
+    sampler->dimension = 0;
+    sampler->num_recorded = num_recorded;
+    return -(checkpoint_get(sampler->uniforms, sizeof(*sampler->uniforms) * num_recorded, stream) ||
+             checkpoint_get(sampler->points, sizeof(*sampler->points) * num_points, stream));
+}
+
+void sampler_begin_election(Sampler *sampler){
+    unsigned long election = sampler->num_begun++;
+    sampler->dimension = 0;
+
+    if(sampler->scheme == SAMPLING_ANTITHETIC){
+        // the first election of a pair records fresh uniforms
+        if(!(election & 0x1)){
+            sampler->num_recorded = 0;
+        }
+    }else if(sampler->scheme == SAMPLING_SOBOL){
+        unsigned r = election % sampler->num_replicates;
+        unsigned long n = election / sampler->num_replicates;
+        uint32_t *points = sampler->points + r*SOBOL_DIMENSIONS;
+        const uint32_t *directions = sampler->directions + r*SOBOL_DIMENSIONS*32;
+        memcpy(sampler->point, points, sizeof(*points) * SOBOL_DIMENSIONS);
+
+        // advance the replicate in Gray code order: flip the direction
+        // number of the lowest zero bit of the point index
+        unsigned c = 0;
+        while(n & 0x1){
+            n >>= 1;
+            c++;
+        }
+        c &= 31;
+        size_t d;
+        for(d = 0; d < SOBOL_DIMENSIONS; d++){
+            points[d] ^= directions[d*32 + c];
+        }
+    }
+}
+
+unsigned sampler_draw(unsigned ceiling, Sampler *sampler){
+    size_t d = sampler->dimension++;
+
+    switch(sampler->scheme){
+    case SAMPLING_ANTITHETIC:
+        if((sampler->num_begun-1) & 0x1){
+            // second election of a pair mirrors the first
+            if(d < sampler->num_recorded){
+                return ceiling - 1 - scale_uniform(ceiling, sampler->uniforms[d]);
+            }
+            return rand_ceiling(ceiling, sampler->random);
+        }else if(d < sampler->num_dimensions){
+            sampler->uniforms[d] = rand_uniform(sampler->random);
+            sampler->num_recorded = d+1;
+            return scale_uniform(ceiling, sampler->uniforms[d]);
+        }
+        return rand_ceiling(ceiling, sampler->random);
+    case SAMPLING_SOBOL:
+        if(d < SOBOL_DIMENSIONS){
+            return ((uint64_t)(sampler->point[d]) * ceiling) >> 32;
+        }
+        return rand_ceiling(ceiling, sampler->random);
+    default:
+        return rand_ceiling(ceiling, sampler->random);
+    }
+}
+
+unsigned sampler_replicate(const Sampler *sampler){
+    if(sampler->scheme != SAMPLING_SOBOL || !sampler->num_begun){
+        return 0;
+    }
+    return (sampler->num_begun-1) % sampler->num_replicates;
+}
+
+/*
+ * The vote draws of perform_election form a Markov chain on the number
+ * of voters left V: a draw of 0 votes leaves V unchanged, while each of
+ * the V nonzero draws records a new candidate. The chain stops when V
+ * reaches 0 or after pool_size-1 draws, in which case any trailing
+ * voters form one more candidate. The distribution of (V, count) is
+ * pushed forward until the mass still in motion is negligible.
+ */
+int candidate_count_distribution(unsigned population_size,
+                                 size_t num_strata,
+                                 size_t pool_size,
+                                 double *probabilities){
+    // counts are capped at num_strata, index 0 is "no candidates yet"
+    size_t width = num_strata + 1;
+    size_t cells = (size_t)(population_size+1) * width;
+    double *alive = calloc(cells, sizeof(*alive));
+    double *next = calloc(cells, sizeof(*next));
+    double *tail = calloc(width, sizeof(*tail));
+    if(!alive || !next || !tail){
+        free(alive);
+        free(next);
+        free(tail);
+        return -1;
+    }
+
+    size_t k;
+    for(k = 0; k < num_strata; k++){
+        probabilities[k] = 0;
+    }
+
+    alive[(size_t)population_size*width] = 1.0;
+    double moving = 1.0;
+    size_t step;
+    for(step = 0; step+1 < pool_size && moving > 1e-18; step++){
+        unsigned v;
+        for(k = 0; k < width; k++){
+            tail[k] = 0;
+        }
+        moving = 0;
+        // sweep V downward so tail holds the mass drawn from above V
+        for(v = population_size; v > 0; v--){
+            double *from = alive + (size_t)v*width;
+            double *to = next + (size_t)v*width;
+            // draw of zero votes
+            for(k = 0; k < width; k++){
+                to[k] = from[k]/(v+1);
+            }
+            // voters from above drawn down to v record a new candidate
+            for(k = 0; k < width; k++){
+                to[(k+1 < width) ? k+1 : k] += tail[k];
+            }
+            for(k = 0; k < width; k++){
+                tail[k] += from[k]/(v+1);
+                moving += to[k];
+            }
+        }
+        // draws of every remaining voter end the election
+        for(k = 0; k < width; k++){
+            size_t count = (k+1 < width) ? k+1 : k;
+            probabilities[count-1] += tail[k];
+        }
+        double *swap = alive;
+        alive = next;
+        next = swap;
+    }
+
+    // trailing voters form one last candidate
+    unsigned v;
+    for(v = 1; v <= population_size; v++){
+        for(k = 0; k < width; k++){
+            size_t count = (k+1 < width) ? k+1 : k;
+            probabilities[count-1] += alive[(size_t)v*width + k];
+        }
+    }
+
+    free(alive);
+    free(next);
+    free(tail);
+    return 0;
+}
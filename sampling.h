@@ -0,0 +1,232 @@
+/*======================================================================
+ *                              sampling.h
+ *======================================================================
+ * Variance-reduction schemes for drawing vote allocations.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Variance-reduction schemes for drawing vote allocations.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef SAMPLING_H
+#define SAMPLING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "confuzz.h"
+
+/**
+ * Number of Sobol' dimensions driven by the low-discrepancy sequence;
+ * draws beyond this dimension within an election are pseudo-random.
+ */
+#define SOBOL_DIMENSIONS 32
+
+/**
+ * Schemes for drawing the vote allocation of each election.
+ */
+typedef enum{
+    SAMPLING_PLAIN, /**< independent allocations (rand_ceiling) */
+    SAMPLING_ANTITHETIC, /**< pairs of allocations driven by
+                              complementary uniforms */
+    SAMPLING_STRATIFIED, /**< independent allocations post-stratified
+                              over the number of actual candidates */
+    SAMPLING_SOBOL /**< allocations driven by scrambled Sobol' points */
+} SamplingScheme;
+
+/**
+ * Supplies the random draws of perform_election for a sampling scheme.
+ */
+typedef struct{
+    SamplingScheme scheme; /**< sampling scheme in use */
+    RandomState *random; /**< generator of the pseudo-random draws */
+    unsigned long num_begun; /**< number of elections begun */
+    size_t dimension; /**< index of the next draw within the election */
+    size_t num_dimensions; /**< maximum number of draws per election */
+    size_t num_recorded; /**< number of uniforms recorded for the
+                              antithetic partner */
+    double *uniforms; /**< uniforms of the first election of an
+                           antithetic pair */
+    unsigned num_replicates; /**< number of independently scrambled
+                                  Sobol' sequences */
+    uint32_t *directions; /**< scrambled Sobol' direction numbers, per
+                               replicate and dimension */
+    uint32_t *points; /**< current Sobol' point of each replicate */
+    uint32_t *point; /**< Sobol' point of the election being drawn */
+} Sampler;
+
+/**
+ * Parses the name of a sampling scheme.
+ *
+ * @param name name of the sampling scheme
+ * @param scheme pointer to the variable to hold the scheme
+ *
+ * @return 0 on success, -1 if name is not a known scheme
+ */
+int parse_sampling_scheme(const char *name, SamplingScheme *scheme);
+
+/**
+ * Returns the name of a sampling scheme.
+ *
+ * @param scheme the sampling scheme
+ *
+ * @return the name of the sampling scheme
+ */
+const char *sampling_scheme_name(SamplingScheme scheme);
+
+/**
+ * Initializes a Sampler structure.
+ *
+ * @param num_replicates number of scrambled Sobol' replicates
+ * @param pool_size number of possible candidates
+ * @param scheme sampling scheme
+ * @param random pointer to the generator state; draws of the sampler
+ *               advance it
+ * @param sampler pointer to the sampler
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int sampler_init(unsigned num_replicates,
+                 size_t pool_size,
+                 SamplingScheme scheme,
+                 RandomState *random,
+                 Sampler *sampler);
+
+/**
+ * Restarts a sampler as if freshly initialized, keeping its memory; the
+ * Sobol' replicates are scrambled anew from the generator.
+ *
+ * @param sampler pointer to the sampler
+ */
+void sampler_reset(Sampler *sampler);
+
+/**
+ * Releases the memory held by a Sampler structure.
+ *
+ * @param sampler pointer to the sampler
+ */
+void sampler_free(Sampler *sampler);
+
+/**
+ * Saves the progress of a sampler to a checkpoint: the elections begun,
+ * the uniforms of an unfinished antithetic pair, and the current Sobol'
+ * points. The direction numbers are not saved; a sampler initialized
+ * from the same generator state draws them alike.
+ *
+ * @param sampler pointer to the sampler
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the write failed
+ *
+ * @sa checkpoint_begin
+ */
+int sampler_save(const Sampler *sampler, FILE *stream);
+
+/**
+ * Restores the progress of a sampler saved by sampler_save.
+ *
+ * @param stream stream of the checkpoint
+ * @param sampler pointer to a sampler of the same scheme, replicates,
+ *                and pool size as the one saved
+ *
+ * @return 0 on success, -1 if the checkpoint ended first or does not
+ *         fit the sampler
+ */
+int sampler_load(FILE *stream, Sampler *sampler);
+
+/**
+ * Prepares a sampler for the draws of the next election.
+ *
+ * @param sampler pointer to the sampler
+ */
+void sampler_begin_election(Sampler *sampler);
+
+/**
+ * Returns the next draw of the current election in the range
+ * [0, ceiling).
+ *
+ * @param ceiling a range ceiling less than (CONFUZZ_RAND_MAX + 1)
+ * @param sampler pointer to the sampler
+ *
+ * @return a draw in the range [0, ceiling)
+ *
+ * @sa rand_ceiling
+ */
+unsigned sampler_draw(unsigned ceiling, Sampler *sampler);
+
+/**
+ * Returns the replicate of the election most recently begun.
+ *
+ * @param sampler pointer to the sampler
+ *
+ * @return index of the replicate; always 0 for schemes other than
+ *         SAMPLING_SOBOL
+ */
+unsigned sampler_replicate(const Sampler *sampler);
+
+/**
+ * Computes the distribution of the number of actual candidates produced
+ * by perform_election.
+ *
+ * The number of actual candidates depends only on the vote draws, so it
+ * is found by a forward recursion over the number of voters left.
+ * Counts of num_strata or more candidates are lumped together.
+ *
+ * @param population_size number of voters in the election
+ * @param num_strata number of strata
+ * @param pool_size number of possible candidates
+ * @param probabilities array to hold the probability of each stratum;
+ *                      stratum k holds the elections with k+1 actual
+ *                      candidates
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int candidate_count_distribution(unsigned population_size,
+                                 size_t num_strata,
+                                 size_t pool_size,
+                                 double *probabilities);
+
+#endif
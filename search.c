@@ -0,0 +1,367 @@
+/*======================================================================
+ *                               search.c
+ *======================================================================
+ * Platforms winning most often against a batch of elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Platforms winning most often against a batch of elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "confuzz.h"
+#include "search.h"
+
+/**
+ * Chains of a search, threaded through the worker pool.
+ */
+typedef struct{
+    unsigned long num_steps; /**< proposals of each chain */
+    uint64_t seed; /**< seed of the chains */
+    uint64_t stream; /**< stream of the first chain */
+    const SearchBatch *batch; /**< batch evaluated */
+    unsigned *sums; /**< disapproval sums of the platform of each chain
+                         per election, under the approval method */
+    SearchPlatform *platforms; /**< best platform of each chain */
+} SearchChains;
+
+unsigned search_method_supported(Method method){
+    return method == METHOD_APPROVAL || method == METHOD_TRADITIONAL ||
+           method == METHOD_WASHINGTON;
+}
+
+void search_batch_init(unsigned num_issues, Method method, SearchBatch *batch){
+    memset(batch, 0, sizeof(*batch));
+    batch->num_issues = num_issues;
+    batch->method = method;
+}
+
+/*
+ * Grows the arrays of a batch to hold another election of num_winners
+ * winners.
+ */
+static int reserve_election(size_t num_winners, SearchBatch *batch){
+    const unsigned num_issues = batch->num_issues;
+    if(batch->num_elections == batch->capacity){
+        unsigned long capacity = batch->capacity ? 2*batch->capacity : 64;
+        if(batch->method == METHOD_APPROVAL){
+            unsigned *zero = realloc(batch->zero, sizeof(*zero) * capacity);
+            batch->zero = zero ? zero : batch->zero;
+            int *flips = realloc(batch->flips, sizeof(*flips) * capacity * num_issues);
+            batch->flips = flips ? flips : batch->flips;
+            unsigned *best = realloc(batch->best, sizeof(*best) * capacity);
+            batch->best = best ? best : batch->best;
+            if(!zero || !flips || !best){
+                return -1;
+            }
+        }else{
+            size_t *offsets = realloc(batch->offsets, sizeof(*offsets) * (capacity + 1));
+            if(!offsets){
+                return -1;
+            }
+            batch->offsets = offsets;
+            if(!batch->capacity){
+                offsets[0] = 0;
+            }
+        }
+        batch->capacity = capacity;
+    }
+    if(batch->method != METHOD_APPROVAL &&
+       batch->offsets[batch->num_elections] + num_winners > batch->winners_capacity){
+        size_t capacity = 2*(batch->offsets[batch->num_elections] + num_winners);
+        size_t *winners = realloc(batch->winners, sizeof(*winners) * capacity);
+        if(!winners){
+            return -1;
+        }
+        batch->winners = winners;
+        batch->winners_capacity = capacity;
+    }
+    return 0;
+}
+
+int search_batch_add(const ElectionResult *result, SearchBatch *batch){
+    const unsigned num_issues = batch->num_issues;
+    size_t num_winners = (batch->method == METHOD_TRADITIONAL) ? result->num_winners :
+                         (batch->method == METHOD_WASHINGTON) ? 1 : 0;
+    if(reserve_election(num_winners, batch)){
+        return -1;
+    }
+
+    const unsigned long e = batch->num_elections++;
+    if(batch->method == METHOD_APPROVAL){
+        // platform 0 disagrees with every voter of stance 1
+        unsigned *zero = batch->zero + e;
+        int *flips = batch->flips + e*num_issues;
+        *zero = 0;
+        unsigned i;
+        for(i = 0; i < num_issues; i++){
+            unsigned stance_poll = 0;
+            size_t c;
+            for(c = 0; c < result->num_candidates; c++){
+                stance_poll += ((result->candidates[c].id >> i) & 0x1) * result->candidates[c].votes;
+            }
+            *zero += stance_poll;
+            flips[i] = (int)result->turnout - 2*(int)stance_poll;
+        }
+        // with no candidates, any platform wins
+        batch->best[e] = result->num_a_winners ? result->elected_a[0]->sum_disapproval : UINT_MAX;
+        return 0;
+    }
+
+    size_t *winners = batch->winners + batch->offsets[e];
+    if(batch->method == METHOD_WASHINGTON){
+        winners[0] = result->washington.id;
+    }else{
+        size_t w;
+        for(w = 0; w < num_winners; w++){
+            winners[w] = result->elected[w]->id;
+        }
+    }
+    batch->offsets[e + 1] = batch->offsets[e] + num_winners;
+    return 0;
+}
+
+void search_batch_free(SearchBatch *batch){
+    free(batch->zero);
+    free(batch->flips);
+    free(batch->best);
+    free(batch->offsets);
+    free(batch->winners);
+    search_batch_init(batch->num_issues, batch->method, batch);
+}
+
+/*
+ * Disapproval sum of a platform in an election of an approval batch.
+ */
+static unsigned disapproval(size_t id, unsigned long e, const SearchBatch *batch){
+    const int *flips = batch->flips + e*batch->num_issues;
+    unsigned sum = batch->zero[e];
+    unsigned i;
+    for(i = 0; i < batch->num_issues; i++){
+        if((id >> i) & 0x1){
+            sum += flips[i];
+        }
+    }
+    return sum;
+}
+
+unsigned long search_wins(size_t id, const SearchBatch *batch){
+    unsigned long wins = 0;
+    unsigned long e;
+    for(e = 0; e < batch->num_elections; e++){
+        if(batch->method == METHOD_APPROVAL){
+            wins += disapproval(id, e, batch) <= batch->best[e];
+        }else{
+            size_t w;
+            for(w = batch->offsets[e]; w < batch->offsets[e + 1]; w++){
+                if(batch->winners[w] == id){
+                    wins++;
+                    break;
+                }
+            }
+        }
+    }
+    return wins;
+}
+
+/*
+ * Runs the chains [first, last).
+ */
+static void run_chains(size_t first, size_t last, unsigned thread, void *argument){
+    SearchChains *chains = argument;
+    const SearchBatch *batch = chains->batch;
+    const unsigned num_issues = batch->num_issues;
+    const unsigned long num_elections = batch->num_elections;
+    // the temperature falls from a twentieth of the batch to 0.01 wins
+    const double start = 1 + num_elections/20.0;
+    const double cooling = pow(0.01/start, 1.0/(chains->num_steps + 1));
+    (void)thread;
+
+    size_t c;
+    for(c = first; c < last; c++){
+        RandomState random;
+        rand_seed(chains->seed, chains->stream + c, &random);
+        size_t id = rand_ceiling(1U << num_issues, &random);
+        unsigned *sums = chains->sums ? chains->sums + c*num_elections : NULL;
+        unsigned long e;
+        if(sums){
+            for(e = 0; e < num_elections; e++){
+                sums[e] = disapproval(id, e, batch);
+            }
+        }
+        unsigned long wins = search_wins(id, batch);
+        SearchPlatform *best = chains->platforms + c;
+        best->id = id;
+        best->wins = wins;
+        best->validated = 0;
+
+        double temperature = start;
+        unsigned long s;
+        for(s = 0; s < chains->num_steps; s++, temperature *= cooling){
+            unsigned issue = rand_ceiling(num_issues, &random);
+            size_t next = id ^ ((size_t)1 << issue);
+            // a flip moves each sum by its change, signed by the stance
+            // it leaves
+            unsigned long next_wins = 0;
+            if(sums){
+                const int sign = ((id >> issue) & 0x1) ? -1 : 1;
+                for(e = 0; e < num_elections; e++){
+                    int64_t sum = (int64_t)sums[e] + sign*batch->flips[e*num_issues + issue];
+                    next_wins += sum <= batch->best[e];
+                }
+            }else{
+                next_wins = search_wins(next, batch);
+            }
+            if(next_wins < wins &&
+               rand_uniform(&random) >= exp(((double)next_wins - wins)/temperature)){
+                continue;
+            }
+            if(sums){
+                const int sign = ((id >> issue) & 0x1) ? -1 : 1;
+                for(e = 0; e < num_elections; e++){
+                    sums[e] += sign*batch->flips[e*num_issues + issue];
+                }
+            }
+            id = next;
+            wins = next_wins;
+            if(wins > best->wins){
+                best->id = id;
+                best->wins = wins;
+            }
+        }
+    }
+}
+
+/* Orders platforms by descending wins, then ascending id. */
+static int sort_platforms(const void *a, const void *b){
+    const SearchPlatform *p = a;
+    const SearchPlatform *q = b;
+    if(p->wins != q->wins){
+        return (p->wins < q->wins) ? 1 : -1;
+    }
+    return (p->id > q->id) - (p->id < q->id);
+}
+
+int search_platforms(unsigned num_restarts,
+                     unsigned long num_steps,
+                     uint64_t seed,
+                     uint64_t stream,
+                     const SearchBatch *batch,
+                     WorkerPool *pool,
+                     size_t *num_platforms,
+                     SearchPlatform *platforms){
+    SearchChains chains;
+    chains.num_steps = num_steps;
+    chains.seed = seed;
+    chains.stream = stream;
+    chains.batch = batch;
+    chains.sums = NULL;
+    chains.platforms = platforms;
+    if(batch->method == METHOD_APPROVAL && batch->num_elections){
+        chains.sums = malloc(sizeof(*chains.sums) * num_restarts * batch->num_elections);
+        if(!chains.sums){
+            return -1;
+        }
+    }
+    worker_pool_run(num_restarts, num_steps * batch->num_elections, run_chains, &chains, pool);
+    free(chains.sums);
+
+    // chains which met report their platform once
+    qsort(platforms, num_restarts, sizeof(*platforms), sort_platforms);
+    size_t p;
+    *num_platforms = 0;
+    for(p = 0; p < num_restarts; p++){
+        if(!*num_platforms || platforms[p].id != platforms[*num_platforms - 1].id){
+            platforms[(*num_platforms)++] = platforms[p];
+        }
+    }
+    return 0;
+}
+
+/*
+ * Wilson score interval of a binomial proportion at the 95% level.
+ */
+static void wilson_interval(unsigned long wins, unsigned long trials, double *low, double *high){
+    const double z = 1.959963984540054;
+    if(!trials){
+        *low = 0;
+        *high = 1;
+        return;
+    }
+    double rate = (double)wins/trials;
+    double denominator = 1 + z*z/trials;
+    double center = (rate + z*z/(2.0*trials))/denominator;
+    double width = z*sqrt(rate*(1 - rate)/trials + z*z/(4.0*trials*trials))/denominator;
+    *low = (center - width > 0) ? center - width : 0;
+    *high = (center + width < 1) ? center + width : 1;
+}
+
+void print_search_result(const SearchBatch *batch,
+                         unsigned long num_validation,
+                         size_t num_platforms,
+                         const SearchPlatform *platforms){
+    printf("\n========== PLATFORM SEARCH ==========\n");
+    printf("Method: %s\n", method_name(batch->method));
+    printf("Search Elections: %lu\n", batch->num_elections);
+    printf("Validation Elections: %lu\n", num_validation);
+
+    printf("\nPlatform          Search   Validation      95%% Interval\n");
+    size_t p;
+    for(p = 0; p < num_platforms && p < SEARCH_MAX_REPORTED; p++){
+        double low, high;
+        wilson_interval(platforms[p].validated, num_validation, &low, &high);
+        printf("  %-12zu  %8.4lf     %8.4lf  [%.4lf, %.4lf]\n", platforms[p].id,
+               batch->num_elections ? (double)platforms[p].wins/batch->num_elections : 0,
+               num_validation ? (double)platforms[p].validated/num_validation : 0,
+               low, high);
+    }
+
+    printf("\n----------------------------------------------------------------------\n");
+}
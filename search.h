@@ -0,0 +1,204 @@
+/*======================================================================
+ *                               search.h
+ *======================================================================
+ * Platforms winning most often against a batch of elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Platforms winning most often against a batch of elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "election.h"
+#include "simulation.h"
+#include "workers.h"
+
+/**
+ * Most platforms reported by print_search_result.
+ */
+#define SEARCH_MAX_REPORTED 10
+
+/**
+ * Elections against which every platform is evaluated, the common
+ * random numbers of the search.
+ *
+ * A platform wins an election if it is among the winners of the method
+ * searched when it stands, with no votes unless it is a voter group.
+ * Under the approval method, its disapproval sum is the sum over the
+ * issues of the voters who disagree with it, so it follows from the
+ * stance poll alone: an election keeps the sum of platform 0, the
+ * change from flipping each issue, and the least sum of the candidates.
+ * Under the traditional and washington methods, which a platform
+ * without votes never wins, an election keeps the ids of its winners.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the elections */
+    Method method; /**< method searched: approval, traditional, or
+                        washington */
+    unsigned long num_elections; /**< number of elections recorded */
+    unsigned long capacity; /**< number of elections allocated */
+    unsigned *zero; /**< disapproval sum of platform 0 per election */
+    int *flips; /**< change of the disapproval sum from flipping each
+                     issue, num_issues per election */
+    unsigned *best; /**< least disapproval sum of the candidates per
+                         election */
+    size_t *offsets; /**< first winner of each election, and one past
+                          the last winner */
+    size_t *winners; /**< ids of the winners of every election */
+    size_t winners_capacity; /**< number of winners allocated */
+} SearchBatch;
+
+/**
+ * Platform found by a search.
+ */
+typedef struct{
+    size_t id; /**< id of the platform */
+    unsigned long wins; /**< elections of the search batch it wins */
+    unsigned long validated; /**< elections of the validation batch it
+                                  wins; set by the caller */
+} SearchPlatform;
+
+/**
+ * Checks whether a method can be searched.
+ *
+ * @param method election method
+ *
+ * @return 1 for the approval, traditional, and washington methods, 0
+ *         otherwise
+ */
+unsigned search_method_supported(Method method);
+
+/**
+ * Initializes an empty SearchBatch structure.
+ *
+ * @param num_issues number of issues in the elections
+ * @param method method searched; see search_method_supported
+ * @param batch pointer to the batch
+ */
+void search_batch_init(unsigned num_issues, Method method, SearchBatch *batch);
+
+/**
+ * Records an election in a SearchBatch structure. The method searched
+ * must have been decided, with every platform with votes standing.
+ *
+ * @param result pointer to the result of the election
+ * @param batch pointer to the batch
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int search_batch_add(const ElectionResult *result, SearchBatch *batch);
+
+/**
+ * Releases the memory held by a SearchBatch structure.
+ *
+ * @param batch pointer to the batch
+ */
+void search_batch_free(SearchBatch *batch);
+
+/**
+ * Counts the elections of a batch that a platform wins.
+ *
+ * @param id id of the platform
+ * @param batch pointer to the batch
+ *
+ * @return number of elections won
+ */
+unsigned long search_wins(size_t id, const SearchBatch *batch);
+
+/**
+ * Searches the platforms winning the most elections of a batch by
+ * simulated annealing over single issue flips.
+ *
+ * Every restart is a chain starting from a random platform, on its own
+ * stream, which proposes flipping a random issue and accepts a loss of
+ * wins with a probability falling geometrically over its steps; every
+ * proposal is evaluated against the whole batch. The chains are split
+ * between the threads of the pool, and the results do not depend on
+ * it.
+ *
+ * @param num_restarts number of chains
+ * @param num_steps proposals of each chain
+ * @param seed seed of the chains
+ * @param stream stream of the first chain; chain c uses stream+c
+ * @param batch pointer to the batch
+ * @param pool pointer to the pool, or NULL
+ * @param num_platforms pointer to the number of distinct platforms
+ *                      found
+ * @param platforms array of num_restarts to hold the best platform of
+ *                  each chain, distinct and by descending wins
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int search_platforms(unsigned num_restarts,
+                     unsigned long num_steps,
+                     uint64_t seed,
+                     uint64_t stream,
+                     const SearchBatch *batch,
+                     WorkerPool *pool,
+                     size_t *num_platforms,
+                     SearchPlatform *platforms);
+
+/**
+ * Prints the platforms found by a search with their rates of winning
+ * the search batch and the validation batch, and the 95% Wilson score
+ * interval of the latter; the search batch overstates the rate of the
+ * platforms selected on it.
+ *
+ * @param batch pointer to the search batch
+ * @param num_validation number of elections of the validation batch
+ * @param num_platforms number of platforms
+ * @param platforms array of platforms, by descending wins
+ */
+void print_search_result(const SearchBatch *batch,
+                         unsigned long num_validation,
+                         size_t num_platforms,
+                         const SearchPlatform *platforms);
+
+#endif
@@ -0,0 +1,638 @@
+/*======================================================================
+ *                               server.c
+ *======================================================================
+ * Simulation daemon serving requests over a Unix domain socket.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Simulation daemon serving requests over a Unix domain socket.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "confuzz.h"
+#include "election.h"
+#include "sampling.h"
+#include "server.h"
+#include "simulation.h"
+#include "summary.h"
+
+/*
+ * Number of accepted connections which may wait for a worker; further
+ * connections are turned away.
+ */
+#define QUEUE_SIZE 64
+
+/*
+ * Latencies are kept in a log-linear histogram of microseconds: exact
+ * below LATENCY_SUB_BUCKETS, then LATENCY_SUB_BUCKETS buckets for every
+ * power of two.
+ */
+#define LATENCY_SUB_BUCKETS 16
+#define LATENCY_BUCKETS (40*LATENCY_SUB_BUCKETS)
+
+typedef struct{
+    unsigned long count;
+    unsigned long max;
+    unsigned long buckets[LATENCY_BUCKETS];
+} LatencyHistogram;
+
+typedef struct Server Server;
+
+typedef struct{
+    Server *server;
+    pthread_t thread;
+    int fd; /**< connection being served, -1 when idle */
+    Simulation *contexts[SERVER_CONTEXTS];
+    size_t next_context; /**< slot replaced on the next miss */
+} Worker;
+
+struct Server{
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    int queue[QUEUE_SIZE];
+    size_t head;
+    size_t count;
+    unsigned closed;
+    unsigned long num_requests;
+    LatencyHistogram latency;
+    unsigned num_workers;
+    Worker *workers;
+};
+
+typedef struct{
+    SimulationConfig config;
+    unsigned long num_elections;
+    unsigned detail; /**< report the winners of every election */
+} Request;
+
+typedef struct{
+    FILE *stream;
+    unsigned methods;
+    unsigned num_issues;
+} DetailOutput;
+
+/*
+ * Set by the handler of SIGINT and SIGTERM.
+ */
+static volatile sig_atomic_t stop_requested = 0;
+
+static void request_stop(int signum){
+    (void)signum;
+    stop_requested = 1;
+}
+
+static unsigned long elapsed_microseconds(const struct timespec *start){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec)*1000000UL + now.tv_nsec/1000 - start->tv_nsec/1000;
+}
+
+static size_t latency_bucket(unsigned long microseconds){
+    if(microseconds < LATENCY_SUB_BUCKETS){
+        return microseconds;
+    }
+    unsigned e = 0;
+    while((microseconds >> e) >= 2*LATENCY_SUB_BUCKETS){
+        e++;
+    }
+    size_t bucket = (e+1)*LATENCY_SUB_BUCKETS + (microseconds >> e) - LATENCY_SUB_BUCKETS;
+    return (bucket < LATENCY_BUCKETS) ? bucket : LATENCY_BUCKETS-1;
+}
+
+/*
+ * Returns the largest latency falling in a bucket.
+ */
+static unsigned long bucket_ceiling(size_t bucket){
+    if(bucket < LATENCY_SUB_BUCKETS){
+        return bucket;
+    }
+    unsigned e = bucket/LATENCY_SUB_BUCKETS - 1;
+    unsigned long floor = (unsigned long)(bucket%LATENCY_SUB_BUCKETS + LATENCY_SUB_BUCKETS) << e;
+    return floor + ((1UL << e) - 1);
+}
+
+static unsigned long latency_percentile(double percentile, const LatencyHistogram *latency){
+    unsigned long rank = percentile*latency->count;
+    if(rank < percentile*latency->count || !rank){
+        rank++;
+    }
+    unsigned long seen = 0;
+    size_t b;
+    for(b = 0; b < LATENCY_BUCKETS; b++){
+        seen += latency->buckets[b];
+        if(seen >= rank){
+            unsigned long ceiling = bucket_ceiling(b);
+            return (ceiling < latency->max) ? ceiling : latency->max;
+        }
+    }
+    return latency->max;
+}
+
+static void print_latency(const LatencyHistogram *latency, FILE *stream){
+    fprintf(stream, "latency requests=%lu p50=%lu p90=%lu p99=%lu p99.9=%lu max=%lu\n",
+            latency->count,
+            latency_percentile(0.5, latency),
+            latency_percentile(0.9, latency),
+            latency_percentile(0.99, latency),
+            latency_percentile(0.999, latency),
+            latency->max);
+}
+
+/*
+ * Parses a request line; returns a description of the first invalid
+ * field, or NULL on success.
+ */
+static const char *parse_request(char *line, unsigned long number, Request *request){
+    simulation_default_config(&request->config);
+    request->num_elections = 0;
+    request->detail = 0;
+    unsigned seeded = 0;
+
+    char *save;
+    char *field;
+    for(field = strtok_r(line, " \t\r\n", &save); field; field = strtok_r(NULL, " \t\r\n", &save)){
+        char *value = strchr(field, '=');
+        if(!value || !value[1]){
+            return "malformed field";
+        }
+        *value++ = 0;
+
+        char *check;
+        unsigned long number_value = strtoul(value, &check, 0);
+        unsigned numeric = !*check;
+        if(!strcmp(field, "issues") && numeric){
+            request->config.num_issues = number_value;
+        }else if(!strcmp(field, "population") && numeric){
+            request->config.population_size = number_value;
+        }else if(!strcmp(field, "elections") && numeric && number_value){
+            request->num_elections = number_value;
+        }else if(!strcmp(field, "seed") && numeric){
+            request->config.seed = number_value;
+            seeded = 1;
+        }else if(!strcmp(field, "sampling")){
+            if(parse_sampling_scheme(value, &request->config.scheme)){
+                return "unknown sampling scheme";
+            }
+        }else if(!strcmp(field, "strata") && numeric && number_value){
+            request->config.num_strata = number_value;
+        }else if(!strcmp(field, "replicates") && numeric && number_value){
+            request->config.num_replicates = number_value;
+        }else if(!strcmp(field, "methods")){
+            if(parse_methods(value, &request->config.methods)){
+                return "unknown method";
+            }
+        }else if(!strcmp(field, "threshold") && numeric){
+            request->config.threshold = (number_value != 0);
+        }else if(!strcmp(field, "detail") && numeric){
+            request->detail = (number_value != 0);
+        }else{
+            return "invalid field";
+        }
+    }
+
+    unsigned max_issues, max_population;
+    simulation_limits(&max_issues, &max_population);
+    if(!request->config.num_issues || request->config.num_issues > max_issues){
+        return "issues out of range";
+    }
+    if(!request->config.population_size || request->config.population_size > max_population){
+        return "population out of range";
+    }
+    if(!request->num_elections){
+        return "missing elections";
+    }
+
+    // unseeded requests draw from distinct streams of a time seed
+    if(!seeded){
+        request->config.seed = time_seed();
+        request->config.stream = number;
+    }
+    return NULL;
+}
+
+/*
+ * Returns a warm context matching the configuration of a request,
+ * reseeded for it; contexts are created on a miss, replacing the
+ * worker's slots in turn.
+ */
+static Simulation *request_context(const Request *request, Worker *worker){
+    const SimulationConfig *wanted = &request->config;
+    size_t slot;
+    for(slot = 0; slot < SERVER_CONTEXTS; slot++){
+        Simulation *simulation = worker->contexts[slot];
+        if(!simulation){
+            continue;
+        }
+        const SimulationConfig *config = simulation_config(simulation);
+        if(config->num_issues == wanted->num_issues &&
+           config->population_size == wanted->population_size &&
+           config->scheme == wanted->scheme &&
+           config->num_strata == wanted->num_strata &&
+           config->num_replicates == wanted->num_replicates &&
+           config->methods == wanted->methods &&
+           config->threshold == wanted->threshold){
+            simulation_reset(wanted->seed, wanted->stream, simulation);
+            return simulation;
+        }
+    }
+
+    slot = worker->next_context;
+    worker->next_context = (slot + 1) % SERVER_CONTEXTS;
+    simulation_destroy(worker->contexts[slot]);
+    if(simulation_create(wanted, &worker->contexts[slot])){
+        return NULL;
+    }
+    return worker->contexts[slot];
+}
+
+static void print_winner_ids(const char *method, size_t num_winners, Candidate **elected, FILE *stream){
+    size_t i;
+    fprintf(stream, " %s=", method);
+    for(i = 0; i < num_winners; i++){
+        fprintf(stream, i ? ",%zu" : "%zu", elected[i]->id);
+    }
+}
+
+/*
+ * Writes the winners of an election; for use as the ElectionCallback of
+ * simulation_run.
+ */
+static void write_detail(const ElectionResult *result, void *data){
+    const DetailOutput *output = data;
+    FILE *stream = output->stream;
+
+    fprintf(stream, "election=%lu candidates=%zu", result->election, result->num_candidates);
+    if(output->methods & (1U << METHOD_TRADITIONAL)){
+        print_winner_ids(method_name(METHOD_TRADITIONAL), result->num_winners,
+                         result->elected, stream);
+    }
+    if(output->methods & (1U << METHOD_APPROVAL)){
+        print_winner_ids(method_name(METHOD_APPROVAL), result->num_a_winners,
+                         result->elected_a, stream);
+    }
+    if(output->methods & (1U << METHOD_HITLER)){
+        print_winner_ids(method_name(METHOD_HITLER), result->num_h_winners,
+                         result->elected_h, stream);
+    }
+    if(output->methods & (1U << METHOD_TWO_PARTY)){
+        fprintf(stream, " %s=%zu", method_name(METHOD_TWO_PARTY), result->status_quo[0].id);
+        if(result->status_quo[0].votes == result->status_quo[1].votes){
+            fprintf(stream, ",%zu", result->status_quo[1].id);
+        }
+    }
+    if(output->methods & (1U << METHOD_WASHINGTON)){
+        fprintf(stream, " %s=%zu", method_name(METHOD_WASHINGTON), result->washington.id);
+    }
+    if(output->methods & (1U << METHOD_IRV)){
+        fprintf(stream, " %s=%zu", method_name(METHOD_IRV), result->irv.id);
+    }
+    if(result->threshold){
+        // the radii by commas, the winners tied at a radius by slashes
+        const size_t *id = result->threshold_ids;
+        unsigned r;
+        size_t w;
+        fprintf(stream, " threshold=");
+        for(r = 0; r <= output->num_issues; r++){
+            for(w = 0; w < result->threshold[r].num_winners; w++){
+                fprintf(stream, w ? "/%zu" : r ? ",%zu" : "%zu", *id++);
+            }
+        }
+    }
+    fputc('\n', stream);
+}
+
+/*
+ * Writes the agreement of every pair of requested methods.
+ */
+static void write_agreements(const Summary *summary, FILE *stream){
+    Agreement agreement = 0;
+    unsigned m, n;
+    for(m = 0; m < NUM_METHODS; m++){
+        for(n = m+1; n < NUM_METHODS; n++, agreement++){
+            if(!((summary->reported >> agreement) & 0x1)){
+                continue;
+            }
+            double estimate, std_error, ess;
+            summary_estimate(agreement, summary, &estimate, &std_error, &ess);
+            fprintf(stream, "agreement=%s/%s probability=%.6f std_error=%.6f ess=%.1f\n",
+                    method_name(m), method_name(n), estimate, std_error, ess);
+        }
+    }
+}
+
+static void record_latency(unsigned long microseconds, Server *server){
+    pthread_mutex_lock(&server->lock);
+    server->latency.count++;
+    server->latency.buckets[latency_bucket(microseconds)]++;
+    if(microseconds > server->latency.max){
+        server->latency.max = microseconds;
+    }
+    pthread_mutex_unlock(&server->lock);
+}
+
+static void serve_request(char *line, FILE *out, Worker *worker){
+    Server *server = worker->server;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    if(!strcmp(line, "stats")){
+        pthread_mutex_lock(&server->lock);
+        LatencyHistogram latency = server->latency;
+        pthread_mutex_unlock(&server->lock);
+        print_latency(&latency, out);
+        fprintf(out, "done\n");
+        return;
+    }
+
+    pthread_mutex_lock(&server->lock);
+    unsigned long number = server->num_requests++;
+    pthread_mutex_unlock(&server->lock);
+
+    Request request;
+    const char *error = parse_request(line, number, &request);
+    Simulation *simulation = NULL;
+    if(!error && !(simulation = request_context(&request, worker))){
+        error = "not enough memory";
+    }
+    if(error){
+        fprintf(out, "error=%s\n", error);
+        return;
+    }
+
+    DetailOutput output = {out, request.config.methods, request.config.num_issues};
+    simulation_run(request.num_elections,
+                   request.detail ? write_detail : NULL,
+                   &output,
+                   simulation);
+    write_agreements(simulation_summary(simulation), out);
+
+    unsigned long microseconds = elapsed_microseconds(&start);
+    record_latency(microseconds, server);
+    fprintf(out, "done elections=%lu seed=%lu microseconds=%lu\n",
+            request.num_elections, (unsigned long)request.config.seed, microseconds);
+}
+
+static void serve_connection(FILE *in, FILE *out, char **line, size_t *line_size, Worker *worker){
+    ssize_t length;
+    while((length = getline(line, line_size, in)) > 0){
+        // trim the line ending
+        while(length && ((*line)[length-1] == '\n' || (*line)[length-1] == '\r')){
+            (*line)[--length] = 0;
+        }
+        if(!length){
+            continue;
+        }
+        serve_request(*line, out, worker);
+        if(fflush(out)){
+            break;
+        }
+    }
+}
+
+static void *run_worker(void *data){
+    Worker *worker = data;
+    Server *server = worker->server;
+    char *line = NULL;
+    size_t line_size = 0;
+
+    for(;;){
+        pthread_mutex_lock(&server->lock);
+        while(!server->count && !server->closed){
+            pthread_cond_wait(&server->not_empty, &server->lock);
+        }
+        if(server->closed){
+            pthread_mutex_unlock(&server->lock);
+            break;
+        }
+        int fd = server->queue[server->head];
+        server->head = (server->head + 1) % QUEUE_SIZE;
+        server->count--;
+        worker->fd = fd;
+        pthread_mutex_unlock(&server->lock);
+
+        // requests are read and responses written on separate streams
+        int out_fd = dup(fd);
+        FILE *in = fdopen(fd, "r");
+        FILE *out = (out_fd < 0) ? NULL : fdopen(out_fd, "w");
+        if(in && out){
+            serve_connection(in, out, &line, &line_size, worker);
+        }
+
+        // the listener may no longer hang up on the descriptor once it
+        // is closed and free for reuse
+        pthread_mutex_lock(&server->lock);
+        worker->fd = -1;
+        pthread_mutex_unlock(&server->lock);
+        if(in){
+            fclose(in);
+        }else{
+            close(fd);
+        }
+        if(out){
+            fclose(out);
+        }else if(out_fd >= 0){
+            close(out_fd);
+        }
+    }
+
+    free(line);
+    size_t slot;
+    for(slot = 0; slot < SERVER_CONTEXTS; slot++){
+        simulation_destroy(worker->contexts[slot]);
+    }
+    return NULL;
+}
+
+static int open_listener(const char *socket_path){
+    struct sockaddr_un address;
+    if(strlen(socket_path) >= sizeof(address.sun_path)){
+        return -1;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+
+    // replace a stale socket, but never any other kind of file
+    struct stat status;
+    if(!lstat(socket_path, &status) && S_ISSOCK(status.st_mode)){
+        unlink(socket_path);
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listener < 0){
+        return -1;
+    }
+    if(bind(listener, (struct sockaddr*)&address, sizeof(address)) ||
+       listen(listener, QUEUE_SIZE)){
+        close(listener);
+        return -1;
+    }
+    return listener;
+}
+
+int server_run(const char *socket_path, unsigned num_workers){
+    int listener = open_listener(socket_path);
+    if(listener < 0){
+        return -1;
+    }
+
+    Server server;
+    memset(&server, 0, sizeof(server));
+    server.num_workers = num_workers ? num_workers : 1;
+    server.workers = calloc(server.num_workers, sizeof(*server.workers));
+    if(!server.workers){
+        close(listener);
+        unlink(socket_path);
+        return -1;
+    }
+    pthread_mutex_init(&server.lock, NULL);
+    pthread_cond_init(&server.not_empty, NULL);
+
+    // the workers never see the stop signals; the listener only takes
+    // them while waiting in pselect
+    sigset_t stop_signals, waiting_mask;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, &waiting_mask);
+    sigdelset(&waiting_mask, SIGINT);
+    sigdelset(&waiting_mask, SIGTERM);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = request_stop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    // a client hanging up must not kill the daemon
+    signal(SIGPIPE, SIG_IGN);
+
+    unsigned w;
+    for(w = 0; w < server.num_workers; w++){
+        server.workers[w].server = &server;
+        server.workers[w].fd = -1;
+        if(pthread_create(&server.workers[w].thread, NULL, run_worker, server.workers+w)){
+            break;
+        }
+    }
+    unsigned num_started = w;
+
+    if(num_started == server.num_workers){
+        fprintf(stderr, "Listening on %s with %u workers\n", socket_path, num_started);
+    }
+    while(num_started == server.num_workers && !stop_requested){
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(listener, &readable);
+        if(pselect(listener+1, &readable, NULL, NULL, NULL, &waiting_mask) <= 0){
+            continue;
+        }
+
+        int fd = accept(listener, NULL, NULL);
+        if(fd < 0){
+            continue;
+        }
+        pthread_mutex_lock(&server.lock);
+        if(server.count < QUEUE_SIZE){
+            server.queue[(server.head + server.count) % QUEUE_SIZE] = fd;
+            server.count++;
+            fd = -1;
+            pthread_cond_signal(&server.not_empty);
+        }
+        pthread_mutex_unlock(&server.lock);
+        if(fd >= 0){
+            // every worker is busy and the queue is full
+            const char busy[] = "error=server busy\n";
+            if(write(fd, busy, sizeof(busy)-1) < 0){
+                // the client is gone either way
+            }
+            close(fd);
+        }
+    }
+
+    // wake the workers and hang up on the connections they serve
+    pthread_mutex_lock(&server.lock);
+    server.closed = 1;
+    pthread_cond_broadcast(&server.not_empty);
+    for(w = 0; w < num_started; w++){
+        if(server.workers[w].fd >= 0){
+            shutdown(server.workers[w].fd, SHUT_RDWR);
+        }
+    }
+    pthread_mutex_unlock(&server.lock);
+    for(w = 0; w < num_started; w++){
+        pthread_join(server.workers[w].thread, NULL);
+    }
+    for(; server.count; server.count--){
+        close(server.queue[server.head]);
+        server.head = (server.head + 1) % QUEUE_SIZE;
+    }
+
+    close(listener);
+    unlink(socket_path);
+    if(num_started == server.num_workers){
+        print_latency(&server.latency, stderr);
+    }
+    pthread_cond_destroy(&server.not_empty);
+    pthread_mutex_destroy(&server.lock);
+    free(server.workers);
+
+    return (num_started == server.num_workers) ? 0 : -1;
+}
@@ -0,0 +1,87 @@
+/*======================================================================
+ *                               server.h
+ *======================================================================
+ * Simulation daemon serving requests over a Unix domain socket.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Simulation daemon serving requests over a Unix domain socket.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef SERVER_H
+#define SERVER_H
+
+/**
+ * Number of warm simulation contexts each worker keeps; a request whose
+ * configuration matches a kept context reuses its buffers.
+ */
+#define SERVER_CONTEXTS 4
+
+/**
+ * Serves simulation requests on a Unix domain socket until SIGINT or
+ * SIGTERM is received.
+ *
+ * Each connection carries any number of requests, one per line, as
+ * space-separated key=value pairs:
+ *
+ *     issues=N population=N elections=N [seed=N] [sampling=SCHEME]
+ *     [strata=N] [replicates=N] [methods=M,M,...] [detail=0|1]
+ *
+ * The methods are traditional, approval, hitler, two_party and
+ * washington. The response is line-delimited: with detail=1 a line of
+ * winner ids per election, then a line per agreeing pair of selected
+ * methods, then a closing done line (or a single error line). The
+ * request "stats" returns the latency percentiles of the requests
+ * served so far.
+ *
+ * @param socket_path path of the socket to create
+ * @param num_workers number of worker threads
+ *
+ * @return 0 after a clean shutdown, -1 if the socket could not be
+ *         created or the workers could not be started
+ */
+int server_run(const char *socket_path, unsigned num_workers);
+
+#endif
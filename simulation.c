@@ -0,0 +1,829 @@
+/*======================================================================
+ *                             simulation.c
+ *======================================================================
+ * Reentrant simulation contexts of the VoteSim library.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Reentrant simulation contexts of the VoteSim library.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "approximate.h"
+#include "ballots.h"
+#include "batch.h"
+#include "bit_functions.h"
+#include "checkpoint.h"
+#include "committee.h"
+#include "confuzz.h"
+#include "districts.h"
+#include "election.h"
+#include "irv.h"
+#include "margins.h"
+#include "minimax.h"
+#include "noise.h"
+#include "sampling.h"
+#include "simulation.h"
+#include "slate.h"
+#include "summary.h"
+#include "telemetry.h"
+#include "threshold.h"
+#include "workers.h"
+
+struct Simulation{
+    SimulationConfig config; /**< configuration of the context */
+    size_t pool_size; /**< number of possible candidates */
+    unsigned plan; /**< stages of decide_election to run */
+    const ElectionKernels *kernels; /**< kernels for the number of issues */
+    WorkerPool *pool; /**< threads splitting each election, or NULL */
+    RandomState random; /**< generator of the vote allocations */
+    Sampler sampler; /**< sampler driving perform_election */
+    SwapMap swaps; /**< sparse shuffle of the candidate pool */
+    Summary summary; /**< agreement over every election run */
+    unsigned long num_elections; /**< number of elections run */
+    ElectionResult result; /**< result of the latest election */
+    unsigned *stance_poll; /**< voters with a stance of 1 per issue */
+    Candidate *groups; /**< voter groups allocated by perform_election
+                            or from the ballots; the candidates
+                            themselves unless a slate is declared */
+    Slate slate; /**< declared slate, if any */
+    IrvEngine irv; /**< instant-runoff engine, if planned */
+    ThresholdEngine threshold; /**< threshold approval engine, if
+                                    configured */
+    CommitteeEngine committee; /**< committee engine, if configured */
+    MinimaxEngine minimax; /**< minimax engine, if configured */
+    ApproximateEngine approximate; /**< approximate approval engine, if
+                                        configured */
+    TelemetryCounters *telemetry; /**< counters of the running thread,
+                                       or NULL */
+    BatchEngine batch; /**< statistics of a batch of elections; its
+                            batch_size is 0 unless batching */
+    Candidate *batch_groups; /**< voter groups of each election of the
+                                  batch, pool_size apart */
+    size_t *batch_num_groups; /**< number of groups of each election */
+    unsigned *batch_replicates; /**< replicate of each election */
+    unsigned *batch_turnouts; /**< turnout of each election */
+    unsigned noisy; /**< whether the noise model moves the ballots */
+    NoiseModel noise; /**< noise model, if noisy */
+    size_t num_groups; /**< number of voter groups of the latest
+                            election */
+    size_t num_tallies; /**< number of threads deciding districts, or 0
+                             for a single electorate */
+    Simulation **districts; /**< context deciding the districts of each
+                                 thread; its buffers serve every district
+                                 the thread decides */
+    DistrictTally *tallies; /**< tally of the districts of each thread */
+};
+
+void simulation_limits(unsigned *max_issues, unsigned *max_population){
+    // sqrt prevents overflow when calculating disapproval rating of candidates
+    unsigned MAX_POPULATION = sqrt(CONFUZZ_RAND_MAX);
+    unsigned MAX_ISSUES = hamming_weight(MAX_POPULATION);
+    // Check if CONFUZZ_RAND_MAX is not a Mersenne prime
+    if((MAX_POPULATION | (MAX_POPULATION>>1)) != MAX_POPULATION){
+        MAX_ISSUES = bit_count(MAX_POPULATION>>1);
+    }
+
+    *max_issues = MAX_ISSUES;
+    *max_population = MAX_POPULATION;
+}
+
+void simulation_default_config(SimulationConfig *config){
+    memset(config, 0, sizeof(*config));
+    config->scheme = SAMPLING_PLAIN;
+    config->num_strata = 16;
+    config->num_replicates = 8;
+    config->num_threads = 1;
+    config->methods = DEFAULT_METHODS;
+}
+
+/*
+ * Creates the context and tally of each thread deciding the districts
+ * of a context: single electorates of one thread, deciding only the
+ * winners.
+ */
+static int create_districts(Simulation *simulation){
+    const size_t num_threads = worker_pool_size(simulation->pool);
+    SimulationConfig config = simulation->config;
+    config.candidate_statistics = 0;
+    config.num_threads = 1;
+    config.threshold = 0;
+    config.batch_size = 0;
+    config.num_districts = 0;
+    config.num_seats = 0;
+    config.minimax = 0;
+    config.margins = 0;
+    config.approximate = 0;
+
+    simulation->result.electoral = malloc(sizeof(*simulation->result.electoral) * NUM_METHODS);
+    simulation->result.electoral_ids = malloc(sizeof(*simulation->result.electoral_ids) *
+                                              NUM_METHODS * simulation->pool_size);
+    simulation->districts = calloc(num_threads, sizeof(*simulation->districts));
+    simulation->tallies = calloc(num_threads, sizeof(*simulation->tallies));
+    if(!simulation->result.electoral || !simulation->result.electoral_ids ||
+       !simulation->districts || !simulation->tallies){
+        return -1;
+    }
+    simulation->num_tallies = num_threads;
+    size_t t;
+    for(t = 0; t < num_threads; t++){
+        if(simulation_create(&config, simulation->districts + t) ||
+           district_tally_init(config.num_issues, simulation->tallies + t)){
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int simulation_create(const SimulationConfig *config, Simulation **simulation){
+    unsigned max_issues, max_population;
+    simulation_limits(&max_issues, &max_population);
+    *simulation = NULL;
+    if(!config->num_issues || config->num_issues > max_issues || !config->population_size){
+        return -1;
+    }
+    // empirical ballots are tallied rather than sampled, so only their
+    // own bound applies
+    if(config->ballots ? (config->ballots->num_issues != config->num_issues ||
+                          config->ballots->num_voters != config->population_size ||
+                          config->scheme != SAMPLING_PLAIN)
+                       : config->population_size > max_population){
+        return -1;
+    }
+    // the strata count the candidates as drawn, before any noise
+    unsigned noisy = config->abstention > 0 || config->num_errors;
+    if(noisy && config->scheme == SAMPLING_STRATIFIED){
+        return -1;
+    }
+    // the margins move voters between the candidates they vote for
+    if(config->margins && config->num_slate){
+        return -1;
+    }
+    // the hitler method and the margins already compare every pair of
+    // candidates, and a slate is decided by its own groups
+    const unsigned approval_only = (config->methods >> METHOD_APPROVAL) & 0x1 &&
+                                   !((config->methods >> METHOD_HITLER) & 0x1);
+    if(config->approximate &&
+       (!(config->approximate > 0 && config->approximate < 1) || !approval_only ||
+        config->num_slate || config->margins)){
+        return -1;
+    }
+    if(config->num_districts &&
+       (config->scheme != SAMPLING_PLAIN || config->ballots ||
+        (uint64_t)config->num_districts * config->population_size > DISTRICTS_MAX_VOTERS)){
+        return -1;
+    }
+    // the districts move their own ballots
+    noisy = noisy && !config->num_districts;
+
+    Simulation *s = calloc(1, sizeof(*s));
+    if(!s){
+        return -1;
+    }
+    s->config = *config;
+    s->pool_size = (size_t)1 << config->num_issues;
+    s->plan = plan_election(config->candidate_statistics, config->methods);
+    // the minimax search starts from the washington platform
+    if(config->minimax){
+        s->plan |= STAGE_WASHINGTON;
+    }
+    // the printed statistics are exact
+    const unsigned approximated = config->approximate && !config->candidate_statistics;
+    if(approximated){
+        s->plan &= ~(STAGE_DISAPPROVAL | STAGE_APPROVAL);
+    }
+    s->kernels = election_kernels(config->num_issues);
+    rand_seed(config->seed, config->stream, &s->random);
+
+    ElectionResult *result = &s->result;
+    // the hitler table is only filled when the hitler method is planned
+    result->hitler_table = calloc(s->pool_size, sizeof(*result->hitler_table));
+    s->groups = malloc(sizeof(*s->groups) * s->pool_size);
+    if(config->num_slate){
+        if(slate_init(config->num_issues, config->num_slate, config->slate, &s->slate)){
+            simulation_destroy(s);
+            return -1;
+        }
+        s->config.slate = s->slate.members;
+        result->candidates = malloc(sizeof(*result->candidates) * config->num_slate);
+    }else{
+        result->candidates = s->groups;
+    }
+    result->elected = malloc(sizeof(*result->elected) * s->pool_size);
+    result->elected_a = malloc(sizeof(*result->elected_a) * s->pool_size);
+    result->elected_h = malloc(sizeof(*result->elected_h) * s->pool_size);
+    if(s->plan & STAGE_IRV){
+        result->rounds = malloc(sizeof(*result->rounds) * s->pool_size);
+    }
+    if(config->threshold){
+        result->threshold = malloc(sizeof(*result->threshold) * (config->num_issues + 1));
+        result->threshold_ids = malloc(sizeof(*result->threshold_ids) *
+                                       (config->num_issues + 1) * s->pool_size);
+    }
+    // there are never more members than candidates
+    size_t num_seats = (config->num_seats < s->pool_size) ? config->num_seats : s->pool_size;
+    if(num_seats){
+        result->chamberlin_courant = malloc(sizeof(*result->chamberlin_courant) * 2*num_seats);
+        result->sequential = result->chamberlin_courant ? result->chamberlin_courant + num_seats
+                                                        : NULL;
+    }
+    if(config->minimax){
+        result->minimax = malloc(sizeof(*result->minimax));
+    }
+    if(config->margins){
+        result->margins = malloc(sizeof(*result->margins) * NUM_METHODS);
+    }
+    if(approximated){
+        result->approximate = malloc(sizeof(*result->approximate));
+    }
+    s->stance_poll = malloc(sizeof(*s->stance_poll) * config->num_issues);
+    // batching only pays off, and is only implemented, for small pools
+    // of candidates all standing and drawn by perform_election
+    unsigned batched = (config->batch_size > 1 && config->num_issues <= BATCH_MAX_ISSUES &&
+                        !config->num_slate && !config->ballots && !config->num_districts);
+    if(batched){
+        s->batch_groups = malloc(sizeof(*s->batch_groups) * s->pool_size * config->batch_size);
+        s->batch_num_groups = malloc(sizeof(*s->batch_num_groups) * config->batch_size);
+        s->batch_replicates = malloc(sizeof(*s->batch_replicates) * config->batch_size);
+        s->batch_turnouts = malloc(sizeof(*s->batch_turnouts) * config->batch_size);
+    }
+    swap_map_init(s->pool_size, &s->swaps);
+    // the sampler and summary are zeroed by calloc, so a failed
+    // initialization leaves them safe to free
+    if(!result->hitler_table || !s->groups || !result->candidates || !result->elected ||
+       !result->elected_a || !result->elected_h || !s->stance_poll || !s->swaps.slots ||
+       sampler_init(config->num_replicates, s->pool_size, config->scheme,
+                    &s->random, &s->sampler) ||
+       summary_init(config->methods, config->population_size,
+                    config->num_replicates, config->num_strata,
+                    s->pool_size, config->scheme, &s->summary) ||
+       (config->num_threads > 1 && worker_pool_create(config->num_threads, &s->pool)) ||
+       ((s->plan & STAGE_IRV) && (!result->rounds || irv_init(config->num_issues, &s->irv))) ||
+       (config->threshold &&
+        (!result->threshold || !result->threshold_ids ||
+         threshold_init(config->num_issues, &s->threshold))) ||
+       (num_seats &&
+        (!result->chamberlin_courant ||
+         committee_init(config->num_issues, num_seats, &s->committee))) ||
+       (config->minimax &&
+        (!result->minimax || minimax_init(config->num_issues, config->minimax_budget,
+                                          &s->minimax))) ||
+       (config->margins && !result->margins) ||
+       (approximated &&
+        (!result->approximate || approximate_init(config->num_issues, config->approximate,
+                                                  config->seed, config->stream,
+                                                  &s->approximate))) ||
+       (batched && (!s->batch_groups || !s->batch_num_groups || !s->batch_replicates ||
+                    !s->batch_turnouts ||
+                    batch_init(config->num_issues, config->batch_size, &s->batch))) ||
+       (noisy && noise_init(config->num_issues, config->abstention, config->num_errors,
+                            config->errors, &s->noise))){
+        simulation_destroy(s);
+        return -1;
+    }
+    if(config->num_districts && create_districts(s)){
+        simulation_destroy(s);
+        return -1;
+    }
+
+    s->noisy = noisy;
+    s->config.errors = s->noise.errors;
+    *simulation = s;
+    return 0;
+}
+
+void simulation_reset(uint64_t seed, uint64_t stream, Simulation *simulation){
+    simulation->config.seed = seed;
+    simulation->config.stream = stream;
+    rand_seed(seed, stream, &simulation->random);
+    sampler_reset(&simulation->sampler);
+    summary_reset(&simulation->summary);
+    if(simulation->noisy){
+        noise_reset(&simulation->noise);
+    }
+    if(simulation->result.approximate){
+        approximate_reset(seed, stream, &simulation->approximate);
+    }
+    simulation->num_elections = 0;
+}
+
+int simulation_save(const Simulation *simulation, FILE *stream){
+    return -(checkpoint_put(&simulation->num_elections, sizeof(simulation->num_elections),
+                            stream) ||
+             checkpoint_put(&simulation->random, sizeof(simulation->random), stream) ||
+             sampler_save(&simulation->sampler, stream) ||
+             (simulation->noisy && noise_save(&simulation->noise, stream)) ||
+             (simulation->result.approximate &&
+              approximate_save(&simulation->approximate, stream)) ||
+             summary_save(&simulation->summary, stream));
+}
+
+int simulation_load(FILE *stream, Simulation *simulation){
+    return -(checkpoint_get(&simulation->num_elections, sizeof(simulation->num_elections),
+                            stream) ||
+             checkpoint_get(&simulation->random, sizeof(simulation->random), stream) ||
+             sampler_load(stream, &simulation->sampler) ||
+             (simulation->noisy && noise_load(stream, &simulation->noise)) ||
+             (simulation->result.approximate &&
+              approximate_load(stream, &simulation->approximate)) ||
+             summary_load(stream, &simulation->summary));
+}
+
+void simulation_destroy(Simulation *simulation){
+    if(!simulation){
+        return;
+    }
+    sampler_free(&simulation->sampler);
+    swap_map_free(&simulation->swaps);
+    summary_free(&simulation->summary);
+    free(simulation->result.hitler_table);
+    // the candidates are the voter groups unless a slate is declared
+    if(simulation->config.num_slate){
+        free(simulation->result.candidates);
+    }
+    free(simulation->groups);
+    slate_free(&simulation->slate);
+    free(simulation->result.elected);
+    free(simulation->result.elected_a);
+    free(simulation->result.elected_h);
+    free(simulation->stance_poll);
+    worker_pool_destroy(simulation->pool);
+    irv_free(&simulation->irv);
+    free(simulation->result.rounds);
+    threshold_free(&simulation->threshold);
+    free(simulation->result.threshold);
+    free(simulation->result.threshold_ids);
+    committee_free(&simulation->committee);
+    free(simulation->result.chamberlin_courant);
+    minimax_free(&simulation->minimax);
+    free(simulation->result.minimax);
+    free(simulation->result.margins);
+    approximate_free(&simulation->approximate);
+    free(simulation->result.approximate);
+    batch_free(&simulation->batch);
+    free(simulation->batch_groups);
+    free(simulation->batch_num_groups);
+    free(simulation->batch_replicates);
+    free(simulation->batch_turnouts);
+    noise_free(&simulation->noise);
+    size_t t;
+    for(t = 0; t < simulation->num_tallies; t++){
+        simulation_destroy(simulation->districts[t]);
+        district_tally_free(simulation->tallies + t);
+    }
+    free(simulation->districts);
+    free(simulation->tallies);
+    free(simulation->result.electoral);
+    free(simulation->result.electoral_ids);
+    free(simulation);
+}
+
+/*
+ * Decides the election whose voter groups were allocated, then records
+ * it and hands it to the callback. The statistics already in the
+ * candidates are left out of the plan. Under timing, marks receives the
+ * time the recording starts.
+ */
+static void finish_election(unsigned plan,
+                            size_t num_groups,
+                            unsigned turnout,
+                            unsigned replicate,
+                            Candidate *groups,
+                            uint64_t *marks,
+                            ElectionCallback callback,
+                            void *data,
+                            Simulation *simulation){
+    const unsigned num_issues = simulation->config.num_issues;
+    ElectionResult *result = &simulation->result;
+    result->turnout = turnout;
+    simulation->num_groups = num_groups;
+
+    // compute election statistics and decide the winners
+    if(simulation->slate.num_members){
+        result->num_candidates = simulation->slate.num_members;
+        decide_slate_election(plan,
+                              turnout,
+                              num_issues,
+                              num_groups,
+                              &result->num_a_winners,
+                              &result->num_h_winners,
+                              &result->num_winners,
+                              simulation->stance_poll,
+                              result->hitler_table,
+                              groups,
+                              result->candidates,
+                              &result->washington,
+                              result->status_quo,
+                              result->elected,
+                              result->elected_a,
+                              result->elected_h,
+                              &simulation->slate);
+    }else{
+        result->candidates = groups;
+        result->num_candidates = num_groups;
+        decide_election(plan,
+                        turnout,
+                        num_issues,
+                        result->num_candidates,
+                        &result->num_a_winners,
+                        &result->num_h_winners,
+                        &result->num_winners,
+                        simulation->stance_poll,
+                        result->hitler_table,
+                        result->candidates,
+                        &result->washington,
+                        result->status_quo,
+                        result->elected,
+                        result->elected_a,
+                        result->elected_h,
+                        simulation->kernels,
+                        simulation->pool);
+    }
+    if(result->approximate){
+        decide_approximate_election(turnout,
+                                    result->num_candidates,
+                                    &result->num_a_winners,
+                                    result->candidates,
+                                    result->elected_a,
+                                    result->approximate,
+                                    &simulation->approximate);
+    }
+    if(result->margins){
+        decide_margins(simulation->config.methods,
+                       turnout,
+                       num_issues,
+                       result->num_candidates,
+                       result->num_a_winners,
+                       result->num_h_winners,
+                       result->num_winners,
+                       simulation->stance_poll,
+                       result->hitler_table,
+                       result->candidates,
+                       result->status_quo,
+                       result->elected_a,
+                       result->margins);
+    }
+    if(plan & STAGE_IRV){
+        size_t winner = decide_irv_election(num_groups,
+                                            result->num_candidates,
+                                            &result->num_rounds,
+                                            groups,
+                                            result->candidates,
+                                            result->rounds,
+                                            &simulation->irv);
+        result->irv = result->candidates[winner];
+    }
+    if(simulation->config.threshold){
+        decide_threshold_election(num_groups,
+                                  result->num_candidates,
+                                  groups,
+                                  result->candidates,
+                                  result->threshold,
+                                  result->threshold_ids,
+                                  &simulation->threshold);
+    }
+    if(simulation->committee.num_seats){
+        result->num_members = decide_committee_election(num_groups,
+                                                        result->num_candidates,
+                                                        groups,
+                                                        result->candidates,
+                                                        result->chamberlin_courant,
+                                                        result->sequential,
+                                                        &simulation->committee);
+    }
+    if(simulation->config.minimax){
+        decide_minimax_election(turnout,
+                                num_groups,
+                                groups,
+                                simulation->stance_poll,
+                                result->minimax,
+                                &simulation->minimax);
+    }
+    if(simulation->num_tallies){
+        unsigned popular = district_popular_winners(simulation->config.methods,
+                                                    result->num_a_winners,
+                                                    result->num_h_winners,
+                                                    result->num_winners,
+                                                    &result->washington,
+                                                    (plan & STAGE_IRV) ? &result->irv : NULL,
+                                                    result->status_quo,
+                                                    result->elected,
+                                                    result->elected_a,
+                                                    result->elected_h,
+                                                    result->electoral,
+                                                    result->electoral_ids);
+        summary_record_electoral(popular, &simulation->summary);
+    }
+    if(marks){
+        marks[TELEMETRY_RECORD] = telemetry_clock();
+    }
+
+    // record agreement between election methods
+    result->agreements = election_agreements(result->num_a_winners,
+                                             result->num_h_winners,
+                                             result->num_winners,
+                                             &result->washington,
+                                             (plan & STAGE_IRV) ? &result->irv : NULL,
+                                             result->status_quo,
+                                             result->elected,
+                                             result->elected_a,
+                                             result->elected_h);
+    result->agreements &= simulation->summary.reported;
+    summary_record(result->agreements,
+                   replicate,
+                   num_groups,
+                   &simulation->summary);
+
+    result->election = simulation->num_elections++;
+    if(callback){
+        callback(result, data);
+    }
+}
+
+/*
+ * Counts an election in the telemetry, with the times of its phases if
+ * it was timed.
+ */
+static void count_election(const uint64_t *marks, const Simulation *simulation){
+    TelemetryCounters *telemetry = simulation->telemetry;
+    TELEMETRY_ADD(telemetry->elections, 1);
+    TELEMETRY_ADD(telemetry->candidates, simulation->result.num_candidates);
+    if(marks){
+        unsigned p;
+        for(p = 0; p < TELEMETRY_PHASES; p++){
+            TELEMETRY_ADD(telemetry->phase_ns[p], marks[p+1] - marks[p]);
+        }
+        TELEMETRY_ADD(telemetry->timed, 1);
+    }
+}
+
+/*
+ * Runs elections a batch at a time: the votes of the whole batch are
+ * allocated first, then the statistics of every election are computed
+ * at once, then each election is decided in turn. The elections and
+ * their order are those of one at a time.
+ */
+static void run_batches(unsigned long num_elections,
+                        ElectionCallback callback,
+                        void *data,
+                        Simulation *simulation){
+    const size_t pool_size = simulation->pool_size;
+    BatchEngine *batch = &simulation->batch;
+    // the batch computes these for every election, leaving only the
+    // hitler table to decide_election
+    const unsigned batched = STAGE_DISAPPROVAL | STAGE_HITLER | STAGE_LEANING;
+    unsigned plan = simulation->plan & ~batched;
+    if(simulation->plan & STAGE_HITLER){
+        plan |= STAGE_HITLER_TABLE;
+    }
+
+    unsigned long j;
+    size_t num_columns;
+    for(j = 0; j < num_elections; j += num_columns){
+        num_columns = batch->batch_size;
+        if(num_elections - j < num_columns){
+            num_columns = num_elections - j;
+        }
+
+        // the allocation and the products are timed for the whole batch,
+        // and shared out between its elections
+        uint64_t start = simulation->telemetry ? telemetry_clock() : 0;
+        size_t b;
+        for(b = 0; b < num_columns; b++){
+            Candidate *groups = simulation->batch_groups + b*pool_size;
+            size_t k;
+            for(k = 0; k < pool_size; k++){
+                groups[k].id = pool_size;
+            }
+            perform_election(simulation->config.population_size,
+                             pool_size,
+                             simulation->batch_num_groups + b,
+                             groups,
+                             &simulation->sampler,
+                             &simulation->swaps);
+            simulation->batch_replicates[b] = sampler_replicate(&simulation->sampler);
+            simulation->batch_turnouts[b] = simulation->config.population_size;
+            if(simulation->noisy){
+                simulation->batch_turnouts[b] = noise_apply(simulation->batch_num_groups + b, groups,
+                                                            &simulation->random,
+                                                            &simulation->noise);
+            }
+            batch_add_election(simulation->batch_num_groups[b], groups, batch);
+        }
+        uint64_t allocated = simulation->telemetry ? telemetry_clock() : 0;
+        batch_statistics(simulation->plan, batch);
+        uint64_t computed = simulation->telemetry ? telemetry_clock() : 0;
+
+        for(b = 0; b < num_columns; b++){
+            // decided in the buffer of one at a time, so that the entries
+            // past the groups hold what they would have held; the
+            // allocation also leaves the id of a candidate without votes
+            // after them, which the id of the pool size marks as unset
+            size_t num_groups = simulation->batch_num_groups[b];
+            const Candidate *column = simulation->batch_groups + b*pool_size;
+            Candidate *groups = simulation->groups;
+            memcpy(groups, column, sizeof(*groups) * num_groups);
+            if(num_groups < pool_size && column[num_groups].id != pool_size){
+                groups[num_groups].id = column[num_groups].id;
+            }
+            batch_candidate_statistics(simulation->plan, b, num_groups, groups, batch);
+
+            uint64_t marks[TELEMETRY_PHASES + 1];
+            unsigned timed = simulation->telemetry &&
+                             !(simulation->num_elections % TELEMETRY_SAMPLE_PERIOD);
+            if(timed){
+                // the election's shares of the batch precede its decision
+                marks[TELEMETRY_DECIDE] = telemetry_clock() - (computed - allocated) / num_columns;
+                marks[TELEMETRY_ALLOCATE] = marks[TELEMETRY_DECIDE] - (allocated - start) / num_columns;
+            }
+            finish_election(plan, num_groups, simulation->batch_turnouts[b],
+                            simulation->batch_replicates[b], groups,
+                            timed ? marks : NULL, callback, data, simulation);
+            if(timed){
+                marks[TELEMETRY_PHASES] = telemetry_clock();
+            }
+            if(simulation->telemetry){
+                count_election(timed ? marks : NULL, simulation);
+            }
+        }
+        batch_clear(batch);
+    }
+}
+
+/*
+ * Districts decided by one job of the worker pool.
+ */
+typedef struct{
+    uint64_t key; /**< seed of the districts of the election */
+    Simulation *simulation;
+} DistrictJob;
+
+static void district_job(size_t first, size_t last, unsigned thread, void *argument){
+    const DistrictJob *job = argument;
+    Simulation *district = job->simulation->districts[thread];
+    DistrictTally *tally = job->simulation->tallies + thread;
+    ElectionResult *result = &district->result;
+    size_t d;
+    for(d = first; d < last; d++){
+        // each district draws from a stream of its own, so that it does
+        // not depend on the thread deciding it
+        simulation_reset(job->key, d, district);
+        simulation_run(1, NULL, NULL, district);
+        district_tally_add(district->config.methods,
+                           result->turnout,
+                           district->num_groups,
+                           district->groups,
+                           result->num_a_winners,
+                           result->num_h_winners,
+                           result->num_winners,
+                           &result->washington,
+                           (district->plan & STAGE_IRV) ? &result->irv : NULL,
+                           result->status_quo,
+                           result->elected,
+                           result->elected_a,
+                           result->elected_h,
+                           tally);
+    }
+}
+
+/*
+ * Decides the districts of an election, spread over the threads, and
+ * allocates the nationwide voter groups from their votes; returns the
+ * nationwide turnout.
+ */
+static unsigned allocate_districts(size_t *num_groups, Simulation *simulation){
+    DistrictJob job;
+    job.key = (uint64_t)rand_next(&simulation->random) << 32 | rand_next(&simulation->random);
+    job.simulation = simulation;
+    worker_pool_run(simulation->config.num_districts, simulation->config.population_size,
+                    district_job, &job, simulation->pool);
+
+    district_tally_merge(simulation->num_tallies, simulation->tallies, simulation->pool);
+    return district_tally_finish(simulation->config.methods,
+                                 num_groups,
+                                 simulation->groups,
+                                 simulation->result.electoral,
+                                 simulation->result.electoral_ids,
+                                 simulation->tallies);
+}
+
+void simulation_run(unsigned long num_elections,
+                    ElectionCallback callback,
+                    void *data,
+                    Simulation *simulation){
+    if(simulation->batch.batch_size){
+        run_batches(num_elections, callback, data, simulation);
+        return;
+    }
+
+    unsigned long j;
+    for(j = 0; j < num_elections; j++){
+        // the phases of a sample of the elections are timed
+        uint64_t marks[TELEMETRY_PHASES + 1];
+        unsigned timed = simulation->telemetry &&
+                         !(simulation->num_elections % TELEMETRY_SAMPLE_PERIOD);
+        if(timed){
+            marks[TELEMETRY_ALLOCATE] = telemetry_clock();
+        }
+
+        // perform traditional election, or tally the empirical ballots
+        // or the districts
+        size_t num_groups = 0;
+        unsigned turnout = simulation->config.population_size;
+        if(simulation->num_tallies){
+            turnout = allocate_districts(&num_groups, simulation);
+        }else if(simulation->config.ballots){
+            ballots_allocate(simulation->config.bootstrap,
+                             &num_groups,
+                             simulation->groups,
+                             &simulation->random,
+                             simulation->config.ballots);
+        }else{
+            perform_election(simulation->config.population_size,
+                             simulation->pool_size,
+                             &num_groups,
+                             simulation->groups,
+                             &simulation->sampler,
+                             &simulation->swaps);
+        }
+        if(simulation->noisy){
+            turnout = noise_apply(&num_groups, simulation->groups, &simulation->random,
+                                  &simulation->noise);
+        }
+        if(timed){
+            marks[TELEMETRY_DECIDE] = telemetry_clock();
+        }
+
+        finish_election(simulation->plan, num_groups, turnout,
+                        sampler_replicate(&simulation->sampler), simulation->groups,
+                        timed ? marks : NULL, callback, data, simulation);
+
+        if(timed){
+            marks[TELEMETRY_PHASES] = telemetry_clock();
+        }
+        if(simulation->telemetry){
+            count_election(timed ? marks : NULL, simulation);
+        }
+    }
+}
+
+void simulation_attach_telemetry(TelemetryCounters *telemetry, Simulation *simulation){
+    simulation->telemetry = telemetry;
+}
+
+const SimulationConfig *simulation_config(const Simulation *simulation){
+    return &simulation->config;
+}
+
+const ElectionResult *simulation_result(const Simulation *simulation){
+    return simulation->num_elections ? &simulation->result : NULL;
+}
+
+const Summary *simulation_summary(const Simulation *simulation){
+    return &simulation->summary;
+}
@@ -0,0 +1,373 @@
+/*======================================================================
+ *                             simulation.h
+ *======================================================================
+ * Reentrant simulation contexts of the VoteSim library.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Reentrant simulation contexts of the VoteSim library.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "approximate.h"
+#include "ballots.h"
+#include "committee.h"
+#include "districts.h"
+#include "election.h"
+#include "irv.h"
+#include "margins.h"
+#include "minimax.h"
+#include "sampling.h"
+#include "summary.h"
+#include "telemetry.h"
+#include "threshold.h"
+
+/**
+ * Version of the results of the simulation contexts: raised by any
+ * change that alters the elections, summary, or data file of a
+ * configuration, so that results kept from an earlier version are
+ * never served for it.
+ */
+#define SIMULATION_VERSION 3
+
+/**
+ * Configuration of a simulation context.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of common issues */
+    unsigned population_size; /**< number of voters */
+    SamplingScheme scheme; /**< sampling scheme for vote allocations */
+    size_t num_strata; /**< number of strata for SAMPLING_STRATIFIED */
+    unsigned num_replicates; /**< number of replicates for
+                                  SAMPLING_SOBOL */
+    uint64_t seed; /**< seed of the pseudo-random number generator */
+    uint64_t stream; /**< stream of the pseudo-random number generator;
+                          contexts seeded alike on different streams
+                          draw independent elections */
+    unsigned methods; /**< set of election methods whose winners are
+                           decided (see Method) */
+    unsigned candidate_statistics; /**< compute the full statistics of
+                                        every candidate, as printed by
+                                        print_election_statistics */
+    size_t num_slate; /**< number of declared candidates, or 0 for
+                           every platform with votes to stand */
+    const size_t *slate; /**< ids of the declared candidates; copied
+                              into the context */
+    unsigned num_threads; /**< threads splitting the candidates of each
+                               election, at most WORKER_MAX_THREADS; the
+                               results do not depend on it */
+    unsigned threshold; /**< decide a threshold approval election at
+                             every radius */
+    size_t batch_size; /**< elections whose statistics are computed
+                            together, at most BATCH_MAX_SIZE; only
+                            batched up to BATCH_MAX_ISSUES issues without
+                            a slate, and the results do not depend on
+                            it */
+    const BallotSet *ballots; /**< empirical ballots tallied by every
+                                   election instead of drawing the votes,
+                                   or NULL; num_issues and population_size
+                                   must match them, the population is not
+                                   bounded by simulation_limits, and only
+                                   SAMPLING_PLAIN applies */
+    unsigned bootstrap; /**< resample the ballots with replacement for
+                             every election, rather than tally them as
+                             loaded */
+    double abstention; /**< probability that a voter abstains */
+    size_t num_errors; /**< number of error probabilities, at most
+                            num_issues */
+    const double *errors; /**< probability that a voter votes for a
+                               platform at distance d+1 from their own,
+                               per d; copied into the context. Noise is
+                               not available under SAMPLING_STRATIFIED */
+    unsigned num_districts; /**< districts of population_size voters
+                                 each, decided independently and spread
+                                 over the threads, whose votes make the
+                                 nationwide election; 0 for a single
+                                 electorate. Only SAMPLING_PLAIN applies,
+                                 without ballots, and the nationwide
+                                 population is at most
+                                 DISTRICTS_MAX_VOTERS */
+    size_t num_seats; /**< seats of the Chamberlin-Courant and sequential
+                           approval committees chosen in every election,
+                           or 0 */
+    unsigned minimax; /**< search the minimax platform of every
+                           election */
+    double minimax_budget; /**< seconds each minimax search may take, or
+                                0 for no limit */
+    unsigned margins; /**< compute the margin of victory of every
+                           method decided; not available under a
+                           slate */
+    double approximate; /**< confidence with which the approval winners
+                             are certified from a sample of the voters
+                             (see ApproximateEngine), within (0, 1), or
+                             0 to decide them exactly. Only available
+                             when the approval method is decided without
+                             the hitler method, a slate, or margins, and
+                             ignored with candidate_statistics */
+} SimulationConfig;
+
+/**
+ * Structured result of a single election.
+ *
+ * The arrays are owned by the simulation context and remain valid until
+ * the next election of the context is run. Only the winners of the
+ * configured methods are decided, and the statistics of the candidates
+ * are only complete when candidate_statistics is configured.
+ *
+ * Under districts, the election is the nationwide one, of the votes of
+ * every district, and the electoral winners are those of the districts.
+ */
+typedef struct{
+    unsigned long election; /**< index of the election within the
+                                 context */
+    unsigned agreements; /**< bitmask of the pairs of methods which
+                              agree (see election_agreements) */
+    unsigned turnout; /**< number of voters who cast a ballot; the
+                           population size unless voters abstain */
+    size_t num_candidates; /**< number of actual candidates, or of
+                                declared candidates under a slate */
+    size_t num_a_winners; /**< number of approval winners */
+    size_t num_h_winners; /**< number of hitler election winners */
+    size_t num_winners; /**< number of traditional election winners */
+    unsigned *hitler_table; /**< votes in the hitler election method */
+    Candidate *candidates; /**< actual candidates by descending votes */
+    Candidate washington; /**< washington candidate */
+    Candidate status_quo[2]; /**< two-party system candidates */
+    Candidate **elected; /**< traditional election winners */
+    Candidate **elected_a; /**< approval winners */
+    Candidate **elected_h; /**< hitler election winners */
+    Candidate irv; /**< instant-runoff winner */
+    size_t num_rounds; /**< number of instant-runoff rounds */
+    IrvRound *rounds; /**< tally of each instant-runoff round, or NULL
+                           if the instant-runoff method is not decided */
+    ThresholdWinner *threshold; /**< threshold approval winners at every
+                                     radius from 0 to num_issues, or NULL
+                                     if threshold is not configured */
+    size_t *threshold_ids; /**< ids of the threshold approval winners of
+                                every radius in turn, or NULL if
+                                threshold is not configured */
+    ElectoralWinner *electoral; /**< electoral winners of each method,
+                                     of NUM_METHODS, or NULL unless the
+                                     election is decided by districts */
+    size_t *electoral_ids; /**< ids of the electoral winners of every
+                                method in turn, or NULL unless the
+                                election is decided by districts */
+    size_t num_members; /**< members of each committee; the seats, or
+                             the candidates if there are fewer */
+    CommitteeSeat *chamberlin_courant; /**< Chamberlin-Courant committee,
+                                            or NULL unless committees
+                                            are configured */
+    CommitteeSeat *sequential; /**< sequential approval committee, or
+                                    NULL unless committees are
+                                    configured */
+    MinimaxPlatform *minimax; /**< minimax platform, or NULL unless
+                                   minimax is configured */
+    unsigned *margins; /**< margin of victory of each method, of
+                            NUM_METHODS (see decide_margins), or NULL
+                            unless margins are configured */
+    ApproximateReport *approximate; /**< bounds of the approximate
+                                         approval election, or NULL
+                                         unless it is configured; the
+                                         disapproval sums of all but
+                                         its contenders are estimates */
+} ElectionResult;
+
+/**
+ * Function called with the result of each election run.
+ *
+ * @param result pointer to the result of the election
+ * @param data pointer supplied to simulation_run
+ */
+typedef void (*ElectionCallback)(const ElectionResult *result, void *data);
+
+/**
+ * Opaque simulation context: configuration, generator state, and the
+ * buffers reused by every election. Contexts share no mutable state, so
+ * separate contexts may run concurrently on separate threads.
+ */
+typedef struct Simulation Simulation;
+
+/**
+ * Returns the largest configuration a simulation context accepts.
+ *
+ * @param max_issues pointer to the maximum number of issues
+ * @param max_population pointer to the maximum population size
+ */
+void simulation_limits(unsigned *max_issues, unsigned *max_population);
+
+/**
+ * Fills a SimulationConfig structure with the default configuration:
+ * DEFAULT_METHODS, no candidate statistics, and a single thread. The
+ * number of issues and the population size are left at 0 and must be
+ * set by the caller.
+ *
+ * @param config pointer to the configuration
+ */
+void simulation_default_config(SimulationConfig *config);
+
+/**
+ * Creates a simulation context; every buffer the context needs is
+ * allocated here, so running elections allocates no memory.
+ *
+ * @param config pointer to the configuration, copied into the context
+ * @param simulation pointer to the variable holding the new context
+ *
+ * @return 0 on success, -1 if the configuration exceeds the limits, the
+ *         slate is invalid, or memory or threads could not be allocated
+ *
+ * @sa simulation_limits
+ */
+int simulation_create(const SimulationConfig *config, Simulation **simulation);
+
+/**
+ * Reseeds a simulation context and discards its elections, keeping its
+ * buffers; the context then runs exactly the elections of a context
+ * freshly created with the new seed.
+ *
+ * @param seed seed of the pseudo-random number generator
+ * @param stream stream of the pseudo-random number generator
+ * @param simulation pointer to the context
+ */
+void simulation_reset(uint64_t seed, uint64_t stream, Simulation *simulation);
+
+/**
+ * Releases a simulation context.
+ *
+ * @param simulation pointer to the context; may be NULL
+ */
+void simulation_destroy(Simulation *simulation);
+
+/**
+ * Saves the progress of a simulation context to a checkpoint: the
+ * number of elections run, the generator state, the sampler, the noise
+ * model, and the summary. The buffers hold nothing an election needs
+ * from the one before it, and are not saved.
+ *
+ * @param simulation pointer to the context
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the write failed
+ *
+ * @sa checkpoint_begin
+ */
+int simulation_save(const Simulation *simulation, FILE *stream);
+
+/**
+ * Restores the progress of a simulation context saved by
+ * simulation_save; the context then runs exactly the elections the
+ * saved context would have run next.
+ *
+ * @param stream stream of the checkpoint
+ * @param simulation pointer to a context created with the configuration
+ *                   of the saved one
+ *
+ * @return 0 on success, -1 if the checkpoint ended first or does not
+ *         fit the context
+ */
+int simulation_load(FILE *stream, Simulation *simulation);
+
+/**
+ * Runs elections and accumulates their agreement in the summary of the
+ * context.
+ *
+ * @param num_elections number of elections to run
+ * @param callback function called with the result of each election; may
+ *                 be NULL
+ * @param data pointer passed through to the callback
+ * @param simulation pointer to the context
+ */
+void simulation_run(unsigned long num_elections,
+                    ElectionCallback callback,
+                    void *data,
+                    Simulation *simulation);
+
+/**
+ * Counts the elections run by a simulation context, and times a sample
+ * of them, in a set of telemetry counters. Only the thread running the
+ * context may hold the counters.
+ *
+ * @param telemetry pointer to the counters, or NULL to stop counting
+ * @param simulation pointer to the context
+ */
+void simulation_attach_telemetry(TelemetryCounters *telemetry, Simulation *simulation);
+
+/**
+ * Returns the configuration of a simulation context.
+ *
+ * @param simulation pointer to the context
+ *
+ * @return pointer to the configuration
+ */
+const SimulationConfig *simulation_config(const Simulation *simulation);
+
+/**
+ * Returns the result of the election most recently run by a simulation
+ * context.
+ *
+ * @param simulation pointer to the context
+ *
+ * @return pointer to the result, or NULL if no election was run
+ */
+const ElectionResult *simulation_result(const Simulation *simulation);
+
+/**
+ * Returns the agreement accumulated over every election run by a
+ * simulation context.
+ *
+ * @param simulation pointer to the context
+ *
+ * @return pointer to the summary
+ *
+ * @sa summary_estimate, print_summary
+ */
+const Summary *simulation_summary(const Simulation *simulation);
+
+#endif
@@ -0,0 +1,270 @@
+/*======================================================================
+ *                                slate.c
+ *======================================================================
+ * Declared slates of candidates and their nearest-member transform.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Declared slates of candidates and their nearest-member transform.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "bit_functions.h"
+#include "election.h"
+#include "slate.h"
+
+int parse_slate(const char *list, size_t *num_members, size_t **members){
+    // one id per comma, plus the last
+    size_t capacity = 1;
+    const char *c;
+    for(c = list; *c; c++){
+        capacity += (*c == ',');
+    }
+    *members = malloc(sizeof(**members) * capacity);
+    if(!*members){
+        return -1;
+    }
+
+    *num_members = 0;
+    do{
+        char *check;
+        unsigned long id = strtoul(list, &check, 0);
+        if(check == list || (*check && *check != ',')){
+            break;
+        }
+        size_t m;
+        for(m = 0; m < *num_members && (*members)[m] != id; m++);
+        if(m < *num_members){
+            break;
+        }
+        (*members)[(*num_members)++] = id;
+        list = check;
+    }while(*list++);
+
+    if(*num_members != capacity || *num_members < 2){
+        free(*members);
+        *members = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+int slate_init(unsigned num_issues,
+               size_t num_members,
+               const size_t *members,
+               Slate *slate){
+    size_t pool_size = (size_t)1 << num_issues;
+    memset(slate, 0, sizeof(*slate));
+    if(num_members < 2){
+        return -1;
+    }
+
+    slate->num_members = num_members;
+    slate->members = malloc(sizeof(*slate->members) * num_members);
+    slate->nearest = malloc(sizeof(*slate->nearest) * pool_size);
+    unsigned char *distance = malloc(sizeof(*distance) * pool_size);
+    size_t *queue = malloc(sizeof(*queue) * pool_size);
+    if(!slate->members || !slate->nearest || !distance || !queue){
+        free(distance);
+        free(queue);
+        slate_free(slate);
+        return -1;
+    }
+
+    // every member is a source at distance 0
+    memset(distance, 0xFF, sizeof(*distance) * pool_size);
+    size_t head = 0, tail = 0;
+    size_t m;
+    for(m = 0; m < num_members; m++){
+        if(members[m] >= pool_size || distance[members[m]] != 0xFF){
+            free(distance);
+            free(queue);
+            slate_free(slate);
+            return -1;
+        }
+        slate->members[m] = members[m];
+        slate->nearest[members[m]] = m;
+        distance[members[m]] = 0;
+        queue[tail++] = members[m];
+    }
+
+    // breadth-first search over the n-cube: a platform's nearest
+    // members are the union of those of its neighbours one step closer,
+    // so it is a tie unless they all agree
+    while(head < tail){
+        size_t platform = queue[head++];
+        unsigned w;
+        for(w = 0; w < num_issues; w++){
+            size_t neighbour = platform ^ ((size_t)1 << w);
+            if(distance[neighbour] == 0xFF){
+                distance[neighbour] = distance[platform] + 1;
+                slate->nearest[neighbour] = slate->nearest[platform];
+                queue[tail++] = neighbour;
+            }else if(distance[neighbour] == distance[platform] + 1 &&
+                     slate->nearest[neighbour] != slate->nearest[platform]){
+                slate->nearest[neighbour] = SLATE_TIE;
+            }
+        }
+    }
+
+    free(distance);
+    free(queue);
+    return 0;
+}
+
+void slate_free(Slate *slate){
+    free(slate->members);
+    free(slate->nearest);
+    slate->members = NULL;
+    slate->nearest = NULL;
+}
+
+void decide_slate_election(unsigned plan,
+                           unsigned population_size,
+                           unsigned num_issues,
+                           size_t num_groups,
+                           size_t *num_a_winners,
+                           size_t *num_h_winners,
+                           size_t *num_winners,
+                           unsigned *stance_poll,
+                           unsigned *hitler_table,
+                           Candidate *groups,
+                           Candidate *candidates,
+                           Candidate *washington,
+                           Candidate *status_quo,
+                           Candidate **elected,
+                           Candidate **elected_a,
+                           Candidate **elected_h,
+                           const Slate *slate){
+    const size_t mask = ((size_t)1 << num_issues) - 1;
+    const size_t num_members = slate->num_members;
+    size_t i;
+    for(i = 0; i < num_members; i++){
+        candidates[i].id = slate->members[i];
+        candidates[i].votes = 0;
+        hitler_table[candidates[i].id] = 0;
+    }
+    for(i = 0; i < num_issues; i++){
+        stance_poll[i] = 0;
+    }
+
+    // tally each voter group's vote and hitler vote
+    for(i = 0; i < num_groups; i++){
+        unsigned nearest = slate->nearest[groups[i].id];
+        if(nearest != SLATE_TIE){
+            candidates[nearest].votes += groups[i].votes;
+        }
+        if(plan & STAGE_HITLER){
+            unsigned farthest = slate->nearest[groups[i].id ^ mask];
+            if(farthest != SLATE_TIE){
+                hitler_table[slate->members[farthest]] += groups[i].votes;
+            }
+        }
+        if(plan & STAGE_WASHINGTON){
+            unsigned w;
+            for(w = 0; w < num_issues; w++){
+                stance_poll[w] += ((groups[i].id >> w) & 0x1) * groups[i].votes;
+            }
+        }
+    }
+
+    // rate the members against the voter groups
+    for(i = 0; i < num_members; i++){
+        if(plan & STAGE_LEANING){
+            compute_candidate_statistics(num_issues, num_groups, candidates+i, groups);
+        }else if(plan & STAGE_DISAPPROVAL){
+            unsigned sum_disapproval = 0;
+            size_t g;
+            for(g = 0; g < num_groups; g++){
+                sum_disapproval += hamming_weight(candidates[i].id ^ groups[g].id) * groups[g].votes;
+            }
+            candidates[i].sum_disapproval = sum_disapproval;
+        }
+    }
+
+    if(plan & STAGE_SORT){
+        qsort(candidates, num_members, sizeof(*candidates), sort_candidates);
+    }
+    find_election_winners(plan,
+                          num_members,
+                          num_a_winners,
+                          num_h_winners,
+                          num_winners,
+                          hitler_table,
+                          candidates,
+                          elected,
+                          elected_a,
+                          elected_h);
+
+    if(plan & STAGE_WASHINGTON){
+        find_washington_candidate(plan,
+                                  population_size,
+                                  num_issues,
+                                  num_groups,
+                                  stance_poll,
+                                  groups,
+                                  washington);
+    }
+
+    // two-party system election between the leading members
+    if(plan & STAGE_TWO_PARTY){
+        status_quo[0] = candidates[0];
+        status_quo[1] = candidates[1];
+        status_quo[0].votes = 0;
+        status_quo[1].votes = 0;
+        for(i = 0; i < num_groups; i++){
+            unsigned disapproval_0 = hamming_weight(status_quo[0].id ^ groups[i].id);
+            unsigned disapproval_1 = hamming_weight(status_quo[1].id ^ groups[i].id);
+            if(disapproval_0 < disapproval_1){
+                status_quo[0].votes += groups[i].votes;
+            }else if(disapproval_0 > disapproval_1){
+                status_quo[1].votes += groups[i].votes;
+            }
+        }
+        qsort(status_quo, 2, sizeof(*status_quo), sort_candidates);
+    }
+}
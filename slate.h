@@ -0,0 +1,171 @@
+/*======================================================================
+ *                                slate.h
+ *======================================================================
+ * Declared slates of candidates and their nearest-member transform.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Declared slates of candidates and their nearest-member transform.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef SLATE_H
+#define SLATE_H
+
+#include <stddef.h>
+
+#include "election.h"
+
+/**
+ * Value of Slate.nearest for platforms equally near to several members.
+ */
+#define SLATE_TIE ((unsigned)-1)
+
+/**
+ * A declared slate of candidates: every voter votes for the member
+ * nearest to their platform, instead of for their own platform.
+ */
+typedef struct{
+    size_t num_members; /**< number of declared candidates */
+    size_t *members; /**< ids of the declared candidates */
+    unsigned *nearest; /**< index of the member nearest to each
+                            platform, or SLATE_TIE */
+} Slate;
+
+/**
+ * Parses a comma-separated list of distinct candidate ids.
+ *
+ * @param list the list of ids
+ * @param num_members pointer to the variable to hold the number of ids
+ * @param members pointer to the variable to hold the allocated array of
+ *                ids
+ *
+ * @return 0 on success, -1 if the list is malformed, holds fewer than
+ *         two or repeated ids, or memory could not be allocated
+ */
+int parse_slate(const char *list, size_t *num_members, size_t **members);
+
+/**
+ * Initializes a Slate structure and computes the member nearest to
+ * every platform.
+ *
+ * The nearest members are found by a breadth-first search from every
+ * member at once over the n-cube of platforms, in O(n*2^n) time; a
+ * platform reached at the same distance from two members is a tie.
+ *
+ * @param num_issues number of issues in the election
+ * @param num_members number of declared candidates; at least two
+ * @param members ids of the declared candidates, less than 2^num_issues
+ * @param slate pointer to the slate
+ *
+ * @return 0 on success, -1 if the members are invalid or memory could
+ *         not be allocated
+ */
+int slate_init(unsigned num_issues,
+               size_t num_members,
+               const size_t *members,
+               Slate *slate);
+
+/**
+ * Releases the memory held by a Slate structure.
+ *
+ * @param slate pointer to the slate
+ */
+void slate_free(Slate *slate);
+
+/**
+ * Decides an election between the members of a declared slate.
+ *
+ * The voter groups of perform_election vote for their nearest member;
+ * a group's hitler is the member farthest from it, i.e. the member
+ * nearest to its complement. Groups tied between members cast no vote
+ * (or no hitler vote). Approval and the two-party system election are
+ * decided over the voter groups, and the washington candidate is found
+ * from their stances; it need not be a member.
+ *
+ * @param plan bitmask of Stage values
+ * @param population_size number of voters in the election
+ * @param num_issues number of issues in the election
+ * @param num_groups number of voter groups
+ * @param num_a_winners pointer to the variable to hold the number of
+ *                      approval winners
+ * @param num_h_winners pointer to the variable to hold the number of
+ *                      hitler election winners
+ * @param num_winners pointer to the variable to hold the number of
+ *                    traditional election winners
+ * @param stance_poll array to hold average voter stance on election
+ *                    issues
+ * @param hitler_table array to hold votes in hitler election method
+ * @param groups array of voter groups returned by perform_election
+ * @param candidates array to hold the members as candidates; sorted by
+ *                   descending votes on return if STAGE_SORT is
+ *                   planned
+ * @param washington pointer to the washington candidate
+ * @param status_quo array to hold the two-party system candidates
+ * @param elected array to hold pointers to traditional election winners
+ * @param elected_a array to hold pointers to approval winners
+ * @param elected_h array to hold pointers to hitler election winners
+ * @param slate pointer to the slate
+ *
+ * @sa decide_election
+ */
+void decide_slate_election(unsigned plan,
+                           unsigned population_size,
+                           unsigned num_issues,
+                           size_t num_groups,
+                           size_t *num_a_winners,
+                           size_t *num_h_winners,
+                           size_t *num_winners,
+                           unsigned *stance_poll,
+                           unsigned *hitler_table,
+                           Candidate *groups,
+                           Candidate *candidates,
+                           Candidate *washington,
+                           Candidate *status_quo,
+                           Candidate **elected,
+                           Candidate **elected_a,
+                           Candidate **elected_h,
+                           const Slate *slate);
+
+#endif
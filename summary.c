@@ -0,0 +1,430 @@
+/*======================================================================
+ *                               summary.c
+ *======================================================================
+ * Aggregate estimates of winner agreement across elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Aggregate estimates of winner agreement across elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "checkpoint.h"
+#include "sampling.h"
+#include "summary.h"
+
+static const char *AGREEMENT_NAMES[NUM_AGREEMENTS] = {
+    "Traditional = Approval",
+    "Traditional = Hitler",
+    "Traditional = Two-Party",
+    "Traditional = Washington",
+    "Traditional = IRV",
+    "Approval = Hitler",
+    "Approval = Two-Party",
+    "Approval = Washington",
+    "Approval = IRV",
+    "Hitler = Two-Party",
+    "Hitler = Washington",
+    "Hitler = IRV",
+    "Two-Party = Washington",
+    "Two-Party = IRV",
+    "Washington = IRV"
+};
+
+/*
+ * Checks whether two sets of winners share a candidate; the sets are
+ * small so a pairwise scan suffices.
+ */
+static unsigned winners_intersect(size_t num_a,
+                                  size_t num_b,
+                                  Candidate **a,
+                                  Candidate **b){
+    size_t i, j;
+    for(i = 0; i < num_a; i++){
+        for(j = 0; j < num_b; j++){
+            if(a[i]->id == b[j]->id){
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+const char *agreement_name(Agreement agreement){
+    return AGREEMENT_NAMES[agreement];
+}
+
+unsigned method_agreements(unsigned methods){
+    // pairs are enumerated in the order of the Agreement enumeration
+    unsigned agreements = 0;
+    unsigned bit = 0;
+    unsigned a, b;
+    for(a = 0; a < NUM_METHODS; a++){
+        for(b = a+1; b < NUM_METHODS; b++, bit++){
+            agreements |= ((methods >> a) & (methods >> b) & 0x1) << bit;
+        }
+    }
+    return agreements;
+}
+
+unsigned election_agreements(size_t num_a_winners,
+                             size_t num_h_winners,
+                             size_t num_winners,
+                             Candidate *washington,
+                             Candidate *irv,
+                             Candidate *status_quo,
+                             Candidate **elected,
+                             Candidate **elected_a,
+                             Candidate **elected_h){
+    // two-party winners: both candidates on a tied vote
+    Candidate *elected_t[2] = {status_quo, status_quo+1};
+    size_t num_t_winners = (status_quo[0].votes == status_quo[1].votes) ? 2 : 1;
+    Candidate *elected_w[1] = {washington};
+    Candidate *elected_r[1] = {irv};
+
+    // sets in the order of the Method enumeration
+    size_t num[NUM_METHODS] = {num_winners, num_a_winners, num_h_winners,
+                               num_t_winners, 1, irv ? 1 : 0};
+    Candidate **sets[NUM_METHODS] = {elected, elected_a, elected_h,
+                                     elected_t, elected_w, elected_r};
+
+    // pairs are enumerated in the order of the Agreement enumeration
+    unsigned agreements = 0;
+    unsigned bit = 0;
+    size_t a, b;
+    for(a = 0; a < NUM_METHODS; a++){
+        for(b = a+1; b < NUM_METHODS; b++, bit++){
+            agreements |= winners_intersect(num[a], num[b], sets[a], sets[b]) << bit;
+        }
+    }
+    return agreements;
+}
+
+int summary_init(unsigned methods,
+                 unsigned population_size,
+                 unsigned num_replicates,
+                 size_t num_strata,
+                 size_t pool_size,
+                 SamplingScheme scheme,
+                 Summary *summary){
+    memset(summary, 0, sizeof(*summary));
+    summary->scheme = scheme;
+    summary->reported = method_agreements(methods);
+    summary->methods = methods;
+
+    if(scheme == SAMPLING_STRATIFIED){
+        summary->num_groups = num_strata ? num_strata : 1;
+    }else if(scheme == SAMPLING_SOBOL){
+        summary->num_groups = num_replicates ? num_replicates : 1;
+    }else{
+        return 0;
+    }
+
+    summary->group_probability = malloc(sizeof(*summary->group_probability) * summary->num_groups);
+    summary->group_elections = calloc(summary->num_groups, sizeof(*summary->group_elections));
+    summary->group_count = calloc(summary->num_groups * NUM_AGREEMENTS, sizeof(*summary->group_count));
+    if(!summary->group_probability || !summary->group_elections || !summary->group_count){
+        summary_free(summary);
+        return -1;
+    }
+
+    if(scheme == SAMPLING_STRATIFIED){
+        if(candidate_count_distribution(population_size, summary->num_groups,
+                                        pool_size, summary->group_probability)){
+            summary_free(summary);
+            return -1;
+        }
+    }else{
+        size_t g;
+        for(g = 0; g < summary->num_groups; g++){
+            summary->group_probability[g] = 1.0/summary->num_groups;
+        }
+    }
+    return 0;
+}
+
+void summary_reset(Summary *summary){
+    summary->num_elections = 0;
+    summary->pending = 0;
+    summary->num_pairs = 0;
+    memset(summary->count, 0, sizeof(summary->count));
+    memset(summary->pair_count, 0, sizeof(summary->pair_count));
+    memset(summary->pair_both, 0, sizeof(summary->pair_both));
+    summary->num_districted = 0;
+    memset(summary->electoral_count, 0, sizeof(summary->electoral_count));
+    if(summary->num_groups){
+        memset(summary->group_elections, 0,
+               sizeof(*summary->group_elections) * summary->num_groups);
+        memset(summary->group_count, 0,
+               sizeof(*summary->group_count) * summary->num_groups * NUM_AGREEMENTS);
+    }
+}
+
+void summary_free(Summary *summary){
+    free(summary->group_probability);
+    free(summary->group_elections);
+    free(summary->group_count);
+    summary->group_probability = NULL;
+    summary->group_elections = NULL;
+    summary->group_count = NULL;
+}
+
+int summary_save(const Summary *summary, FILE *stream){
+    return -(checkpoint_put(&summary->num_groups, sizeof(summary->num_groups), stream) ||
+             checkpoint_put(&summary->num_elections, sizeof(summary->num_elections), stream) ||
+             checkpoint_put(summary->count, sizeof(summary->count), stream) ||
+             checkpoint_put(&summary->pending, sizeof(summary->pending), stream) ||
+             checkpoint_put(&summary->num_pairs, sizeof(summary->num_pairs), stream) ||
+             checkpoint_put(summary->pair_count, sizeof(summary->pair_count), stream) ||
+             checkpoint_put(summary->pair_both, sizeof(summary->pair_both), stream) ||
+             checkpoint_put(summary->group_elections,
+                            sizeof(*summary->group_elections) * summary->num_groups, stream) ||
+             checkpoint_put(summary->group_count,
+                            sizeof(*summary->group_count) * summary->num_groups * NUM_AGREEMENTS,
+                            stream) ||
+             checkpoint_put(&summary->num_districted, sizeof(summary->num_districted), stream) ||
+             checkpoint_put(summary->electoral_count, sizeof(summary->electoral_count), stream));
+}
+
+int summary_load(FILE *stream, Summary *summary){
+    size_t num_groups;
+    if(checkpoint_get(&num_groups, sizeof(num_groups), stream) ||
+       num_groups != summary->num_groups){
+        return -1;
+    }
+    return -(checkpoint_get(&summary->num_elections, sizeof(summary->num_elections), stream) ||
+             checkpoint_get(summary->count, sizeof(summary->count), stream) ||
+             checkpoint_get(&summary->pending, sizeof(summary->pending), stream) ||
+             checkpoint_get(&summary->num_pairs, sizeof(summary->num_pairs), stream) ||
+             checkpoint_get(summary->pair_count, sizeof(summary->pair_count), stream) ||
+             checkpoint_get(summary->pair_both, sizeof(summary->pair_both), stream) ||
+             checkpoint_get(summary->group_elections,
+                            sizeof(*summary->group_elections) * num_groups, stream) ||
+             checkpoint_get(summary->group_count,
+                            sizeof(*summary->group_count) * num_groups * NUM_AGREEMENTS, stream) ||
+             checkpoint_get(&summary->num_districted, sizeof(summary->num_districted), stream) ||
+             checkpoint_get(summary->electoral_count, sizeof(summary->electoral_count), stream));
+}
+
+void summary_record(unsigned agreements,
+                    unsigned replicate,
+                    size_t num_candidates,
+                    Summary *summary){
+    unsigned a;
+    for(a = 0; a < NUM_AGREEMENTS; a++){
+        summary->count[a] += (agreements >> a) & 0x1;
+    }
+
+    if(summary->scheme == SAMPLING_ANTITHETIC){
+        // the second election of a pair completes it
+        if(summary->num_elections & 0x1){
+            for(a = 0; a < NUM_AGREEMENTS; a++){
+                unsigned first = (summary->pending >> a) & 0x1;
+                unsigned second = (agreements >> a) & 0x1;
+                summary->pair_count[a] += first + second;
+                summary->pair_both[a] += first & second;
+            }
+            summary->num_pairs++;
+        }else{
+            summary->pending = agreements;
+        }
+    }else if(summary->num_groups){
+        size_t g;
+        if(summary->scheme == SAMPLING_STRATIFIED){
+            g = (num_candidates < summary->num_groups) ? num_candidates : summary->num_groups;
+            g = g ? g-1 : 0;
+        }else{
+            g = replicate % summary->num_groups;
+        }
+        summary->group_elections[g]++;
+        for(a = 0; a < NUM_AGREEMENTS; a++){
+            summary->group_count[g*NUM_AGREEMENTS + a] += (agreements >> a) & 0x1;
+        }
+    }
+
+    summary->num_elections++;
+}
+
+void summary_record_electoral(unsigned popular, Summary *summary){
+    unsigned m;
+    for(m = 0; m < NUM_METHODS; m++){
+        summary->electoral_count[m] += (popular >> m) & 0x1;
+    }
+    summary->num_districted++;
+}
+
+/*
+ * Unbiased variance of a sample of n indicators with the given mean.
+ */
+static double indicator_variance(double mean, double n){
+    return (n > 1) ? mean*(1.0-mean)*n/(n-1) : 0;
+}
+
+void summary_estimate(Agreement agreement,
+                      const Summary *summary,
+                      double *estimate,
+                      double *std_error,
+                      double *ess){
+    double n = summary->num_elections;
+    double mean = n ? summary->count[agreement]/n : 0;
+    // variance of a single plainly sampled election
+    double variance = indicator_variance(mean, n);
+    double estimate_variance = -1;
+
+    *estimate = mean;
+    if(summary->scheme == SAMPLING_ANTITHETIC && summary->num_pairs){
+        double m = summary->num_pairs;
+        double sum = summary->pair_count[agreement]/2.0;
+        double sum_sq = (summary->pair_count[agreement] + 2.0*summary->pair_both[agreement])/4.0;
+        *estimate = sum/m;
+        if(m > 1){
+            estimate_variance = (sum_sq - m*(*estimate)*(*estimate))/(m-1)/m;
+        }
+    }else if(summary->scheme == SAMPLING_STRATIFIED && summary->num_groups){
+        // renormalize over the strata that were observed
+        double weight = 0;
+        size_t g;
+        for(g = 0; g < summary->num_groups; g++){
+            if(summary->group_elections[g]){
+                weight += summary->group_probability[g];
+            }
+        }
+        *estimate = 0;
+        estimate_variance = 0;
+        for(g = 0; weight > 0 && g < summary->num_groups; g++){
+            double n_g = summary->group_elections[g];
+            if(!n_g){
+                continue;
+            }
+            double p_g = summary->group_probability[g]/weight;
+            double mean_g = summary->group_count[g*NUM_AGREEMENTS + agreement]/n_g;
+            double variance_g = (n_g > 1) ? indicator_variance(mean_g, n_g) : variance;
+            *estimate += p_g*mean_g;
+            estimate_variance += p_g*p_g*variance_g/n_g;
+        }
+    }else if(summary->scheme == SAMPLING_SOBOL && summary->num_groups){
+        // replicate means are independent and identically distributed
+        double r = 0, sum = 0, sum_sq = 0;
+        size_t g;
+        for(g = 0; g < summary->num_groups; g++){
+            double n_g = summary->group_elections[g];
+            if(n_g){
+                double mean_g = summary->group_count[g*NUM_AGREEMENTS + agreement]/n_g;
+                sum += mean_g;
+                sum_sq += mean_g*mean_g;
+                r++;
+            }
+        }
+        if(r){
+            *estimate = sum/r;
+        }
+        if(r > 1){
+            estimate_variance = (sum_sq - r*(*estimate)*(*estimate))/(r-1)/r;
+        }
+    }else if(n){
+        estimate_variance = variance/n;
+    }
+
+    if(estimate_variance < 0){
+        *std_error = -1;
+        *ess = n;
+    }else{
+        *std_error = sqrt(estimate_variance);
+        if(variance <= 0){
+            *ess = n;
+        }else if(estimate_variance > 0){
+            *ess = variance/estimate_variance;
+        }else{
+            *ess = HUGE_VAL;
+        }
+    }
+}
+
+void print_summary(const Summary *summary){
+    printf("\n========== SUMMARY ==========\n");
+    printf("Sampling Scheme: %s\n", sampling_scheme_name(summary->scheme));
+    printf("Elections: %lu\n", summary->num_elections);
+
+    printf("\nWinner Agreement:             Probability  Std. Error          ESS\n");
+    unsigned a;
+    for(a = 0; a < NUM_AGREEMENTS; a++){
+        if(!((summary->reported >> a) & 0x1)){
+            continue;
+        }
+        double estimate, std_error, ess;
+        summary_estimate(a, summary, &estimate, &std_error, &ess);
+        printf("  %-26s %12.4lf", agreement_name(a), estimate);
+        if(std_error < 0){
+            printf("  %10s", "n/a");
+        }else{
+            printf("  %10.4lf", std_error);
+        }
+        if(isinf(ess)){
+            printf("  %11s\n", "inf");
+        }else{
+            printf("  %11.1lf\n", ess);
+        }
+    }
+
+    if(summary->num_districted){
+        double n = summary->num_districted;
+        printf("\nPopular Electoral Winner:     Probability  Std. Error\n");
+        unsigned m;
+        for(m = 0; m < NUM_METHODS; m++){
+            if(!((summary->methods >> m) & 0x1)){
+                continue;
+            }
+            double mean = summary->electoral_count[m]/n;
+            printf("  %-26s %12.4lf  %10.4lf\n", method_name(m), mean,
+                   sqrt(indicator_variance(mean, n)/n));
+        }
+    }
+
+    printf("\n----------------------------------------------------------------------\n");
+}
@@ -0,0 +1,274 @@
+/*======================================================================
+ *                               summary.h
+ *======================================================================
+ * Aggregate estimates of winner agreement across elections.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Aggregate estimates of winner agreement across elections.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef SUMMARY_H
+#define SUMMARY_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "election.h"
+#include "sampling.h"
+
+/**
+ * Pairs of election methods whose winners are compared; a pair agrees
+ * when the winners of the two methods share a candidate.
+ */
+typedef enum{
+    AGREE_TRADITIONAL_APPROVAL,
+    AGREE_TRADITIONAL_HITLER,
+    AGREE_TRADITIONAL_TWO_PARTY,
+    AGREE_TRADITIONAL_WASHINGTON,
+    AGREE_TRADITIONAL_IRV,
+    AGREE_APPROVAL_HITLER,
+    AGREE_APPROVAL_TWO_PARTY,
+    AGREE_APPROVAL_WASHINGTON,
+    AGREE_APPROVAL_IRV,
+    AGREE_HITLER_TWO_PARTY,
+    AGREE_HITLER_WASHINGTON,
+    AGREE_HITLER_IRV,
+    AGREE_TWO_PARTY_WASHINGTON,
+    AGREE_TWO_PARTY_IRV,
+    AGREE_WASHINGTON_IRV,
+    NUM_AGREEMENTS
+} Agreement;
+
+/**
+ * Accumulates winner agreement across elections.
+ *
+ * Elections are grouped by stratum (number of actual candidates) under
+ * SAMPLING_STRATIFIED and by replicate under SAMPLING_SOBOL.
+ */
+typedef struct{
+    SamplingScheme scheme; /**< sampling scheme of the elections */
+    unsigned reported; /**< bitmask of the pairs reported, those whose
+                            methods were both requested */
+    unsigned long num_elections; /**< number of elections recorded */
+    unsigned long count[NUM_AGREEMENTS]; /**< number of elections in
+                                              which each pair agreed */
+    unsigned pending; /**< agreements of the first election of an
+                           unfinished antithetic pair */
+    unsigned long num_pairs; /**< number of finished antithetic pairs */
+    unsigned long pair_count[NUM_AGREEMENTS]; /**< sum over pairs of the
+                                                   pair's agreements */
+    unsigned long pair_both[NUM_AGREEMENTS]; /**< number of pairs in
+                                                  which both elections
+                                                  agreed */
+    size_t num_groups; /**< number of strata or replicates */
+    double *group_probability; /**< probability of each stratum */
+    unsigned long *group_elections; /**< elections in each group */
+    unsigned long *group_count; /**< agreements in each group, indexed
+                                     by group*NUM_AGREEMENTS+agreement */
+    unsigned methods; /**< set of election methods requested */
+    unsigned long num_districted; /**< number of elections decided by
+                                       districts */
+    unsigned long electoral_count[NUM_METHODS]; /**< number of those in
+                                                     which an electoral
+                                                     winner of each method
+                                                     won the popular vote */
+} Summary;
+
+/**
+ * Returns the name of a pair of election methods.
+ *
+ * @param agreement the pair of methods
+ *
+ * @return the name of the pair
+ */
+const char *agreement_name(Agreement agreement);
+
+/**
+ * Returns the pairs of election methods within a set of methods.
+ *
+ * @param methods set of election methods (see Method)
+ *
+ * @return bitmask with bit a set when both methods of pair a (an
+ *         Agreement) are in the set
+ */
+unsigned method_agreements(unsigned methods);
+
+/**
+ * Determines which pairs of election methods agree on a winner.
+ *
+ * @param num_a_winners number of approval winners
+ * @param num_h_winners number of hitler election winners
+ * @param num_winners number of traditional election winners
+ * @param washington pointer to washington candidate
+ * @param irv pointer to instant-runoff winner, or NULL if it was not
+ *            decided
+ * @param status_quo array holding the two-party system candidates
+ * @param elected array of pointers to traditional election winners
+ * @param elected_a array of pointers to approval winners
+ * @param elected_h array of pointers to hitler election winners
+ *
+ * @return bitmask with bit a set when pair a (an Agreement) agrees
+ */
+unsigned election_agreements(size_t num_a_winners,
+                             size_t num_h_winners,
+                             size_t num_winners,
+                             Candidate *washington,
+                             Candidate *irv,
+                             Candidate *status_quo,
+                             Candidate **elected,
+                             Candidate **elected_a,
+                             Candidate **elected_h);
+
+/**
+ * Initializes a Summary structure.
+ *
+ * @param methods set of election methods whose pairs are reported
+ * @param population_size number of voters in the election
+ * @param num_replicates number of scrambled Sobol' replicates
+ * @param num_strata number of strata over the number of actual
+ *                   candidates
+ * @param pool_size number of possible candidates
+ * @param scheme sampling scheme of the elections
+ * @param summary pointer to the summary
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int summary_init(unsigned methods,
+                 unsigned population_size,
+                 unsigned num_replicates,
+                 size_t num_strata,
+                 size_t pool_size,
+                 SamplingScheme scheme,
+                 Summary *summary);
+
+/**
+ * Discards the elections recorded in a Summary structure, keeping its
+ * configuration and memory.
+ *
+ * @param summary pointer to the summary
+ */
+void summary_reset(Summary *summary);
+
+/**
+ * Releases the memory held by a Summary structure.
+ *
+ * @param summary pointer to the summary
+ */
+void summary_free(Summary *summary);
+
+/**
+ * Saves the elections recorded in a Summary structure to a checkpoint;
+ * the configuration and the probabilities of the groups are not saved.
+ *
+ * @param summary pointer to the summary
+ * @param stream stream of the checkpoint
+ *
+ * @return 0 on success, -1 if the write failed
+ *
+ * @sa checkpoint_begin
+ */
+int summary_save(const Summary *summary, FILE *stream);
+
+/**
+ * Restores the elections recorded in a Summary structure saved by
+ * summary_save.
+ *
+ * @param stream stream of the checkpoint
+ * @param summary pointer to a summary of the same configuration as the
+ *                one saved
+ *
+ * @return 0 on success, -1 if the checkpoint ended first or does not
+ *         fit the summary
+ */
+int summary_load(FILE *stream, Summary *summary);
+
+/**
+ * Records the agreements of an election.
+ *
+ * @param agreements bitmask returned by election_agreements
+ * @param replicate replicate of the election
+ * @param num_candidates number of actual candidates
+ * @param summary pointer to the summary
+ */
+void summary_record(unsigned agreements,
+                    unsigned replicate,
+                    size_t num_candidates,
+                    Summary *summary);
+
+/**
+ * Records which electoral winners of an election decided by districts
+ * also won the nationwide election; such elections are plainly
+ * sampled.
+ *
+ * @param popular bitmask returned by district_popular_winners
+ * @param summary pointer to the summary
+ */
+void summary_record_electoral(unsigned popular, Summary *summary);
+
+/**
+ * Computes the estimated probability that a pair of methods agrees.
+ *
+ * @param agreement the pair of methods
+ * @param summary pointer to the summary
+ * @param estimate pointer to the variable to hold the estimate
+ * @param std_error pointer to the variable to hold the standard error
+ *                  of the estimate; negative if it cannot be estimated
+ * @param ess pointer to the variable to hold the effective sample size
+ */
+void summary_estimate(Agreement agreement,
+                      const Summary *summary,
+                      double *estimate,
+                      double *std_error,
+                      double *ess);
+
+/**
+ * Print summary of the elections to stdout.
+ *
+ * @param summary pointer to the summary
+ */
+void print_summary(const Summary *summary);
+
+#endif
@@ -0,0 +1,339 @@
+/*======================================================================
+ *                              telemetry.c
+ *======================================================================
+ * Live counters of a running simulation and their reporter thread.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Live counters of a running simulation and their reporter thread.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "telemetry.h"
+
+/*
+ * Counters of a thread and a cache line of padding, so that no two
+ * threads write the same line.
+ */
+typedef struct{
+    TelemetryCounters counters;
+    char padding[64];
+} CounterSlot;
+
+/*
+ * Sums of the counters of every thread at one report.
+ */
+typedef struct{
+    uint64_t time;
+    TelemetryCounters total;
+} Report;
+
+struct Telemetry{
+    char *path; // snapshot file, or NULL
+    char *temporary; // file renamed over the snapshot
+    TelemetryFormat format;
+    unsigned progress;
+    uint64_t interval; // nanoseconds between reports
+    unsigned long num_elections;
+    uint64_t start;
+    Report last;
+
+    pthread_t reporter;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    unsigned stopping;
+
+    unsigned num_counters; // counters handed out
+    CounterSlot slots[TELEMETRY_MAX_COUNTERS];
+};
+
+static const char *const PHASE_NAMES[TELEMETRY_PHASES] = {"allocate", "decide", "record"};
+
+uint64_t telemetry_clock(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000 + now.tv_nsec;
+}
+
+TelemetryCounters *telemetry_counters(Telemetry *telemetry){
+    if(!telemetry){
+        return NULL;
+    }
+    unsigned slot = __atomic_fetch_add(&telemetry->num_counters, 1, __ATOMIC_RELAXED);
+    if(slot >= TELEMETRY_MAX_COUNTERS){
+        return NULL;
+    }
+    return &telemetry->slots[slot].counters;
+}
+
+/*
+ * Sums the counters of every thread.
+ */
+static void take_report(Telemetry *telemetry, Report *report){
+    memset(report, 0, sizeof(*report));
+    report->time = telemetry_clock();
+    TelemetryCounters *total = &report->total;
+    unsigned s, p;
+    for(s = 0; s < TELEMETRY_MAX_COUNTERS; s++){
+        TelemetryCounters *counters = &telemetry->slots[s].counters;
+        total->elections += __atomic_load_n(&counters->elections, __ATOMIC_RELAXED);
+        total->candidates += __atomic_load_n(&counters->candidates, __ATOMIC_RELAXED);
+        total->records += __atomic_load_n(&counters->records, __ATOMIC_RELAXED);
+        total->record_bytes += __atomic_load_n(&counters->record_bytes, __ATOMIC_RELAXED);
+        total->timed += __atomic_load_n(&counters->timed, __ATOMIC_RELAXED);
+        for(p = 0; p < TELEMETRY_PHASES; p++){
+            total->phase_ns[p] += __atomic_load_n(&counters->phase_ns[p], __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/*
+ * Estimates the seconds spent in a phase by every election from the
+ * timed ones.
+ */
+static double phase_seconds(const TelemetryCounters *total, TelemetryPhase phase){
+    if(!total->timed){
+        return 0;
+    }
+    return 1e-9 * total->phase_ns[phase] * total->elections / total->timed;
+}
+
+static void write_prometheus(const Report *report, double elapsed, double rate, FILE *stream){
+    const TelemetryCounters *total = &report->total;
+    fprintf(stream, "# HELP votesim_elections_total Elections decided.\n"
+                    "# TYPE votesim_elections_total counter\n"
+                    "votesim_elections_total %lu\n"
+                    "# HELP votesim_candidates_total Candidates of the elections decided.\n"
+                    "# TYPE votesim_candidates_total counter\n"
+                    "votesim_candidates_total %lu\n"
+                    "# HELP votesim_records_total Election records written out.\n"
+                    "# TYPE votesim_records_total counter\n"
+                    "votesim_records_total %lu\n"
+                    "# HELP votesim_record_bytes_total Bytes of the election records written out.\n"
+                    "# TYPE votesim_record_bytes_total counter\n"
+                    "votesim_record_bytes_total %lu\n",
+                    total->elections, total->candidates, total->records, total->record_bytes);
+    fprintf(stream, "# HELP votesim_phase_seconds_total Seconds spent in each phase, estimated "
+                    "from one election in %d.\n"
+                    "# TYPE votesim_phase_seconds_total counter\n", TELEMETRY_SAMPLE_PERIOD);
+    unsigned p;
+    for(p = 0; p < TELEMETRY_PHASES; p++){
+        fprintf(stream, "votesim_phase_seconds_total{phase=\"%s\"} %.6f\n",
+                PHASE_NAMES[p], phase_seconds(total, p));
+    }
+    fprintf(stream, "# HELP votesim_elapsed_seconds Seconds since the run started.\n"
+                    "# TYPE votesim_elapsed_seconds gauge\n"
+                    "votesim_elapsed_seconds %.3f\n"
+                    "# HELP votesim_elections_per_second Elections decided per second since the "
+                    "last report.\n"
+                    "# TYPE votesim_elections_per_second gauge\n"
+                    "votesim_elections_per_second %.1f\n", elapsed, rate);
+}
+
+static void write_json(const Report *report,
+                       double elapsed,
+                       double rate,
+                       unsigned long num_elections,
+                       FILE *stream){
+    const TelemetryCounters *total = &report->total;
+    fprintf(stream, "{\"elapsed_seconds\":%.3f,\"elections\":%lu,\"elections_target\":%lu,"
+                    "\"elections_per_second\":%.1f,\"candidates\":%lu,\"records\":%lu,"
+                    "\"record_bytes\":%lu,\"phase_seconds\":{",
+                    elapsed, total->elections, num_elections, rate, total->candidates,
+                    total->records, total->record_bytes);
+    unsigned p;
+    for(p = 0; p < TELEMETRY_PHASES; p++){
+        fprintf(stream, p ? ",\"%s\":%.6f" : "\"%s\":%.6f", PHASE_NAMES[p], phase_seconds(total, p));
+    }
+    fprintf(stream, "}}\n");
+}
+
+/*
+ * Writes the snapshot file and the progress line; a snapshot which
+ * cannot be written is skipped, and the next report tries again.
+ */
+static void report(Telemetry *telemetry, unsigned final){
+    Report now;
+    take_report(telemetry, &now);
+    double elapsed = 1e-9 * (now.time - telemetry->start);
+    double span = 1e-9 * (now.time - telemetry->last.time);
+    double rate = span > 0 ? (now.total.elections - telemetry->last.total.elections) / span : 0;
+    telemetry->last = now;
+
+    if(telemetry->path){
+        FILE *stream = fopen(telemetry->temporary, "w");
+        if(stream){
+            if(telemetry->format == TELEMETRY_JSON){
+                write_json(&now, elapsed, rate, telemetry->num_elections, stream);
+            }else{
+                write_prometheus(&now, elapsed, rate, stream);
+            }
+            if(fclose(stream) || rename(telemetry->temporary, telemetry->path)){
+                remove(telemetry->temporary);
+            }
+        }
+    }
+
+    if(telemetry->progress){
+        unsigned long elections = now.total.elections;
+        // the last line gives the average rate of the run
+        if(final){
+            rate = elapsed > 0 ? elections / elapsed : 0;
+        }
+        if(telemetry->num_elections){
+            fprintf(stderr, "\r%lu/%lu elections (%.1f%%), %.0f per second",
+                    elections, telemetry->num_elections,
+                    100.0 * elections / telemetry->num_elections, rate);
+            if(!final && elections && elections < telemetry->num_elections){
+                // remaining time at the average rate of the run
+                unsigned long left = elapsed * (telemetry->num_elections - elections) / elections;
+                fprintf(stderr, ", %lu:%02lu:%02lu left", left/3600, left/60%60, left%60);
+            }
+        }else{
+            fprintf(stderr, "\r%lu elections, %.0f per second", elections, rate);
+        }
+        // clear the rest of a longer previous line
+        fprintf(stderr, final ? "            \n" : "            ");
+        fflush(stderr);
+    }
+}
+
+static void *reporter_main(void *argument){
+    Telemetry *telemetry = argument;
+    uint64_t deadline = telemetry->start;
+    pthread_mutex_lock(&telemetry->lock);
+    while(!telemetry->stopping){
+        deadline += telemetry->interval;
+        struct timespec until = {deadline / 1000000000, deadline % 1000000000};
+        int status = 0;
+        while(!telemetry->stopping && status != ETIMEDOUT){
+            status = pthread_cond_timedwait(&telemetry->wake, &telemetry->lock, &until);
+        }
+        if(telemetry->stopping){
+            break;
+        }
+        pthread_mutex_unlock(&telemetry->lock);
+        report(telemetry, 0);
+        pthread_mutex_lock(&telemetry->lock);
+    }
+    pthread_mutex_unlock(&telemetry->lock);
+    report(telemetry, 1);
+    return NULL;
+}
+
+int telemetry_start(const char *path,
+                    TelemetryFormat format,
+                    unsigned progress,
+                    double interval,
+                    unsigned long num_elections,
+                    Telemetry **telemetry){
+    Telemetry *t = calloc(1, sizeof(*t));
+    *telemetry = NULL;
+    if(!t){
+        return -1;
+    }
+    t->format = format;
+    t->progress = progress;
+    t->interval = ((interval > TELEMETRY_MIN_INTERVAL) ? interval : TELEMETRY_MIN_INTERVAL) * 1e9;
+    t->num_elections = num_elections;
+    if(path){
+        t->path = malloc(strlen(path) + 1);
+        t->temporary = malloc(strlen(path) + 5);
+        if(!t->path || !t->temporary){
+            free(t->path);
+            free(t->temporary);
+            free(t);
+            return -1;
+        }
+        strcpy(t->path, path);
+        sprintf(t->temporary, "%s.tmp", path);
+    }
+
+    // the reporter sleeps on the monotonic clock the counters are timed by
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_mutex_init(&t->lock, NULL);
+    pthread_cond_init(&t->wake, &attributes);
+    pthread_condattr_destroy(&attributes);
+
+    t->start = telemetry_clock();
+    t->last.time = t->start;
+    if(pthread_create(&t->reporter, NULL, reporter_main, t)){
+        pthread_cond_destroy(&t->wake);
+        pthread_mutex_destroy(&t->lock);
+        free(t->path);
+        free(t->temporary);
+        free(t);
+        return -1;
+    }
+    *telemetry = t;
+    return 0;
+}
+
+void telemetry_stop(Telemetry *telemetry){
+    if(!telemetry){
+        return;
+    }
+    pthread_mutex_lock(&telemetry->lock);
+    telemetry->stopping = 1;
+    pthread_cond_signal(&telemetry->wake);
+    pthread_mutex_unlock(&telemetry->lock);
+    pthread_join(telemetry->reporter, NULL);
+
+    pthread_cond_destroy(&telemetry->wake);
+    pthread_mutex_destroy(&telemetry->lock);
+    free(telemetry->path);
+    free(telemetry->temporary);
+    free(telemetry);
+}
@@ -0,0 +1,171 @@
+/*======================================================================
+ *                              telemetry.h
+ *======================================================================
+ * Live counters of a running simulation and their reporter thread.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Live counters of a running simulation and their reporter thread.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+/**
+ * Largest number of threads which may hold telemetry counters.
+ */
+#define TELEMETRY_MAX_COUNTERS 8
+
+/**
+ * One election in this many has its phases timed; the clock is too
+ * slow to read around every election.
+ */
+#define TELEMETRY_SAMPLE_PERIOD 64
+
+/**
+ * Fewest seconds between reports; a shorter interval would keep the
+ * reporter thread busy summing counters rather than sleeping.
+ */
+#define TELEMETRY_MIN_INTERVAL 0.01
+
+/**
+ * Adds to a counter of the calling thread. Only the thread holding the
+ * counters writes them, so a relaxed load and store suffice and no
+ * locked instruction is issued; the reporter reads them concurrently.
+ */
+#define TELEMETRY_ADD(counter, amount) \
+    __atomic_store_n(&(counter), __atomic_load_n(&(counter), __ATOMIC_RELAXED) + (amount), \
+                     __ATOMIC_RELAXED)
+
+/**
+ * Phases of an election.
+ */
+typedef enum{
+    TELEMETRY_ALLOCATE, /**< allocating the votes */
+    TELEMETRY_DECIDE, /**< deciding the winners */
+    TELEMETRY_RECORD, /**< recording and handing on the result */
+    TELEMETRY_PHASES /**< number of phases */
+} TelemetryPhase;
+
+/**
+ * Counters of one thread; the sets of different threads are kept on
+ * separate cache lines.
+ */
+typedef struct{
+    unsigned long elections; /**< elections decided */
+    unsigned long candidates; /**< candidates of those elections */
+    unsigned long records; /**< election records written out */
+    unsigned long record_bytes; /**< bytes of those records */
+    unsigned long timed; /**< elections whose phases were timed */
+    unsigned long phase_ns[TELEMETRY_PHASES]; /**< nanoseconds spent in
+                                                   each phase of the
+                                                   timed elections */
+} TelemetryCounters;
+
+/**
+ * Format of the telemetry snapshot.
+ */
+typedef enum{
+    TELEMETRY_PROMETHEUS, /**< Prometheus text exposition format */
+    TELEMETRY_JSON /**< one JSON object */
+} TelemetryFormat;
+
+/**
+ * Opaque telemetry of a run.
+ */
+typedef struct Telemetry Telemetry;
+
+/**
+ * Starts the reporter thread of a run.
+ *
+ * Every interval the reporter sums the counters of every thread; it
+ * replaces the snapshot file, if any, by renaming a new one over it, and
+ * rewrites a progress line on stderr if asked to.
+ *
+ * @param path path of the snapshot file, or NULL
+ * @param format format of the snapshot file
+ * @param progress whether to write a progress line to stderr
+ * @param interval seconds between reports; raised to
+ *                 TELEMETRY_MIN_INTERVAL if less
+ * @param num_elections elections the run will decide, or 0 if unknown
+ * @param telemetry pointer to the variable to hold the telemetry
+ *
+ * @return 0 on success, -1 on failure
+ */
+int telemetry_start(const char *path,
+                    TelemetryFormat format,
+                    unsigned progress,
+                    double interval,
+                    unsigned long num_elections,
+                    Telemetry **telemetry);
+
+/**
+ * Hands the calling thread a set of zeroed counters.
+ *
+ * @param telemetry pointer to the telemetry, or NULL
+ *
+ * @return pointer to the counters, or NULL if telemetry is NULL or all
+ *         TELEMETRY_MAX_COUNTERS sets are taken
+ */
+TelemetryCounters *telemetry_counters(Telemetry *telemetry);
+
+/**
+ * Returns the time of a monotonic clock in nanoseconds.
+ *
+ * @return nanoseconds since an arbitrary epoch
+ */
+uint64_t telemetry_clock(void);
+
+/**
+ * Writes a last report, then stops the reporter thread and releases the
+ * telemetry. The threads holding counters must be done with them.
+ *
+ * @param telemetry pointer to the telemetry, or NULL
+ */
+void telemetry_stop(Telemetry *telemetry);
+
+#endif
@@ -0,0 +1,205 @@
+/*======================================================================
+ *                              threshold.c
+ *======================================================================
+ * Threshold approval elections swept over every approval radius.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Threshold approval elections swept over every approval radius.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "election.h"
+#include "hamming_table.h"
+#include "threshold.h"
+
+int threshold_init(unsigned num_issues, ThresholdEngine *engine){
+    memset(engine, 0, sizeof(*engine));
+    engine->num_issues = num_issues;
+    engine->pool_size = (size_t)1 << num_issues;
+    // clearing the layers, then one addition per platform for each
+    // layer reachable after each issue
+    engine->transform_cost = engine->pool_size *
+                             ((num_issues + 1) + num_issues*(num_issues + 1)/2);
+    engine->layers = malloc(sizeof(*engine->layers) * engine->pool_size * (num_issues + 1));
+    if(!engine->layers){
+        return -1;
+    }
+    return 0;
+}
+
+void threshold_free(ThresholdEngine *engine){
+    free(engine->layers);
+    memset(engine, 0, sizeof(*engine));
+}
+
+/*
+ * Takes a candidate's approvals at every radius, given the votes at each
+ * distance from it, as a winner of each radius it leads or ties; the
+ * winners of radius r are listed from ids + r*num_candidates.
+ */
+static void offer_candidate(unsigned num_issues,
+                            size_t num_candidates,
+                            const Candidate *candidate,
+                            const unsigned *spheres,
+                            ThresholdWinner *winners,
+                            size_t *ids){
+    unsigned r, approvals = 0;
+    for(r = 0; r <= num_issues; r++){
+        approvals += spheres[r];
+        if(approvals > winners[r].approvals){
+            winners[r].approvals = approvals;
+            winners[r].num_winners = 0;
+        }
+        // candidates are offered by increasing index
+        if(approvals == winners[r].approvals){
+            ids[r*num_candidates + winners[r].num_winners++] = candidate->id;
+        }
+    }
+}
+
+/*
+ * Sums the votes of the platforms at each distance from every platform.
+ * After issue j, layer k holds the votes of the platforms which differ
+ * in k of the first j+1 issues and agree on the rest; adding issue j
+ * moves the votes of layer k-1 across it into layer k.
+ */
+static void transform_spheres(size_t num_groups, const Candidate *groups, ThresholdEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    const size_t pool_size = engine->pool_size;
+    unsigned *layers = engine->layers;
+    memset(layers, 0, sizeof(*layers) * pool_size * (num_issues + 1));
+    size_t g;
+    for(g = 0; g < num_groups; g++){
+        layers[groups[g].id] = groups[g].votes;
+    }
+
+    unsigned j, k;
+    for(j = 0; j < num_issues; j++){
+        const size_t bit = (size_t)1 << j;
+        // descending, so layer k-1 still holds the previous issue
+        for(k = j + 1; k > 0; k--){
+            unsigned *layer = layers + k*pool_size;
+            const unsigned *below = layer - pool_size;
+            size_t base, x;
+            for(base = 0; base < pool_size; base += 2*bit){
+                for(x = base; x < base + bit; x++){
+                    layer[x] += below[x | bit];
+                    layer[x | bit] += below[x];
+                }
+            }
+        }
+    }
+}
+
+void decide_threshold_election(size_t num_groups,
+                               size_t num_candidates,
+                               const Candidate *groups,
+                               const Candidate *candidates,
+                               ThresholdWinner *winners,
+                               size_t *ids,
+                               ThresholdEngine *engine){
+    const unsigned num_issues = engine->num_issues;
+    unsigned r;
+    for(r = 0; r <= num_issues; r++){
+        winners[r].approvals = 0;
+        winners[r].num_winners = 0;
+    }
+
+    unsigned spheres[16];
+    size_t c, g;
+    if((unsigned long long)num_groups * num_candidates <= engine->transform_cost){
+        // histogram the distance of every group from each candidate
+        for(c = 0; c < num_candidates; c++){
+            memset(spheres, 0, sizeof(spheres));
+            for(g = 0; g < num_groups; g++){
+                spheres[HAMMING[groups[g].id ^ candidates[c].id]] += groups[g].votes;
+            }
+            offer_candidate(num_issues, num_candidates, candidates + c, spheres, winners, ids);
+        }
+    }else{
+        transform_spheres(num_groups, groups, engine);
+        for(c = 0; c < num_candidates; c++){
+            for(r = 0; r <= num_issues; r++){
+                spheres[r] = engine->layers[r*engine->pool_size + candidates[c].id];
+            }
+            offer_candidate(num_issues, num_candidates, candidates + c, spheres, winners, ids);
+        }
+    }
+
+    // pack the winners of each radius after those of the radius before
+    size_t offset = 0;
+    for(r = 0; r <= num_issues; r++){
+        memmove(ids + offset, ids + r*num_candidates, sizeof(*ids) * winners[r].num_winners);
+        offset += winners[r].num_winners;
+    }
+}
+
+size_t threshold_num_ids(unsigned num_issues, const ThresholdWinner *winners){
+    size_t num_ids = 0;
+    unsigned r;
+    for(r = 0; r <= num_issues; r++){
+        num_ids += winners[r].num_winners;
+    }
+    return num_ids;
+}
+
+void print_threshold_winners(unsigned num_issues,
+                             const ThresholdWinner *winners,
+                             const size_t *ids,
+                             FILE *stream){
+    unsigned r;
+    for(r = 0; r <= num_issues; r++){
+        size_t w;
+        fprintf(stream, "  r=%u) ", r);
+        for(w = 0; w < winners[r].num_winners; w++){
+            fprintf(stream, w ? " %zu" : "%zu", *ids++);
+        }
+        fprintf(stream, " approved by %u%s\n", winners[r].approvals,
+                (winners[r].num_winners > 1) ? " each" : "");
+    }
+}
@@ -0,0 +1,158 @@
+/*======================================================================
+ *                              threshold.h
+ *======================================================================
+ * Threshold approval elections swept over every approval radius.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Threshold approval elections swept over every approval radius.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef THRESHOLD_H
+#define THRESHOLD_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "election.h"
+
+/**
+ * Winners of a threshold approval election at one radius: every
+ * candidate with the most approvals.
+ */
+typedef struct{
+    unsigned approvals; /**< votes approving each winner */
+    size_t num_winners; /**< number of winners, more than 1 on a tie */
+} ThresholdWinner;
+
+/**
+ * Buffers of the threshold approval engine, sized for a pool of
+ * candidates.
+ *
+ * Every voter approves each candidate within a radius of its platform.
+ * The approvals of a candidate at radius r are the votes in the ball of
+ * radius r around it, the sum of the spheres of radius 0 to r. Small
+ * elections histogram the distance of every group from every candidate;
+ * larger ones compute the spheres around every platform at once with a
+ * transform over the issues, one layer per distance.
+ */
+typedef struct{
+    unsigned num_issues; /**< number of issues in the election */
+    size_t pool_size; /**< number of possible candidates */
+    size_t transform_cost; /**< additions made by the transform */
+    unsigned *layers; /**< votes at each distance from every platform,
+                           num_issues+1 layers of pool_size */
+} ThresholdEngine;
+
+/**
+ * Initializes a ThresholdEngine structure.
+ *
+ * @param num_issues number of issues in the election; at most 15
+ * @param engine pointer to the engine
+ *
+ * @return 0 on success, -1 if memory could not be allocated
+ */
+int threshold_init(unsigned num_issues, ThresholdEngine *engine);
+
+/**
+ * Releases the memory held by a ThresholdEngine structure.
+ *
+ * @param engine pointer to the engine
+ */
+void threshold_free(ThresholdEngine *engine);
+
+/**
+ * Decides a threshold approval election at every radius from 0 to the
+ * number of issues.
+ *
+ * Each voter group approves every candidate within the radius of its
+ * platform; the winners at a radius are the candidates with the most
+ * approvals, every one of them on a tie.
+ *
+ * @param num_groups number of voter groups
+ * @param num_candidates number of candidates; at least 1
+ * @param groups array of voter groups, with distinct platforms
+ * @param candidates array of candidates, with distinct platforms; may
+ *                   be groups itself
+ * @param winners array to hold the winners at each radius, num_issues+1
+ *                long
+ * @param ids array to hold the ids of the winners of every radius in
+ *            turn, each radius in increasing order of index;
+ *            (num_issues+1)*num_candidates long
+ * @param engine pointer to the engine
+ */
+void decide_threshold_election(size_t num_groups,
+                               size_t num_candidates,
+                               const Candidate *groups,
+                               const Candidate *candidates,
+                               ThresholdWinner *winners,
+                               size_t *ids,
+                               ThresholdEngine *engine);
+
+/**
+ * Returns the number of winner ids of a threshold approval election,
+ * over every radius.
+ *
+ * @param num_issues number of issues in the election
+ * @param winners array of the num_issues+1 winners
+ *
+ * @return sum of the winners at every radius
+ */
+size_t threshold_num_ids(unsigned num_issues, const ThresholdWinner *winners);
+
+/**
+ * Prints the winners of a threshold approval election at every radius.
+ *
+ * @param num_issues number of issues in the election
+ * @param winners array of the num_issues+1 winners
+ * @param ids array of the ids of the winners of every radius in turn
+ * @param stream pointer to output stream
+ */
+void print_threshold_winners(unsigned num_issues,
+                             const ThresholdWinner *winners,
+                             const size_t *ids,
+                             FILE *stream);
+
+#endif
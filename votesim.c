@@ -52,320 +52,1136 @@
  */
 #include <ctype.h>
 #include <errno.h>
-#include <math.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#include "bit_functions.h"
+#include "ballots.h"
+#include "batch.h"
+#include "cache.h"
+#include "capture.h"
+#include "checkpoint.h"
 #include "confuzz.h"
+#include "districts.h"
 #include "election.h"
+#include "exact.h"
+#include "noise.h"
+#include "pipeline.h"
+#include "sampling.h"
+#include "search.h"
+#include "server.h"
+#include "simulation.h"
+#include "slate.h"
+#include "summary.h"
+#include "telemetry.h"
+#include "workers.h"
 
 /**
- * Compares Candidate structures by greatest number of votes; for use in
- * the standard C library qsort function.
- *
- * @param a Candidate structure for comparison
- * @param b Candidate structure for comparison
+ * Command-line options of the main program.
+ */
+typedef struct{
+    SamplingScheme scheme; /**< sampling scheme for vote allocations */
+    size_t num_strata; /**< number of strata for SAMPLING_STRATIFIED */
+    unsigned num_replicates; /**< number of replicates for
+                                  SAMPLING_SOBOL */
+    unsigned exact; /**< enumerate elections exactly instead of
+                         sampling them */
+    double exact_budget; /**< largest state space the exact
+                              enumeration may walk */
+    Backpressure backpressure; /**< behaviour when the writer falls
+                                    behind */
+    size_t ring_size; /**< size in bytes of the output ring */
+    unsigned long seed; /**< seed of the pseudo-random number
+                             generator */
+    unsigned seeded; /**< seed was given on the command line */
+    const char *socket_path; /**< serve requests on this socket
+                                  instead of prompting */
+    unsigned num_workers; /**< number of worker threads of the
+                               daemon */
+    unsigned methods; /**< set of election methods to decide */
+    size_t num_slate; /**< number of declared candidates */
+    size_t *slate; /**< ids of the declared candidates, or NULL */
+    unsigned capture; /**< only write the elections selected by the
+                           predicates and the reservoir */
+    size_t num_predicates; /**< number of capture predicates */
+    CapturePredicate *predicates; /**< capture predicates, or NULL */
+    size_t reservoir_size; /**< number of unmatched elections to
+                                sample */
+    unsigned num_threads; /**< threads splitting each election */
+    size_t batch_size; /**< elections whose statistics are computed
+                            together */
+    unsigned irv_rounds; /**< print the instant-runoff rounds */
+    unsigned threshold; /**< decide threshold approval at every radius */
+    size_t num_seats; /**< seats of the committees, or 0 */
+    unsigned minimax; /**< search the minimax platform */
+    double minimax_budget; /**< seconds each minimax search may take */
+    unsigned margins; /**< compute the margins of victory */
+    double approximate; /**< confidence of the approximate approval
+                             winners, or 0 */
+    unsigned search; /**< search the platforms winning most often
+                          instead of printing the elections */
+    Method search_method; /**< method of the platform search */
+    unsigned search_restarts; /**< chains of the platform search */
+    unsigned long search_steps; /**< proposals of each chain */
+    const char *telemetry_path; /**< telemetry snapshot file, or NULL */
+    TelemetryFormat telemetry_format; /**< format of the snapshot */
+    double telemetry_interval; /**< seconds between telemetry reports */
+    unsigned progress; /**< write a progress line to stderr */
+    const char *ballots_path; /**< ballot file tallied instead of
+                                   drawing the votes, or NULL */
+    unsigned bootstrap; /**< resample the ballots for every election */
+    double abstention; /**< probability that a voter abstains */
+    size_t num_errors; /**< number of error probabilities */
+    double errors[KERNEL_MAX_ISSUES]; /**< probability that a voter
+                                           votes at distance d+1 */
+    unsigned num_districts; /**< districts deciding each election, or 0 */
+    const char *checkpoint_path; /**< checkpoint file, or NULL */
+    double checkpoint_interval; /**< seconds between checkpoints */
+    const char *resume_path; /**< checkpoint to resume, or NULL */
+    const char *cache_path; /**< directory of the result cache, or
+                                 NULL */
+} Options;
+
+/**
+ * Destination of the elections written under --capture or --reservoir.
+ */
+typedef struct{
+    Capture capture; /**< selection of the elections */
+    Pipeline *pipeline; /**< pipeline of the selected elections */
+} Selection;
+
+/**
+ * Prints the command-line usage of the main program to stderr.
  *
- * @return the relative sorting of the two Candidate structures
+ * @param program name of the program
+ */
+void print_usage(const char *program){
+    fprintf(stderr, "Usage: %s [OPTION]...\n"
+                    "\n"
+                    "  --sampling=SCHEME   plain, antithetic, stratified, or sobol\n"
+                    "                      (default: plain)\n"
+                    "  --strata=N          strata over the number of actual candidates\n"
+                    "                      for stratified sampling (default: 16)\n"
+                    "  --replicates=N      scrambled replicates for sobol sampling\n"
+                    "                      (default: 8)\n"
+                    "  --methods=LIST      comma-separated methods to decide: traditional,\n"
+                    "                      approval, hitler, two_party, washington, irv\n"
+                    "                      (default: all but irv; the screen reports all\n"
+                    "                      but irv, and irv when listed)\n"
+                    "  --irv-rounds        print the tally of every instant-runoff round\n"
+                    "                      with the election statistics\n"
+                    "  --threshold         also decide a threshold approval election at\n"
+                    "                      every radius (voters approve every candidate\n"
+                    "                      within that distance)\n"
+                    "  --committee=K       also choose committees of K seats: greedy\n"
+                    "                      Chamberlin-Courant (closest member) and\n"
+                    "                      sequential proportional approval\n"
+                    "  --minimax           also search the platform whose largest distance\n"
+                    "                      to a voter group is least, by branch and bound\n"
+                    "  --minimax-budget=SECONDS\n"
+                    "                      seconds each search may take before reporting\n"
+                    "                      its gap; 0 for none (default: 0.1)\n"
+                    "  --margins           also report the fewest voters whose move to\n"
+                    "                      another candidate changes each winner\n"
+                    "  --approximate[=CONFIDENCE]\n"
+                    "                      certify the approval winners from a sample of\n"
+                    "                      the voters with this confidence, without the\n"
+                    "                      hitler method or the verbose statistics\n"
+                    "                      (default: 0.99)\n"
+                    "  --slate=ID,ID,...   declared candidates; every voter votes for the\n"
+                    "                      nearest one (default: every platform stands)\n"
+                    "  --capture=LIST      only write elections matching any predicate:\n"
+                    "                      A=B (winners agree), A!=B (winners differ),\n"
+                    "                      or A<B (A's winner is less approved than B's)\n"
+                    "  --reservoir=N       also write a uniform sample of N unmatched\n"
+                    "                      elections after the matched ones (default: 0)\n"
+                    "  --threads=N         threads splitting the candidates of each\n"
+                    "                      election (default: 1)\n"
+                    "  --batch=N           compute the statistics of N elections at once\n"
+                    "                      as distance-matrix products; only for up to\n"
+                    "                      6 issues without a slate (default: 1)\n"
+                    "  --telemetry=PATH    keep a snapshot of the progress of the run in\n"
+                    "                      PATH, replaced every interval\n"
+                    "  --telemetry-format=FORMAT\n"
+                    "                      prometheus or json (default: prometheus)\n"
+                    "  --telemetry-interval=SECONDS\n"
+                    "                      seconds between reports, at least 0.01\n"
+                    "                      (default: 1)\n"
+                    "  --progress          rewrite a progress line on stderr every interval\n",
+                    program);
+    fprintf(stderr, "  --ballots=PATH      tally the ballots of a binary or CSV file instead\n"
+                    "                      of drawing the votes; the issues and population\n"
+                    "                      are those of the file, and a single election is\n"
+                    "                      run unless bootstrapping\n"
+                    "  --bootstrap         resample the ballots with replacement for every\n"
+                    "                      election\n"
+                    "  --abstention=P      probability that a voter abstains (default: 0)\n"
+                    "  --errors=P,P,...    probability that a voter votes for a platform\n"
+                    "                      at distance 1, 2, ... from their own instead\n"
+                    "                      (default: none)\n"
+                    "  --districts=N       decide every election in N districts of the\n"
+                    "                      population each, spread over the threads, and\n"
+                    "                      report the platforms winning the most districts\n"
+                    "                      next to the nationwide winners (default: 0)\n"
+                    "  --search=METHOD     search the platforms winning approval,\n"
+                    "                      traditional, or washington most often by\n"
+                    "                      simulated annealing against the elections, and\n"
+                    "                      report their rates over as many fresh elections\n"
+                    "  --search-restarts=N chains of the search, split between the threads\n"
+                    "                      (default: 16)\n"
+                    "  --search-steps=N    issue flips proposed by each chain\n"
+                    "                      (default: 2000)\n"
+                    "  --exact             compute exact probabilities by enumerating\n"
+                    "                      every vote allocation (small elections)\n"
+                    "  --exact-budget=N    largest state space --exact may walk\n"
+                    "                      (default: 1e8)\n"
+                    "  --backpressure=MODE block (wait for the writer) or drop (drop the\n"
+                    "                      per-candidate detail) when output falls behind\n"
+                    "                      (default: block)\n"
+                    "  --ring-size=BYTES   size of the output ring (default: 8388608)\n"
+                    "  --checkpoint=PATH   keep the progress of the run in PATH, replaced\n"
+                    "                      every interval and removed once it completes\n"
+                    "  --checkpoint-interval=SECONDS\n"
+                    "                      seconds between checkpoints (default: 60)\n"
+                    "  --resume=PATH       continue the run checkpointed in PATH, with\n"
+                    "                      its options and answers; takes no other option\n"
+                    "  --cache=DIR         take the summary and data file of an identical\n"
+                    "                      earlier run kept in DIR, or keep this run there;\n"
+                    "                      runs printing their elections are not cached;\n"
+                    "                      needs --seed\n"
+                    "  --seed=N            seed of the pseudo-random number generator\n"
+                    "                      (default: derived from the system time)\n"
+                    "  --daemon=SOCKET     serve simulation requests on a Unix domain\n"
+                    "                      socket instead of prompting\n"
+                    "  --workers=N         worker threads of the daemon (default: 4)\n"
+                    "  --help              display this help and exit\n");
+}
+
+/**
+ * Parses the command-line arguments of the main program.
  *
- * @retval -1 a comes before b
- * @retval 0 a and b match in ranking
- * @retval 1 a comes after b
+ * @param argc number of arguments
+ * @param argv array of arguments
+ * @param options pointer to the options
  *
- * @sa qsort
+ * @return 0 on success, -1 if an argument is invalid
  */
-int sort_candidates(const void *a, const void *b){
-    if(((Candidate*)a)->votes > ((Candidate*)b)->votes){
+int parse_arguments(int argc, char **argv, Options *options){
+    options->scheme = SAMPLING_PLAIN;
+    options->num_strata = 16;
+    options->num_replicates = 8;
+    options->exact = 0;
+    options->exact_budget = 1e8;
+    options->backpressure = BACKPRESSURE_BLOCK;
+    options->ring_size = PIPELINE_RING_SIZE;
+    options->seed = 0;
+    options->seeded = 0;
+    options->socket_path = NULL;
+    options->num_workers = 4;
+    options->methods = DEFAULT_METHODS;
+    options->num_slate = 0;
+    options->slate = NULL;
+    options->capture = 0;
+    options->num_predicates = 0;
+    options->predicates = NULL;
+    options->reservoir_size = 0;
+    options->num_threads = 1;
+    options->batch_size = 1;
+    options->irv_rounds = 0;
+    options->threshold = 0;
+    options->num_seats = 0;
+    options->minimax = 0;
+    options->minimax_budget = 0.1;
+    options->margins = 0;
+    options->approximate = 0;
+    options->search = 0;
+    options->search_method = METHOD_APPROVAL;
+    options->search_restarts = 16;
+    options->search_steps = 2000;
+    options->telemetry_path = NULL;
+    options->telemetry_format = TELEMETRY_PROMETHEUS;
+    options->telemetry_interval = 1;
+    options->progress = 0;
+    options->ballots_path = NULL;
+    options->bootstrap = 0;
+    options->abstention = 0;
+    options->num_errors = 0;
+    options->num_districts = 0;
+    options->checkpoint_path = NULL;
+    options->checkpoint_interval = 60;
+    options->resume_path = NULL;
+    options->cache_path = NULL;
+
+    int i;
+    for(i = 1; i < argc; i++){
+        char *value = strchr(argv[i], '=');
+        char *check;
+        size_t length = value ? (size_t)(value++ - argv[i]) : strlen(argv[i]);
+
+        if(!strncmp(argv[i], "--sampling", length) && length == 10 && value){
+            if(parse_sampling_scheme(value, &options->scheme)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--strata", length) && length == 8 && value){
+            options->num_strata = strtoul(value, &check, 0);
+            if(*check || !options->num_strata){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--replicates", length) && length == 12 && value){
+            options->num_replicates = strtoul(value, &check, 0);
+            if(*check || !options->num_replicates){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--methods", length) && length == 9 && value){
+            if(parse_methods(value, &options->methods)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--slate", length) && length == 7 && value){
+            free(options->slate);
+            if(parse_slate(value, &options->num_slate, &options->slate)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--capture", length) && length == 9 && value){
+            free(options->predicates);
+            if(parse_capture(value, &options->num_predicates, &options->predicates)){
+                return -1;
+            }
+            options->capture = 1;
+        }else if(!strncmp(argv[i], "--reservoir", length) && length == 11 && value){
+            options->reservoir_size = strtoul(value, &check, 0);
+            if(*check || !*value){
+                return -1;
+            }
+            options->capture = 1;
+        }else if(!strncmp(argv[i], "--threads", length) && length == 9 && value){
+            options->num_threads = strtoul(value, &check, 0);
+            if(*check || !options->num_threads || options->num_threads > WORKER_MAX_THREADS){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--batch", length) && length == 7 && value){
+            options->batch_size = strtoul(value, &check, 0);
+            if(*check || !options->batch_size || options->batch_size > BATCH_MAX_SIZE){
+                return -1;
+            }
+        }else if(!strcmp(argv[i], "--irv-rounds")){
+            options->irv_rounds = 1;
+        }else if(!strcmp(argv[i], "--threshold")){
+            options->threshold = 1;
+        }else if(!strncmp(argv[i], "--committee", length) && length == 11 && value){
+            options->num_seats = strtoul(value, &check, 0);
+            if(*check || !options->num_seats){
+                return -1;
+            }
+        }else if(!strcmp(argv[i], "--margins")){
+            options->margins = 1;
+        }else if(!strncmp(argv[i], "--approximate", length) && length == 13){
+            options->approximate = value ? strtod(value, &check) : 0.99;
+            if((value && (*check || !*value)) ||
+               !(options->approximate > 0 && options->approximate < 1)){
+                return -1;
+            }
+        }else if(!strcmp(argv[i], "--minimax")){
+            options->minimax = 1;
+        }else if(!strncmp(argv[i], "--minimax-budget", length) && length == 16 && value){
+            options->minimax_budget = strtod(value, &check);
+            if(*check || !*value || !(options->minimax_budget >= 0)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--telemetry", length) && length == 11 && value && *value){
+            options->telemetry_path = value;
+        }else if(!strncmp(argv[i], "--telemetry-format", length) && length == 18 && value){
+            if(!strcmp(value, "prometheus")){
+                options->telemetry_format = TELEMETRY_PROMETHEUS;
+            }else if(!strcmp(value, "json")){
+                options->telemetry_format = TELEMETRY_JSON;
+            }else{
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--telemetry-interval", length) && length == 20 && value){
+            options->telemetry_interval = strtod(value, &check);
+            if(*check || !(options->telemetry_interval >= TELEMETRY_MIN_INTERVAL)){
+                return -1;
+            }
+        }else if(!strcmp(argv[i], "--progress")){
+            options->progress = 1;
+        }else if(!strncmp(argv[i], "--ballots", length) && length == 9 && value && *value){
+            options->ballots_path = value;
+        }else if(!strcmp(argv[i], "--bootstrap")){
+            options->bootstrap = 1;
+        }else if(!strncmp(argv[i], "--abstention", length) && length == 12 && value){
+            options->abstention = strtod(value, &check);
+            if(*check || !*value || !(options->abstention >= 0 && options->abstention < 1)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--errors", length) && length == 8 && value){
+            if(parse_errors(value, &options->num_errors, options->errors)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--districts", length) && length == 11 && value){
+            unsigned long num_districts = strtoul(value, &check, 0);
+            if(*check || !*value || num_districts > DISTRICTS_MAX_VOTERS){
+                return -1;
+            }
+            options->num_districts = num_districts;
+        }else if(!strncmp(argv[i], "--checkpoint", length) && length == 12 && value && *value){
+            options->checkpoint_path = value;
+        }else if(!strncmp(argv[i], "--checkpoint-interval", length) && length == 21 && value){
+            options->checkpoint_interval = strtod(value, &check);
+            if(*check || !(options->checkpoint_interval > 0)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--resume", length) && length == 8 && value && *value){
+            options->resume_path = value;
+        }else if(!strncmp(argv[i], "--search", length) && length == 8 && value){
+            unsigned methods;
+            if(parse_methods(value, &methods) || (methods & (methods - 1))){
+                return -1;
+            }
+            unsigned m = 0;
+            while(!((methods >> m) & 0x1)){
+                m++;
+            }
+            options->search = 1;
+            options->search_method = m;
+            if(!search_method_supported(m)){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--search-restarts", length) && length == 17 && value){
+            options->search_restarts = strtoul(value, &check, 0);
+            if(*check || !options->search_restarts){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--search-steps", length) && length == 14 && value){
+            options->search_steps = strtoul(value, &check, 0);
+            if(*check){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--cache", length) && length == 7 && value && *value){
+            options->cache_path = value;
+        }else if(!strcmp(argv[i], "--exact")){
+            options->exact = 1;
+        }else if(!strncmp(argv[i], "--exact-budget", length) && length == 14 && value){
+            options->exact_budget = strtod(value, &check);
+            if(*check || options->exact_budget <= 0){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--backpressure", length) && length == 14 && value){
+            if(!strcmp(value, "block")){
+                options->backpressure = BACKPRESSURE_BLOCK;
+            }else if(!strcmp(value, "drop")){
+                options->backpressure = BACKPRESSURE_DROP;
+            }else{
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--ring-size", length) && length == 11 && value){
+            options->ring_size = strtoul(value, &check, 0);
+            if(*check || !options->ring_size){
+                return -1;
+            }
+        }else if(!strncmp(argv[i], "--seed", length) && length == 6 && value){
+            options->seed = strtoul(value, &check, 0);
+            if(*check || !*value){
+                return -1;
+            }
+            options->seeded = 1;
+        }else if(!strncmp(argv[i], "--daemon", length) && length == 8 && value && *value){
+            options->socket_path = value;
+        }else if(!strncmp(argv[i], "--workers", length) && length == 9 && value){
+            options->num_workers = strtoul(value, &check, 0);
+            if(*check || !options->num_workers){
+                return -1;
+            }
+        }else{
+            return -1;
+        }
+    }
+    // a resumed run takes its options from the checkpoint
+    if(options->resume_path && argc != 2){
+        return -1;
+    }
+    // exact enumeration only covers every platform standing, and runs
+    // no individual elections to capture, sweep, or checkpoint
+    if(options->exact && (options->slate || options->capture || options->threshold ||
+                          options->num_seats || options->minimax || options->margins ||
+                          options->approximate || options->checkpoint_path ||
+                          options->cache_path)){
+        return -1;
+    }
+    // the margins move voters between the candidates they vote for
+    if(options->margins && options->slate){
+        return -1;
+    }
+    // the approximate winners are approval's alone, and save nothing
+    // once the hitler method compares every pair of candidates
+    if(options->approximate &&
+       (!(options->methods & (1U << METHOD_APPROVAL)) ||
+        (options->methods & (1U << METHOD_HITLER)) || options->slate || options->margins)){
+        return -1;
+    }
+    // ballots are tallied, neither enumerated nor drawn by a scheme
+    if(options->ballots_path ? options->exact || options->scheme != SAMPLING_PLAIN
+                             : options->bootstrap){
+        return -1;
+    }
+    // noisy voters are simulated, and leave the strata as drawn
+    double total = options->abstention;
+    size_t d;
+    for(d = 0; d < options->num_errors; d++){
+        total += options->errors[d];
+    }
+    if((total > 0 && (options->exact || options->scheme == SAMPLING_STRATIFIED)) ||
+       total > 1 + 1e-9){
+        return -1;
+    }
+    // districts are drawn independently, each a plain election
+    if(options->num_districts &&
+       (options->exact || options->ballots_path || options->scheme != SAMPLING_PLAIN)){
+        return -1;
+    }
+    // the search stands its platforms among every voter group of a
+    // single electorate, and prints no election to select or sweep
+    if(options->search &&
+       (options->exact || options->slate || options->capture || options->num_districts ||
+        options->threshold || options->num_seats || options->minimax || options->margins ||
+        options->checkpoint_path || options->cache_path)){
+        return -1;
+    }
+    // the cache keeps the summary and data file, not what was captured
+    if(options->cache_path && options->capture){
+        return -1;
+    }
+    // a seed from the system time is never repeated, so its run could
+    // never be found in the cache
+    if(options->cache_path && !options->seeded){
         return -1;
-    }else if(((Candidate*)a)->votes < ((Candidate*)b)->votes){
-        return 1;
     }
     return 0;
 }
 
+/**
+ * Hands the result of an election to the writer thread; for use as the
+ * ElectionCallback of simulation_run.
+ *
+ * @param result pointer to the result of the election
+ * @param data pointer to the Pipeline structure
+ */
+void submit_result(const ElectionResult *result, void *data){
+    pipeline_submit(result, data);
+}
+
+/**
+ * Hands the result of an election to the capture, which passes the
+ * selected elections on to the writer thread; for use as the
+ * ElectionCallback of simulation_run.
+ *
+ * @param result pointer to the result of the election
+ * @param data pointer to the Selection structure
+ */
+void select_result(const ElectionResult *result, void *data){
+    Selection *selection = data;
+    // an election the reservoir has no memory for is just not sampled
+    capture_election(result, submit_result, selection->pipeline, &selection->capture);
+}
+
+/**
+ * Runs elections, passing their results through the capture when there
+ * is one, and otherwise to the pipeline when there is output.
+ *
+ * @param num_elections number of elections to run
+ * @param pipeline pointer to the pipeline, or NULL if nothing is output
+ * @param selection pointer to the selection, or NULL without capture
+ * @param simulation pointer to the simulation context
+ */
+void run_elections(unsigned long num_elections,
+                   Pipeline *pipeline,
+                   Selection *selection,
+                   Simulation *simulation){
+    if(selection){
+        simulation_run(num_elections, select_result, selection, simulation);
+    }else{
+        simulation_run(num_elections, pipeline ? submit_result : NULL, pipeline, simulation);
+    }
+}
+
+/**
+ * Records an election in a platform search batch, exiting if it cannot;
+ * for use as the ElectionCallback of simulation_run.
+ *
+ * @param result pointer to the result of the election
+ * @param data pointer to the SearchBatch structure
+ */
+void record_search(const ElectionResult *result, void *data){
+    if(search_batch_add(result, data)){
+        fprintf(stderr, "\n** ERROR: Not enough memory for the search elections\n");
+        exit(1);
+    }
+}
+
+/**
+ * Searches the platforms winning most often against a batch of
+ * elections, validates them against as many fresh elections, and
+ * prints them.
+ *
+ * @param num_elections number of elections of each batch
+ * @param options pointer to the options
+ * @param simulation pointer to the simulation context
+ */
+void run_search(unsigned long num_elections, const Options *options, Simulation *simulation){
+    const SimulationConfig *config = simulation_config(simulation);
+    SearchBatch batch, validation;
+    search_batch_init(config->num_issues, options->search_method, &batch);
+    search_batch_init(config->num_issues, options->search_method, &validation);
+    // the validation elections follow the search elections, independent
+    // of the platforms selected on them
+    simulation_run(num_elections, record_search, &batch, simulation);
+    simulation_run(num_elections, record_search, &validation, simulation);
+
+    // the chains take streams of their own, after the capture's
+    WorkerPool *pool = NULL;
+    size_t num_platforms;
+    SearchPlatform *platforms = malloc(sizeof(*platforms) * options->search_restarts);
+    if(!platforms ||
+       (options->num_threads > 1 && worker_pool_create(options->num_threads, &pool)) ||
+       search_platforms(options->search_restarts, options->search_steps, config->seed,
+                        config->stream + 2, &batch, pool, &num_platforms, platforms)){
+        fprintf(stderr, "\n** ERROR: Not enough memory to search the platforms\n");
+        exit(1);
+    }
+    size_t p;
+    for(p = 0; p < num_platforms && p < SEARCH_MAX_REPORTED; p++){
+        platforms[p].validated = search_wins(platforms[p].id, &validation);
+    }
+    print_search_result(&batch, validation.num_elections, num_platforms, platforms);
+
+    worker_pool_destroy(pool);
+    free(platforms);
+    search_batch_free(&batch);
+    search_batch_free(&validation);
+}
+
+/**
+ * Writes a checkpoint of a run, once the elections submitted so far are
+ * written out.
+ *
+ * @param path path of the checkpoint
+ * @param run pointer to the run; its data length is updated
+ * @param pipeline pointer to the pipeline, or NULL if nothing is output
+ * @param capture pointer to the capture, or NULL
+ * @param simulation pointer to the simulation context
+ *
+ * @return 0 on success, -1 if the checkpoint could not be written
+ */
+int write_checkpoint(const char *path,
+                     CheckpointRun *run,
+                     Pipeline *pipeline,
+                     const Capture *capture,
+                     const Simulation *simulation){
+    FILE *stream;
+    if((pipeline && pipeline_sync(pipeline, &run->data_length)) ||
+       checkpoint_begin(path, run, &stream)){
+        return -1;
+    }
+    return checkpoint_finish(path,
+                             -(simulation_save(simulation, stream) ||
+                               (capture && capture_save(capture, stream))),
+                             stream);
+}
+
+/**
+ * Runs the elections left in a run, writing a checkpoint whenever the
+ * interval has passed since the last one. Elections are run in chunks,
+ * doubled while a chunk is too short to reach the interval, so the
+ * clock is read rarely and batches stay whole.
+ *
+ * @param path path of the checkpoint
+ * @param interval seconds between checkpoints
+ * @param run pointer to the run; its count of elections run is updated
+ * @param pipeline pointer to the pipeline, or NULL if nothing is output
+ * @param selection pointer to the selection, or NULL without capture
+ * @param simulation pointer to the simulation context
+ */
+void run_checkpointed(const char *path,
+                      double interval,
+                      CheckpointRun *run,
+                      Pipeline *pipeline,
+                      Selection *selection,
+                      Simulation *simulation){
+    uint64_t period = interval * 1e9;
+    uint64_t last = telemetry_clock();
+    unsigned long step = simulation_config(simulation)->batch_size;
+    while(run->num_run < run->num_elections){
+        unsigned long num_elections = run->num_elections - run->num_run;
+        if(num_elections > step){
+            num_elections = step;
+        }
+        run_elections(num_elections, pipeline, selection, simulation);
+        run->num_run += num_elections;
+        if(run->num_run == run->num_elections){
+            break;
+        }
+
+        if(telemetry_clock() - last < period){
+            if(step <= ULONG_MAX/2){
+                step *= 2;
+            }
+            continue;
+        }
+        if(write_checkpoint(path, run, pipeline, selection ? &selection->capture : NULL,
+                            simulation)){
+            fprintf(stderr, "\n** WARNING: Unable to write the checkpoint %s\n", path);
+        }
+        last = telemetry_clock();
+    }
+}
+
 /**
  * Standard C main function.
  *
- * @note To print election data to a file, additional code must be added
- *       at line 362 in the votesim.c file.
+ * @note Election data files hold one comma-separated line per election;
+ *       see write_record in pipeline.c.
  */
-int main(void){
-    srand(time_seed());
+int main(int argc, char **argv){
+    Options options;
+    if(parse_arguments(argc, argv, &options)){
+        print_usage(argv[0]);
+        exit(!(argc == 2 && !strcmp(argv[1], "--help")));
+    }
 
-    // sqrt prevents overflow when calculating disapproval rating of candidates
-    unsigned MAX_POPULATION = sqrt(RAND_MAX);
-    unsigned MAX_ISSUES = hamming_weight(MAX_POPULATION);
-    // Check if RAND_MAX is not a Mersenne prime
-    if((MAX_POPULATION | (MAX_POPULATION>>1)) != MAX_POPULATION){
-        MAX_ISSUES = bit_count(MAX_POPULATION>>1);
+    // a resumed run is configured by the arguments and answers it began
+    // with
+    CheckpointRun run = {0};
+    FILE *saved = NULL;
+    const char *resume_path = options.resume_path;
+    if(resume_path){
+        if(checkpoint_open(resume_path, &run, &saved) ||
+           parse_arguments(run.argc, run.argv, &options) || !options.checkpoint_path){
+            fprintf(stderr, "\n** ERROR: Unable to resume from %s\n", resume_path);
+            exit(1);
+        }
+        printf("Resuming at election %lu of %lu\n", run.num_run + 1, run.num_elections);
+    }else{
+        run.argc = argc;
+        run.argv = argv;
+    }
+    unsigned resumed = (saved != NULL);
+
+    if(options.socket_path){
+        if(server_run(options.socket_path, options.num_workers)){
+            fprintf(stderr, "\n** ERROR: Unable to serve on %s\n", options.socket_path);
+            exit(1);
+        }
+        return 0;
     }
 
+    unsigned MAX_ISSUES, MAX_POPULATION;
+    simulation_limits(&MAX_ISSUES, &MAX_POPULATION);
+
     /****************
      * CONFIGURATION 
      ****************/
     char buffer[256];
     char *check;
     
-    unsigned verbose = 1;
-    printf("Print election statistics to the screen (0 to exit) [Y/n]: ");
-    fgets(buffer, sizeof(buffer), stdin);
-    if(buffer[0] == '0'){
-        exit(0);
-    }else if(buffer[0] == 'N' || buffer[0] == 'n'){
-        verbose = 0;
+    // exact enumeration does not simulate individual elections, and a
+    // search does not print them
+    unsigned verbose = !options.exact && !options.search;
+    if(resumed){
+        verbose = run.verbose;
+    }else if(verbose){
+        printf("Print election statistics to the screen (0 to exit) [Y/n]: ");
+        fgets(buffer, sizeof(buffer), stdin);
+        if(buffer[0] == '0'){
+            exit(0);
+        }else if(buffer[0] == 'N' || buffer[0] == 'n'){
+            verbose = 0;
+        }
     }
     
     FILE *fout = NULL;
-    printf("Print election data to a file (0 to exit) [y/N]: ");
-    fgets(buffer, sizeof(buffer), stdin);
-    if(buffer[0] == '0'){
-        exit(0);
-    }else if(buffer[0] == 'Y' || buffer[0] == 'y'){
-        do{
-            printf("Input filepath (0 to cancel): ");
-            fgets(buffer, sizeof(buffer), stdin);
-            if(buffer[0] == '0' && isspace(buffer[1])){
-                break;
-            }
-            
-            // trim whitespace
-            size_t t;
-            for(t = 0; t < sizeof(buffer); t++){
-                // find end of string
-                if(buffer[t] == 0){
-                    // going to search from end now
-                    t--;
-                    break;
-                }
-            }
+    char data_path[sizeof(buffer)];
+    if(resumed){
+        // the records after the checkpoint are written again
+        if(run.data_path && !(fout = checkpoint_reopen(run.data_path, run.data_length))){
+            fprintf(stderr, "\n** ERROR: Unable to reopen %s at its checkpoint\n", run.data_path);
+            exit(1);
+        }
+    }else if(!options.exact && !options.search){
+        printf("Print election data to a file (0 to exit) [y/N]: ");
+        fgets(buffer, sizeof(buffer), stdin);
+        if(buffer[0] == '0'){
+            exit(0);
+        }else if(buffer[0] == 'Y' || buffer[0] == 'y'){
             do{
-                // find end of filepath
-                if(!isspace(buffer[t])){
-                    // set end of string
-                    buffer[++t] = 0;
+                printf("Input filepath (0 to cancel): ");
+                fgets(buffer, sizeof(buffer), stdin);
+                if(buffer[0] == '0' && isspace(buffer[1])){
                     break;
                 }
-                // go to next character from end
-                t--;
-            }while(t != 0);
             
-            fout = fopen(buffer, "w");
-            if(fout){
-                break;
-            }
-        }while(fprintf(stderr, "***** UNABLE TO CREATE FILE *****\n"
-                               ">>>>> %s\n\n", strerror(errno)));
-    }
-
-    unsigned long num_issues;
-    size_t pool_size = 0;
-    unsigned *stance_poll = NULL;
-    unsigned *hitler_table = NULL;
-    Candidate *candidates = NULL;
-    Candidate **elected = NULL, **elected_h = NULL, **elected_a = NULL;
-    do{
-        printf("Number of issues (0 to exit) [0-%u]: ", MAX_ISSUES);
-        fgets(buffer, sizeof(buffer), stdin);
-        num_issues = strtoul(buffer, &check, 0);
-
-        if(*buffer != *check){
-            if(!num_issues){
-                exit(0);
-            }else if(num_issues <= MAX_ISSUES){
-                pool_size = 1<<num_issues;
-                hitler_table = malloc(sizeof(*hitler_table) * pool_size);
-                stance_poll = malloc(sizeof(*stance_poll) * num_issues);
-                candidates = malloc(sizeof(*candidates) * pool_size);
-                elected = malloc(sizeof(*elected) * pool_size);
-                elected_h = malloc(sizeof(*elected_h) * pool_size);
-                elected_a = malloc(sizeof(*elected_a) * pool_size);
-                // check if all memory was allocated
-                if(hitler_table && stance_poll && candidates &&
-                   elected && elected_h && elected_a){
+                // trim whitespace
+                size_t t;
+                for(t = 0; t < sizeof(buffer); t++){
+                    // find end of string
+                    if(buffer[t] == 0){
+                        // going to search from end now
+                        t--;
+                        break;
+                    }
+                }
+                do{
+                    // find end of filepath
+                    if(!isspace(buffer[t])){
+                        // set end of string
+                        buffer[++t] = 0;
+                        break;
+                    }
+                    // go to next character from end
+                    t--;
+                }while(t != 0);
+            
+                fout = fopen(buffer, "w");
+                if(fout){
+                    strcpy(data_path, buffer);
+                    run.data_path = data_path;
                     break;
-                }else{
-                    // if failed at *elected_a then frees memory allocated,
-                    // else rest are NULL anyway so no worries
-                    free(hitler_table);
-                    free(stance_poll);
-                    free(candidates);
-                    free(elected);
-                    free(elected_h);
-                    fprintf(stderr,"\n** ERROR: Not enough memory to populate election tables\n"
-                                   ">>>>>>>>> Select a smaller number of issues.\n\n");
                 }
-            }
+            }while(fprintf(stderr, "***** UNABLE TO CREATE FILE *****\n"
+                                   ">>>>> %s\n\n", strerror(errno)));
         }
-    }while(fprintf(stderr, "***** INVALID INPUT *****\n\n"));
+    }
 
-    unsigned long population_size;
-    do{
-        printf("Population Size (0 to exit) [0-%u]: ", MAX_POPULATION);
-        fgets(buffer, sizeof(buffer), stdin);
-        population_size = strtoul(buffer, &check, 0);
+    // the capture selects the elections written, so it needs somewhere
+    // to write them
+    if(options.capture && !verbose && !fout){
+        fprintf(stderr, "\n** ERROR: --capture and --reservoir write to the screen or a data file\n"
+                        ">>>>>>>>> Print the election statistics or data to capture elections.\n");
+        exit(1);
+    }
 
-        if(*buffer != *check){
-            if(!population_size){
-                exit(0);
-            }else if(population_size <= MAX_POPULATION){
-                break;
-            }
+    // a ballot file fixes the issues and the population
+    BallotSet ballots = {0};
+    if(options.ballots_path){
+        WorkerPool *loaders = NULL;
+        if((options.num_threads > 1 && worker_pool_create(options.num_threads, &loaders)) ||
+           ballots_load(options.ballots_path, loaders, &ballots)){
+            fprintf(stderr, "\n** ERROR: Unable to load ballots from %s\n", options.ballots_path);
+            exit(1);
+        }
+        worker_pool_destroy(loaders);
+        if(ballots.num_issues > MAX_ISSUES){
+            fprintf(stderr, "\n** ERROR: Ballots of %u issues exceed the limit of %u\n",
+                    ballots.num_issues, MAX_ISSUES);
+            exit(1);
         }
-    }while(fprintf(stderr, "***** INVALID INPUT *****\n\n"));
+        printf("Loaded %u ballots on %u issues (%zu platforms)\n",
+               ballots.num_voters, ballots.num_issues, ballots.num_platforms);
+    }
 
-    unsigned long num_elections, MAX_ELECTIONS = (-1);
-    do{
-        printf("Number of Elections (0 to exit) [0-%lu]: ", MAX_ELECTIONS);
-        fgets(buffer, sizeof(buffer), stdin);
-        num_elections = strtoul(buffer, &check, 0);
+    unsigned long num_issues = resumed ? run.num_issues : ballots.num_issues;
+    if(!options.ballots_path && !resumed){
+        do{
+            printf("Number of issues (0 to exit) [0-%u]: ", MAX_ISSUES);
+            fgets(buffer, sizeof(buffer), stdin);
+            num_issues = strtoul(buffer, &check, 0);
 
-        if(*buffer != *check){
-            if(!num_elections){
-                exit(0);
-            }else if(num_elections <= MAX_ELECTIONS){
-                break;
+            if(*buffer != *check){
+                if(!num_issues){
+                    exit(0);
+                }else if(num_issues <= MAX_ISSUES){
+                    break;
+                }
             }
-        }
-    }while(fprintf(stderr, "***** INVALID INPUT *****\n\n"));
+        }while(fprintf(stderr, "***** INVALID INPUT *****\n\n"));
+    }
 
-    /*************
-     * SIMULATION 
-     *************/
-    unsigned long j;
-    for(j = 0; j < num_elections; j++){
-        size_t i;
-        // initialize candidate pool
-        for(i = 0; i < pool_size; i++){
-            candidates[i].id = i;
+    // declared candidates must be platforms of the chosen issues
+    size_t m;
+    for(m = 0; m < options.num_slate; m++){
+        if(options.slate[m] >> num_issues){
+            fprintf(stderr, "\n** ERROR: Declared candidate %zu is not a platform of %lu issues\n",
+                    options.slate[m], num_issues);
+            exit(1);
         }
+    }
 
-        // perform traditional election
-        size_t num_candidates = 0;
-        perform_election(population_size,
-                         pool_size,
-                         &num_candidates,
-                         candidates);
+    // errors cannot reach farther than the issues
+    if(options.num_errors > num_issues){
+        fprintf(stderr, "\n** ERROR: Errors at %zu distances exceed the %lu issues\n",
+                options.num_errors, num_issues);
+        exit(1);
+    }
 
-        // initialize hitler table
-        for(i = 0; i < num_candidates; i++){
-                hitler_table[candidates[i].id] = 0;
-        }
-        // initialize washington platform
-        for(i = 0; i < num_issues; i++){
-            stance_poll[i] = 0;
-        }
+    unsigned long population_size = resumed ? run.population_size : ballots.num_voters;
+    if(!options.ballots_path && !resumed){
+        do{
+            printf("Population Size (0 to exit) [0-%u]: ", MAX_POPULATION);
+            fgets(buffer, sizeof(buffer), stdin);
+            population_size = strtoul(buffer, &check, 0);
 
-        // compute election statistics
-        compute_election_statistics(num_issues,
-                                    num_candidates,
-                                    stance_poll,
-                                    hitler_table,
-                                    candidates);
-        // sort candidates by lowest disapproval rating
-        qsort(candidates, num_candidates, sizeof(*candidates), sort_candidates);
-        
-        // find election winners
-        size_t num_winners = 1, num_a_winners = 1, num_h_winners = 1;
-        elected[0] = candidates;
-        elected_a[0] = candidates;
-        elected_h[0] = candidates;
-        for(i = 1; i < num_candidates; i++){
-            // traditional election winners
-            if(candidates[i].votes == elected[0]->votes){
-                elected[num_winners++] = candidates+i;
-            }else{
-                break;
-            }
-            // approval winners
-            if(candidates[i].sum_disapproval < elected_a[0]->sum_disapproval){
-                elected_a[0] = candidates+i;
-                num_a_winners = 1;
-            }else if(candidates[i].sum_disapproval == elected_a[0]->sum_disapproval){
-                elected_a[num_a_winners++] = candidates+i;
-            }
-            // hitler election winners
-            if(hitler_table[candidates[i].id] < hitler_table[elected_h[0]->id]){
-                elected_h[0] = candidates+i;
-                num_h_winners = 1;
-            }else if(hitler_table[candidates[i].id] == hitler_table[elected_h[0]->id]){
-                elected_h[num_h_winners++] = candidates+i;
-            }
-        }
-        // continue finding approval winners and hitler election winners
-        for(; i < num_candidates; i++){
-            // approval winners
-            if(candidates[i].sum_disapproval < elected_a[0]->sum_disapproval){
-                elected_a[0] = candidates+i;
-                num_a_winners = 1;
-            }else if(candidates[i].sum_disapproval == elected_a[0]->sum_disapproval){
-                elected_a[num_a_winners++] = candidates+i;
-            }
-            // hitler election winners
-            if(hitler_table[candidates[i].id] < hitler_table[elected_h[0]->id]){
-                elected_h[0] = candidates+i;
-                num_h_winners = 1;
-            }else if(hitler_table[candidates[i].id] == hitler_table[elected_h[0]->id]){
-                elected_h[num_h_winners++] = candidates+i;
+            if(*buffer != *check){
+                if(!population_size){
+                    exit(0);
+                }else if(population_size <= MAX_POPULATION){
+                    break;
+                }
             }
+        }while(fprintf(stderr, "***** INVALID INPUT *****\n\n"));
+    }
+
+    // the ballots must be those the run began with
+    if(resumed && options.ballots_path &&
+       (ballots.num_issues != num_issues || ballots.num_voters != population_size)){
+        fprintf(stderr, "\n** ERROR: Ballots of %s differ from those checkpointed\n",
+                options.ballots_path);
+        exit(1);
+    }
+
+    // the population is that of each district
+    if((uint64_t)options.num_districts * population_size > DISTRICTS_MAX_VOTERS){
+        fprintf(stderr, "\n** ERROR: %u districts of %lu voters exceed %u voters\n",
+                options.num_districts, population_size, DISTRICTS_MAX_VOTERS);
+        exit(1);
+    }
+
+    /********************
+     * EXACT ENUMERATION 
+     ********************/
+    if(options.exact){
+        double states = exact_state_space(population_size, num_issues);
+        if(num_issues > EXACT_MAX_ISSUES || states > options.exact_budget){
+            fprintf(stderr, "\n** ERROR: Exact enumeration would walk about %.3g states\n"
+                            ">>>>>>>>> Select fewer issues or voters, or raise --exact-budget.\n",
+                            states);
+            exit(1);
         }
-        
-        // find washington candidate
-        Candidate washington;
-        washington.id = 0;
-        for(i = 0; i < num_issues; i++){
-            size_t stance_0 = population_size - stance_poll[i];
-            // NOTE: slight bias toward stance=1 when population size is even
-            if(stance_poll[i] >= stance_0){
-                washington.id += 1<<i;
-            }
+
+        ExactResult result;
+        if(exact_election_agreements(population_size, num_issues, &result)){
+            fprintf(stderr,"\n** ERROR: Not enough memory to enumerate elections\n");
+            exit(1);
         }
-        
-        // compute statistics for washington candidate
-        compute_candidate_statistics(num_issues,
-                                     num_candidates,
-                                     &washington,
-                                     candidates);
-
-        // perform two-party system election
-        Candidate status_quo[2] = {candidates[0], candidates[1]};
-        status_quo[0].votes = 0;
-        status_quo[1].votes = 0;
-        // record votes
-        for(i = 0; i < num_candidates; i++){
-            unsigned disapproval_0 = hamming_weight((status_quo[0].id)^(candidates[i].id));
-            unsigned disapproval_1 = hamming_weight((status_quo[1].id)^(candidates[i].id));
-
-            // if disapproval values are equal, then votes aren't counted
-            if(disapproval_0 < disapproval_1){
-                status_quo[0].votes += candidates[i].votes;
-            }else if(disapproval_0 > disapproval_1){
-                status_quo[1].votes += candidates[i].votes;
+        print_exact_result(population_size, num_issues, &result);
+        return 0;
+    }
+
+    // the ballots as loaded make a single election
+    unsigned long num_elections = resumed ? run.num_elections : 1, MAX_ELECTIONS = (-1);
+    if((!options.ballots_path || options.bootstrap) && !resumed){
+        do{
+            printf("Number of Elections (0 to exit) [0-%lu]: ", MAX_ELECTIONS);
+            fgets(buffer, sizeof(buffer), stdin);
+            num_elections = strtoul(buffer, &check, 0);
+
+            if(*buffer != *check){
+                if(!num_elections){
+                    exit(0);
+                }else if(num_elections <= MAX_ELECTIONS){
+                    break;
+                }
             }
+        }while(fprintf(stderr, "***** INVALID INPUT *****\n\n"));
+    }
+
+    SimulationConfig config;
+    simulation_default_config(&config);
+    config.num_issues = num_issues;
+    config.population_size = population_size;
+    config.scheme = options.scheme;
+    config.num_strata = options.num_strata;
+    config.num_replicates = options.num_replicates;
+    config.seed = resumed ? run.seed : options.seeded ? options.seed : time_seed();
+    // only the outputs in use are computed; the screen reports the full
+    // statistics of every method
+    config.methods = verbose ? DEFAULT_METHODS | options.methods :
+                     options.search ? 1U << options.search_method : options.methods;
+    config.candidate_statistics = verbose;
+    config.num_slate = options.num_slate;
+    config.slate = options.slate;
+    config.num_threads = options.num_threads;
+    config.threshold = options.threshold;
+    config.num_seats = options.num_seats;
+    config.minimax = options.minimax;
+    config.minimax_budget = options.minimax_budget;
+    config.margins = options.margins;
+    config.batch_size = options.batch_size;
+    config.ballots = options.ballots_path ? &ballots : NULL;
+    config.bootstrap = options.bootstrap;
+    config.abstention = options.abstention;
+    config.num_errors = options.num_errors;
+    config.errors = options.errors;
+    config.num_districts = options.num_districts;
+    // the predicates need the winners they compare
+    config.methods |= capture_methods(options.num_predicates, options.predicates,
+                                      &config.candidate_statistics);
+    // the printed statistics are exact
+    config.approximate = verbose ? 0 : options.approximate;
+    if(config.approximate && (config.methods & (1U << METHOD_HITLER))){
+        fprintf(stderr,"\n** ERROR: The capture predicates need the hitler method,\n"
+                       ">>>>>>>>> which cannot be decided with --approximate.\n");
+        exit(1);
+    }
+
+    Simulation *simulation;
+    if(simulation_create(&config, &simulation)){
+        fprintf(stderr,"\n** ERROR: Not enough memory to populate election tables\n"
+                       ">>>>>>>>> Select a smaller number of issues.\n");
+        exit(1);
+    }
+
+    /******************
+     * PLATFORM SEARCH 
+     ******************/
+    if(options.search){
+        run_search(num_elections, &options, simulation);
+        simulation_destroy(simulation);
+        ballots_free(&ballots);
+        return 0;
+    }
+
+    /***************
+     * RESULT CACHE 
+     ***************/
+    // a run printing no election is its summary and data file alone
+    CacheKey key;
+    unsigned cached = options.cache_path && !verbose;
+    if(cached){
+        cache_key_init(&key);
+        cache_key_config(&config, num_elections, &key);
+    }
+    if(cached && !resumed && !cache_lookup(options.cache_path, &key, fout, simulation)){
+        if(fout && fclose(fout)){
+            fprintf(stderr, "\n** ERROR: Unable to write the election data file\n");
+            exit(1);
         }
-        // sort two-party system candidates
-        qsort(status_quo, 2, sizeof(*status_quo), sort_candidates);
-        
-        /*****************
-         * REPORT RESULTS 
-         *****************/
-        // print to screen
-        if(verbose){
-            printf("\n========== ELECTION #%lu ==========\n", j+1);
-            print_election_statistics(population_size, num_issues,
-                                      num_a_winners, num_candidates, num_h_winners, num_winners,
-                                      hitler_table, candidates, &washington, status_quo,
-                                      elected, elected_a, elected_h);
-        }
-        
-        // print to file
-        if(fout){
-            /********************************************
-             * Add code here to produce custom data file
-             ********************************************/
-        }
+        print_summary(simulation_summary(simulation));
+        simulation_destroy(simulation);
+        ballots_free(&ballots);
+        free(options.slate);
+        free(options.predicates);
+        return 0;
     }
 
+    // progress is reported from a separate thread
+    Telemetry *telemetry = NULL;
+    if((options.telemetry_path || options.progress) &&
+       telemetry_start(options.telemetry_path, options.telemetry_format, options.progress,
+                       options.telemetry_interval, num_elections - run.num_run, &telemetry)){
+        fprintf(stderr,"\n** ERROR: Unable to start the telemetry reporter\n");
+        exit(1);
+    }
+    simulation_attach_telemetry(telemetry_counters(telemetry), simulation);
+
+    // results are formatted and written on a separate thread
+    PipelineConfig output;
+    pipeline_default_config(&output);
+    output.methods = config.methods;
+    output.population_size = options.num_districts ? options.num_districts * population_size
+                                                   : population_size;
+    output.num_issues = num_issues;
+    output.verbose = verbose;
+    output.irv_rounds = options.irv_rounds;
+    output.threshold = options.threshold;
+    output.turnout = options.abstention > 0;
+    output.num_districts = options.num_districts;
+    output.num_seats = options.num_seats;
+    output.minimax = options.minimax;
+    output.margins = options.margins;
+    output.approximate = config.approximate > 0;
+    output.ring_size = options.ring_size;
+    output.backpressure = options.backpressure;
+    Pipeline pipeline;
+    if((verbose || fout) &&
+       pipeline_start(&output, fout, telemetry_counters(telemetry), &pipeline)){
+        fprintf(stderr,"\n** ERROR: Unable to start the output pipeline\n");
+        exit(1);
+    }
+
+    // under capture only the selected elections reach the pipeline
+    unsigned capture = options.capture;
+    Selection selection;
+    selection.pipeline = &pipeline;
+    if(capture &&
+       capture_init(num_issues, options.num_predicates, options.reservoir_size,
+                    config.seed, config.stream + 1, options.predicates, &selection.capture)){
+        fprintf(stderr,"\n** ERROR: Not enough memory for the capture reservoir\n");
+        exit(1);
+    }
+
+    // the checkpoint restores what the run had done
+    if(resumed &&
+       (simulation_load(saved, simulation) ||
+        (capture && capture_load(saved, &selection.capture)) ||
+        checkpoint_close(saved))){
+        fprintf(stderr, "\n** ERROR: Checkpoint %s does not fit the run\n", resume_path);
+        exit(1);
+    }
+
+    /*************
+     * SIMULATION 
+     *************/
+    run.verbose = verbose;
+    run.num_issues = num_issues;
+    run.population_size = population_size;
+    run.num_elections = num_elections;
+    run.seed = config.seed;
+    if(options.checkpoint_path){
+        run_checkpointed(options.checkpoint_path, options.checkpoint_interval, &run,
+                         (verbose || fout) ? &pipeline : NULL, capture ? &selection : NULL,
+                         simulation);
+    }else{
+        run_elections(num_elections, (verbose || fout) ? &pipeline : NULL,
+                      capture ? &selection : NULL, simulation);
+    }
+    if(capture){
+        capture_finish(submit_result, &pipeline, &selection.capture);
+    }
+
+    /*****************
+     * REPORT RESULTS 
+     *****************/
+    if(verbose || fout){
+        pipeline_finish(&pipeline);
+    }
+    // the last report counts every record written
+    telemetry_stop(telemetry);
+    if((verbose || fout) && pipeline.num_dropped){
+        fprintf(stderr, "\n** WARNING: Dropped the candidate detail of %lu elections\n",
+                pipeline.num_dropped);
+    }
+    if((verbose || fout) && pipeline.num_stalls){
+        fprintf(stderr, "\n** WARNING: Waited %lu times for the writer to make room in the ring\n"
+                        ">>>>>>>>> A larger --ring-size may keep the simulation from waiting.\n",
+                pipeline.num_stalls);
+    }
+
+    if(capture){
+        printf("\nCaptured %lu of %lu elections and sampled %zu of the rest\n",
+               selection.capture.num_captured, num_elections, selection.capture.num_slots);
+        capture_free(&selection.capture);
+    }
+
+    print_summary(simulation_summary(simulation));
+
+    // only a run whose every record was written is kept
+    if(cached && !(fout && pipeline.num_dropped) &&
+       cache_store(options.cache_path, &key, run.data_path, simulation)){
+        fprintf(stderr, "\n** WARNING: Unable to keep the run in the cache %s\n",
+                options.cache_path);
+    }
+
+    // a completed run has nothing to resume
+    if(options.checkpoint_path){
+        remove(options.checkpoint_path);
+    }
+    if(resumed){
+        checkpoint_free_run(&run);
+    }
+
+    simulation_destroy(simulation);
+    ballots_free(&ballots);
+    free(options.slate);
+    free(options.predicates);
+
     return 0;
 }
@@ -0,0 +1,255 @@
+/*======================================================================
+ *                               workers.c
+ *======================================================================
+ * Pool of worker threads splitting one election across cores.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Pool of worker threads splitting one election across cores.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "workers.h"
+
+/*
+ * Smallest work, in items times cost, worth waking the pool for, and
+ * smallest work worth claiming as one block.
+ */
+#define PARALLEL_MIN_WORK ((size_t)1 << 18)
+#define BLOCK_MIN_WORK ((size_t)1 << 14)
+
+/*
+ * Blocks per thread when the work allows it; spare blocks let threads
+ * which finish early steal from the others.
+ */
+#define BLOCKS_PER_THREAD 8
+
+/*
+ * Share of the blocks of a job; the owner and thieves alike claim
+ * blocks by advancing next. The padding keeps shares on separate cache
+ * lines.
+ */
+typedef struct{
+    size_t next;
+    size_t end;
+    char padding[64 - 2*sizeof(size_t)];
+} BlockRange;
+
+typedef struct{
+    WorkerPool *pool;
+    unsigned thread;
+} WorkerSlot;
+
+struct WorkerPool{
+    unsigned num_threads;
+    pthread_t threads[WORKER_MAX_THREADS];
+    WorkerSlot slots[WORKER_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    unsigned long generation; // number of jobs started
+    unsigned num_running; // threads still working on the current job
+    unsigned stopping;
+
+    // current job
+    WorkerJob job;
+    void *argument;
+    size_t num_items;
+    size_t block_size;
+    BlockRange ranges[WORKER_MAX_THREADS];
+};
+
+/*
+ * Works through the thread's own share of the blocks, then steals from
+ * the shares of the following threads in turn.
+ */
+static void run_blocks(unsigned thread, WorkerPool *pool){
+    unsigned t;
+    for(t = 0; t < pool->num_threads; t++){
+        BlockRange *range = pool->ranges + (thread + t) % pool->num_threads;
+        for(;;){
+            size_t block = __atomic_fetch_add(&range->next, 1, __ATOMIC_RELAXED);
+            if(block >= range->end){
+                break;
+            }
+            size_t first = block * pool->block_size;
+            size_t last = first + pool->block_size;
+            if(last > pool->num_items){
+                last = pool->num_items;
+            }
+            pool->job(first, last, thread, pool->argument);
+        }
+    }
+}
+
+static void *worker_main(void *argument){
+    WorkerSlot *slot = argument;
+    WorkerPool *pool = slot->pool;
+    unsigned long generation = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for(;;){
+        while(pool->generation == generation && !pool->stopping){
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if(pool->stopping){
+            break;
+        }
+        generation = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_blocks(slot->thread, pool);
+
+        pthread_mutex_lock(&pool->lock);
+        if(!--pool->num_running){
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+int worker_pool_create(unsigned num_threads, WorkerPool **pool){
+    *pool = NULL;
+    if(!num_threads || num_threads > WORKER_MAX_THREADS){
+        return -1;
+    }
+    WorkerPool *p = calloc(1, sizeof(*p));
+    if(!p){
+        return -1;
+    }
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->start, NULL);
+    pthread_cond_init(&p->done, NULL);
+
+    // the caller is thread 0
+    p->num_threads = 1;
+    while(p->num_threads < num_threads){
+        WorkerSlot *slot = p->slots + p->num_threads;
+        slot->pool = p;
+        slot->thread = p->num_threads;
+        if(pthread_create(p->threads + p->num_threads, NULL, worker_main, slot)){
+            worker_pool_destroy(p);
+            return -1;
+        }
+        p->num_threads++;
+    }
+    *pool = p;
+    return 0;
+}
+
+void worker_pool_destroy(WorkerPool *pool){
+    if(!pool){
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    unsigned t;
+    for(t = 1; t < pool->num_threads; t++){
+        pthread_join(pool->threads[t], NULL);
+    }
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+unsigned worker_pool_size(const WorkerPool *pool){
+    return pool ? pool->num_threads : 1;
+}
+
+void worker_pool_run(size_t num_items,
+                     size_t cost,
+                     WorkerJob job,
+                     void *argument,
+                     WorkerPool *pool){
+    unsigned num_threads = worker_pool_size(pool);
+    if(!num_items){
+        return;
+    }
+    if(num_threads == 1 || num_items * cost < PARALLEL_MIN_WORK){
+        job(0, num_items, 0, argument);
+        return;
+    }
+
+    // several blocks per thread, each worth claiming
+    size_t block_size = num_items / (BLOCKS_PER_THREAD * num_threads);
+    size_t min_block_size = (BLOCK_MIN_WORK + cost - 1) / (cost ? cost : 1);
+    if(block_size < min_block_size){
+        block_size = min_block_size;
+    }
+    size_t num_blocks = (num_items + block_size - 1) / block_size;
+
+    unsigned t;
+    for(t = 0; t < num_threads; t++){
+        pool->ranges[t].next = t * num_blocks / num_threads;
+        pool->ranges[t].end = (t + 1) * num_blocks / num_threads;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->argument = argument;
+    pool->num_items = num_items;
+    pool->block_size = block_size;
+    pool->num_running = num_threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_blocks(0, pool);
+
+    pthread_mutex_lock(&pool->lock);
+    while(pool->num_running){
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,140 @@
+/*======================================================================
+ *                               workers.h
+ *======================================================================
+ * Pool of worker threads splitting one election across cores.
+ *----------------------------------------------------------------------
+ * Author:      William Breathitt Gray
+ * Date:        October 18, 2026
+ * Version:	1.0
+ * License:     Simplified BSD License
+ * 
+ * Language:    C
+ * Standard:    C99
+ * Doc System:  Doxygen
+ *----------------------------------------------------------------------
+ * Copyright (c) 2012, William Breathitt Gray
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *======================================================================
+ *======================================================================
+ */
+/**
+ * @file
+ * Pool of worker threads splitting one election across cores.
+ * 
+ * @author	William Breathitt Gray
+ * @date	October 18, 2026
+ * @version	1.0
+ * @copyright	Simplified BSD License
+ */
+#ifndef WORKERS_H
+#define WORKERS_H
+
+#include <stddef.h>
+
+/**
+ * Largest number of threads of a worker pool, the caller included.
+ */
+#define WORKER_MAX_THREADS 64
+
+/**
+ * Number of unsigned partial sums each thread may keep in a job; one
+ * cache line, so that threads do not share lines.
+ */
+#define WORKER_PARTIALS 16
+
+/**
+ * Work a job does on the items [first, last).
+ *
+ * @param first first item
+ * @param last one past the last item
+ * @param thread index of the thread doing the work, less than the size
+ *               of the pool; threads may keep partial results by index
+ * @param argument pointer supplied to worker_pool_run
+ */
+typedef void (*WorkerJob)(size_t first,
+                          size_t last,
+                          unsigned thread,
+                          void *argument);
+
+/**
+ * Opaque pool of threads running jobs over ranges of items; the thread
+ * calling worker_pool_run is the pool's thread 0.
+ */
+typedef struct WorkerPool WorkerPool;
+
+/**
+ * Creates a worker pool.
+ *
+ * @param num_threads number of threads, the caller included; at most
+ *                    WORKER_MAX_THREADS
+ * @param pool pointer to the variable holding the new pool
+ *
+ * @return 0 on success, -1 if num_threads is invalid or the threads
+ *         could not be started
+ */
+int worker_pool_create(unsigned num_threads, WorkerPool **pool);
+
+/**
+ * Stops the threads of a worker pool and releases it.
+ *
+ * @param pool pointer to the pool; may be NULL
+ */
+void worker_pool_destroy(WorkerPool *pool);
+
+/**
+ * Returns the number of threads of a worker pool.
+ *
+ * @param pool pointer to the pool; may be NULL
+ *
+ * @return number of threads, the caller included; 1 for a NULL pool
+ */
+unsigned worker_pool_size(const WorkerPool *pool);
+
+/**
+ * Runs a job over num_items items and waits for it to finish.
+ *
+ * The items are split into blocks and every thread starts on its own
+ * contiguous share of the blocks; a thread which runs out steals blocks
+ * from the others. The block size adapts to the work: a job whose
+ * items times cost is too small to repay waking the pool runs on the
+ * caller alone, and otherwise blocks are kept large enough to amortize
+ * claiming them but small enough for several per thread.
+ *
+ * @param num_items number of items
+ * @param cost relative cost of an item, e.g. the length of its inner
+ *             loop
+ * @param job the work on a range of items
+ * @param argument pointer passed through to the job
+ * @param pool pointer to the pool; NULL runs the job on the caller
+ */
+void worker_pool_run(size_t num_items,
+                     size_t cost,
+                     WorkerJob job,
+                     void *argument,
+                     WorkerPool *pool);
+
+#endif